@@ -9,6 +9,7 @@
 #include "DataConfig/DcCorePrivate.h"
 #include "DataConfig/Source/DcSourceUtils.h"
 #include "DataConfig/SerDe/DcSerDeUtils.h"
+#include "DataConfig/SerDe/DcSerDeEnumLookup.h"
 
 namespace DcAutomationUtils
 {
@@ -669,6 +670,10 @@ void AmendMetaData(UField* Field, const FName& MetaKey, const TCHAR* MetaValue)
 	check(Field);
 	if (!Field->HasMetaData(MetaKey))
 		Field->SetMetaData(MetaKey, MetaValue);
+
+	//	enum lookups caches `Bitflags`
+	if (UEnum* Enum = Cast<UEnum>(Field))
+		DcSerDeUtils::InvalidateEnumLookup(Enum);
 }
 
 void AmendMetaData(UStruct* Struct, const FName& FieldName, const FName& MetaKey, const TCHAR* MetaValue)
@@ -752,6 +757,10 @@ FDcResult DeserializeFrom(FDcReader* Reader, FDcPropertyDatum Datum,
 	{
 		DcSetupJsonDeserializeHandlers(Deserializer);
 	}
+	else if (SetupType == EDefaultSetupType::SharedJSONHandlers)
+	{
+		Deserializer.Parent = &DcGetSharedJsonDeserializer();
+	}
 	else if (SetupType == EDefaultSetupType::SetupNothing)
 	{
 		//	pass
@@ -777,6 +786,10 @@ FDcResult SerializeInto(FDcWriter* Writer, FDcPropertyDatum Datum,
 	{
 		DcSetupJsonSerializeHandlers(Serializer);
 	}
+	else if (SetupType == EDefaultSetupType::SharedJSONHandlers)
+	{
+		Serializer.Parent = &DcGetSharedJsonSerializer();
+	}
 	else if (SetupType == EDefaultSetupType::SetupNothing)
 	{
 		//	pass
@@ -2,11 +2,21 @@
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
 #include "DataConfig/Diagnostic/DcDiagnosticUtils.h"
+#include "DataConfig/SerDe/DcSerDeEnumLookup.h"
 
 TArray<FDcEnv> gDcEnvs;
 
+namespace DcEnvDetails {
+
+static thread_local FDcEnv* ThreadEnv = nullptr;
+
+} // namespace DcEnvDetails
+
 FDcEnv& DcEnv()
 {
+	if (DcEnvDetails::ThreadEnv)
+		return *DcEnvDetails::ThreadEnv;
+
 	check(DcIsInitialized());
 	return gDcEnvs[gDcEnvs.Num() - 1];
 }
@@ -47,6 +57,18 @@ FDcEnv::~FDcEnv()
 	FlushDiags();
 }
 
+FDcScopedThreadEnv::FDcScopedThreadEnv()
+{
+	PrevEnv = DcEnvDetails::ThreadEnv;
+	DcEnvDetails::ThreadEnv = &Env;
+}
+
+FDcScopedThreadEnv::~FDcScopedThreadEnv()
+{
+	check(DcEnvDetails::ThreadEnv == &Env);
+	DcEnvDetails::ThreadEnv = PrevEnv;
+}
+
 namespace DcEnvDetails {
 
 bool bInitialized = false;
@@ -76,6 +98,7 @@ void DcStartUp(EDcInitializeAction InAction)
 	DcDiagGroups.Emplace(&DcDMsgPack::Details);
 
 	DcPushEnv();
+	DcSerDeUtils::RegisterEnumLookupHooks();
 	DcEnvDetails::bInitialized = true;
 
 	if (InAction == EDcInitializeAction::SetAsConsole)
@@ -90,6 +113,8 @@ void DcShutDown()
 		DcPopEnv();
 
 	DcDiagGroups.RemoveAt(0, DcDiagGroups.Num());
+	DcSerDeUtils::UnregisterEnumLookupHooks();
+	DcSerDeUtils::InvalidateEnumLookup();
 
 	DcEnvDetails::bInitialized = false;
 }
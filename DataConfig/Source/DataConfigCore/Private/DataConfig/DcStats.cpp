@@ -0,0 +1,68 @@
+#include "DataConfig/DcStats.h"
+#include "Misc/StringBuilder.h"
+#include "UObject/Class.h"
+
+int64 FDcStats::GetEntryTotal() const
+{
+	int64 Total = 0;
+	for (int64 Count : EntryCounts)
+		Total += Count;
+	return Total;
+}
+
+void FDcStats::Reset()
+{
+	*this = FDcStats{};
+}
+
+void FDcStats::Merge(const FDcStats& Other)
+{
+	for (int Ix = 0; Ix < UE_ARRAY_COUNT(EntryCounts); Ix++)
+		EntryCounts[Ix] += Other.EntryCounts[Ix];
+
+	BytesConsumed += Other.BytesConsumed;
+	StringsCreated += Other.StringsCreated;
+	NamesCreated += Other.NamesCreated;
+	PredicateEvaluations += Other.PredicateEvaluations;
+	Putbacks += Other.Putbacks;
+	ContainerGrowths += Other.ContainerGrowths;
+	PeakDepth = FMath::Max(PeakDepth, Other.PeakDepth);
+
+	for (const auto& Pair : Other.HandlerCalls)
+		HandlerCalls.FindOrAdd(Pair.Key) += Pair.Value;
+}
+
+void FDcStats::ForEachMetric(TFunctionRef<void(const FString&, int64)> Func) const
+{
+	UEnum* DataEntryEnum = StaticEnum<EDcDataEntry>();
+	check(DataEntryEnum);
+
+	//	only non zero entries and handlers are reported
+	for (int Ix = 0; Ix < UE_ARRAY_COUNT(EntryCounts); Ix++)
+	{
+		if (EntryCounts[Ix])
+			Func(TEXT("Entry.") + DataEntryEnum->GetNameStringByIndex(Ix), EntryCounts[Ix]);
+	}
+
+	Func(TEXT("BytesConsumed"), BytesConsumed);
+	Func(TEXT("StringsCreated"), StringsCreated);
+	Func(TEXT("NamesCreated"), NamesCreated);
+	Func(TEXT("PredicateEvaluations"), PredicateEvaluations);
+	Func(TEXT("Putbacks"), Putbacks);
+	Func(TEXT("ContainerGrowths"), ContainerGrowths);
+	Func(TEXT("PeakDepth"), PeakDepth);
+
+	for (const auto& Pair : HandlerCalls)
+		Func(TEXT("Handler.") + Pair.Key.ToString(), Pair.Value);
+}
+
+FString FDcStats::ToString() const
+{
+	TStringBuilder<1024> Sb;
+	ForEachMetric([&Sb](const FString& Name, int64 Value)
+	{
+		Sb.Appendf(TEXT("%s: %lld\n"), *Name, Value);
+	});
+	return Sb.ToString();
+}
+
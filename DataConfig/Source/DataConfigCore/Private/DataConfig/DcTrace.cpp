@@ -0,0 +1,23 @@
+#include "DataConfig/DcTrace.h"
+
+#if DC_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(DataConfigChannel);
+
+TRACE_DECLARE_INT_COUNTER(DcBytesRead, TEXT("DataConfig/BytesRead"));
+TRACE_DECLARE_INT_COUNTER(DcTokensRead, TEXT("DataConfig/TokensRead"));
+TRACE_DECLARE_INT_COUNTER(DcElementsAllocated, TEXT("DataConfig/ElementsAllocated"));
+
+void FDcTraceScope::Begin(const FName& Name)
+{
+	//	event types are registered once per name, so there's no string conversion on every scope
+	static thread_local TMap<FName, uint32> SpecIds;
+	uint32* SpecIdPtr = SpecIds.Find(Name);
+	if (SpecIdPtr == nullptr)
+		SpecIdPtr = &SpecIds.Add(Name, FCpuProfilerTrace::OutputEventType(*Name.ToString()));
+
+	FCpuProfilerTrace::OutputBeginEvent(*SpecIdPtr);
+	bActive = true;
+}
+
+#endif // DC_TRACE_ENABLED
@@ -38,6 +38,76 @@ FDcResult FDcDeserializeContext::Prepare()
 		return DC_FAIL(DcDSerDe, ContextExpectOneProperty) << Properties.Num();
 	}
 
+	if (Stats)
+	{
+		Reader->Stats = Stats;
+		Writer->Stats = Stats;
+	}
+
 	State = EState::Ready;
 	return DcOk();
 }
+
+bool FDcObjectResolveCache::Find(UClass* Class, const FString& Str, UObject*& OutObject)
+{
+	if (TMap<FString, TWeakObjectPtr<UObject>>* ClassResolved = Resolved.Find(Class))
+	{
+		if (TWeakObjectPtr<UObject>* ObjectPtr = ClassResolved->Find(Str))
+		{
+			if (UObject* Object = ObjectPtr->Get())
+			{
+				HitCount++;
+				OutObject = Object;
+				return true;
+			}
+
+			//	stale, object got GCed since
+			ClassResolved->Remove(Str);
+		}
+	}
+
+	MissCount++;
+	return false;
+}
+
+void FDcObjectResolveCache::Add(UClass* Class, const FString& Str, UObject* Object)
+{
+	if (Object == nullptr)
+		return;
+
+	Resolved.FindOrAdd(Class).Add(Str, Object);
+}
+
+bool FDcObjectResolveCache::FindClass(const FString& Str, UClass*& OutClass)
+{
+	if (TWeakObjectPtr<UClass>* ClassPtr = ResolvedClasses.Find(Str))
+	{
+		if (UClass* Class = ClassPtr->Get())
+		{
+			HitCount++;
+			OutClass = Class;
+			return true;
+		}
+
+		ResolvedClasses.Remove(Str);
+	}
+
+	MissCount++;
+	return false;
+}
+
+void FDcObjectResolveCache::AddClass(const FString& Str, UClass* Class)
+{
+	if (Class == nullptr)
+		return;
+
+	ResolvedClasses.Add(Str, Class);
+}
+
+void FDcObjectResolveCache::Empty()
+{
+	Resolved.Empty();
+	ResolvedClasses.Empty();
+	HitCount = 0;
+	MissCount = 0;
+}
@@ -3,6 +3,8 @@
 #include "DataConfig/DcEnv.h"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Reader/DcReader.h"
+#include "DataConfig/Misc/DcTemplateUtils.h"
 
 namespace DcDeserializeUtils
 {
@@ -30,6 +32,23 @@ EDcDeserializePredicateResult PredicateIsRootProperty(FDcDeserializeContext& Ctx
 		: EDcDeserializePredicateResult::Pass;
 }
 
+FDcResult WriteFieldNameOrSkip(FDcDeserializeContext& Ctx, FDcReader* Reader, const FName& FieldName, bool* bOutSkipped)
+{
+	if (Ctx.bIgnoreUnknownFields)
+	{
+		bool bHasField;
+		DC_TRY(Ctx.Writer->PeekWriteName(FieldName, &bHasField));
+		if (!bHasField)
+		{
+			DC_TRY(Reader->SkipValue());
+			return ReadOutOk(bOutSkipped, true);
+		}
+	}
+
+	DC_TRY(Ctx.Writer->WriteName(FieldName));
+	return ReadOutOk(bOutSkipped, false);
+}
+
 } // namespace DcDeserializeUtils
 
 
@@ -1,4 +1,10 @@
 #include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/DcStats.h"
+#include "DataConfig/DcTrace.h"
+#include "DataConfig/Deserialize/DcDeserializeUtils.h"
+#include "DataConfig/Reader/DcReader.h"
+#include "DataConfig/SerDe/DcSerDeUtils.h"
+#include "DataConfig/SerDe/DcSerDeUtils.inl"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/Diagnostic/DcDiagnosticUtils.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
@@ -7,37 +13,106 @@
 #include "DataConfig/Property/DcPropertyUtils.h"
 #include "Misc/ScopeExit.h"
 #include "Misc/StringBuilder.h"
+#include "HAL/PlatformTime.h"
 
 namespace DcDeserializerDetails
 {
 
-static FORCEINLINE FDcResult ExecuteDeserializeHandler(FDcDeserializeContext& Ctx, FDcDeserializeDelegate& Handler)
+static FORCEINLINE FDcResult ExecuteDeserializeHandler(FDcDeserializeContext& Ctx, FDcDeserializeDelegate& Handler, const FName& HandlerName)
 {
 	if (!Handler.IsBound())
 		return DC_FAIL(DcDCommon, StaleDelegate);
 
+	DC_STATS_HANDLER(Ctx.Stats, HandlerName, Ctx.Properties.Num());
+	DC_TRACE_SCOPE(HandlerName);
 	return Handler.Execute(Ctx);
 }
 
+#if DC_TRACE_ENABLED
+static FName GetTraceRootName(FFieldVariant& Property)
+{
+	if (UStruct* Struct = DcPropertyUtils::TryGetStruct(Property))
+		return Struct->GetFName();
+	else if (Property.IsUObject())
+		return Property.GetFName();
+	else
+		return Property.ToFieldUnsafe()->GetClass()->GetFName();
+}
+#endif // DC_TRACE_ENABLED
+
+template<typename TKey>
+static FORCEINLINE FDcDeserializeDelegate* FindHandler(FDcDeserializer* Self, TMap<TKey, FDcDeserializeDelegate> FDcDeserializer::*Map, TKey Key)
+{
+	for (FDcDeserializer* Cur = Self; Cur; Cur = Cur->Parent)
+	{
+		if (FDcDeserializeDelegate* HandlerPtr = (Cur->*Map).Find(Key))
+			return HandlerPtr;
+	}
+
+	return nullptr;
+}
+
+template<typename TKey>
+static FORCEINLINE FDcDeserializer* FindHandlerOwner(FDcDeserializer* Self, TMap<TKey, FDcDeserializeDelegate> FDcDeserializer::*Map, TKey Key)
+{
+	for (FDcDeserializer* Cur = Self; Cur; Cur = Cur->Parent)
+	{
+		if ((Cur->*Map).Contains(Key))
+			return Cur;
+	}
+
+	return nullptr;
+}
+
+template<typename TKey>
+static void FlattenSliceable(TSet<TKey>& Sliceable, const TMap<TKey, FDcDeserializeDelegate>& Map, const TSet<TKey>& ParentSliceable)
+{
+	//	only keys that'll be taken from parent, overrides here keep their own flag
+	for (TKey Key : ParentSliceable)
+	{
+		if (!Map.Contains(Key))
+			Sliceable.Add(Key);
+	}
+}
+
+template<typename TKey>
+static void FlattenHandlers(TMap<TKey, FDcDeserializeDelegate>& Map, const TMap<TKey, FDcDeserializeDelegate>& ParentMap)
+{
+	for (const auto& Pair : ParentMap)
+	{
+		if (!Map.Contains(Pair.Key))
+			Map.Add(Pair.Key, Pair.Value);
+	}
+	Map.Shrink();
+}
+
 static FDcResult DeserializeBody(FDcDeserializer* Self, FDcDeserializeContext& Ctx)
 {
 	//	use predicated deserializers first, if it's not handled then try direct handlers
-	for (auto& PredEntry : Self->PredicatedDeserializers)
+	for (FDcDeserializer* Cur = Self; Cur; Cur = Cur->Parent)
 	{
-		if (!PredEntry.Predicate.IsBound())
-			return DC_FAIL(DcDCommon, StaleDelegate);
+		for (auto& PredEntry : Cur->PredicatedDeserializers)
+		{
+			if (!PredEntry.Predicate.IsBound())
+				return DC_FAIL(DcDCommon, StaleDelegate);
 
-		if (PredEntry.Predicate.Execute(Ctx) == EDcDeserializePredicateResult::Process)
-			return ExecuteDeserializeHandler(Ctx, PredEntry.Handler);
+			DC_STATS_ADD(Ctx.Stats, PredicateEvaluations, 1);
+			if (PredEntry.Predicate.Execute(Ctx) == EDcDeserializePredicateResult::Process)
+				return ExecuteDeserializeHandler(Ctx, PredEntry.Handler, PredEntry.Name);
+		}
 	}
 
 	FFieldVariant& Property = Ctx.TopProperty();
 	FDcDeserializeDelegate* HandlerPtr = nullptr;
+	FName HandlerName;
 
 	if (!Ctx.bSkipStructHandlers)
 	{
 		if (UStruct* Struct = DcPropertyUtils::TryGetStruct(Property))
-			HandlerPtr = Self->StructDeserializeMap.Find(Struct);
+		{
+			HandlerPtr = FindHandler(Self, &FDcDeserializer::StructDeserializeMap, Struct);
+			HandlerName = Struct->GetFName();
+		}
 	}
 
 	if (!HandlerPtr)
@@ -47,7 +122,8 @@ static FDcResult DeserializeBody(FDcDeserializer* Self, FDcDeserializeContext& C
 			UObject* Object = CastChecked<UObject>(Property.ToUObjectUnsafe());
 			check(IsValid(Object));
 			UClass* Class = Object->GetClass();
-			HandlerPtr = Self->UClassDeserializerMap.Find(Class);
+			HandlerPtr = FindHandler(Self, &FDcDeserializer::UClassDeserializerMap, Class);
+			HandlerName = Class->GetFName();
 			if (HandlerPtr == nullptr)
 				return DC_FAIL(DcDSerDe, NoMatchingHandler)
 					<< Ctx.TopProperty().GetFName() << Class->GetFName();
@@ -57,14 +133,15 @@ static FDcResult DeserializeBody(FDcDeserializer* Self, FDcDeserializeContext& C
 			FField* Field = Property.ToFieldUnsafe();
 			check(Field->IsValidLowLevel());
 			FFieldClass* FieldClass = Field->GetClass();
-			HandlerPtr = Self->FieldClassDeserializerMap.Find(FieldClass);
+			HandlerPtr = FindHandler(Self, &FDcDeserializer::FieldClassDeserializerMap, FieldClass);
+			HandlerName = FieldClass->GetFName();
 			if (HandlerPtr == nullptr)
 				return DC_FAIL(DcDSerDe, NoMatchingHandler)
 					<< Ctx.TopProperty().GetFName() << FieldClass->GetFName();
 		}
 	}
 
-	return ExecuteDeserializeHandler(Ctx, *HandlerPtr);
+	return ExecuteDeserializeHandler(Ctx, *HandlerPtr, HandlerName);
 }
 
 static void AmendDiagnostic(FDcDiagnostic& Diag, FDcDeserializeContext& Ctx)
@@ -116,17 +193,213 @@ static void AmendDiagnostic(FDcDiagnostic& Diag, FDcDeserializeContext& Ctx)
 
 }
 
-}	// namespace DcDeserializerDetails
+static void AmendLastDiagnostic(FDcDeserializeContext& Ctx)
+{
+	FDcDiagnostic& Diag = DcEnv().GetLastDiag();
+	DcDiagnosticUtils::AmendDiagnostic(Diag, Ctx.Reader, Ctx.Writer);
+	AmendDiagnostic(Diag, Ctx);
+}
 
-FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx)
+using FSliceFrame = FDcDeserializeContext::FSliceFrame;
+
+static bool IsHandledByPredicate(FDcDeserializer* Self, FDcDeserializeContext& Ctx)
 {
-	auto _AmendDiag = [](FDcDeserializeContext& Ctx)
+	for (FDcDeserializer* Cur = Self; Cur; Cur = Cur->Parent)
 	{
-		FDcDiagnostic& Diag = DcEnv().GetLastDiag();
-		DcDiagnosticUtils::AmendDiagnostic(Diag, Ctx.Reader, Ctx.Writer);
-		DcDeserializerDetails::AmendDiagnostic(Diag, Ctx);
-	};
+		for (auto& PredEntry : Cur->PredicatedDeserializers)
+		{
+			//	stale ones are reported by `DeserializeBody`
+			if (!PredEntry.Predicate.IsBound())
+				return true;
+
+			DC_STATS_ADD(Ctx.Stats, PredicateEvaluations, 1);
+			if (PredEntry.Predicate.Execute(Ctx) == EDcDeserializePredicateResult::Process)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+//	only containers going to direct handlers that opted in are walked by the slice stack,
+//	anything else goes through `DeserializeBody` as usual
+static bool TryGetSliceFrameType(FDcDeserializer* Self, FDcDeserializeContext& Ctx, FSliceFrame::EType& OutType)
+{
+	if (IsHandledByPredicate(Self, Ctx))
+		return false;
+
+	FFieldVariant& Property = Ctx.TopProperty();
+	if (!Ctx.bSkipStructHandlers)
+	{
+		UStruct* Struct = DcPropertyUtils::TryGetStruct(Property);
+		if (Struct && FindHandler(Self, &FDcDeserializer::StructDeserializeMap, Struct))
+			return false;
+	}
+
+	if (Property.IsUObject())
+	{
+		UClass* Class = CastChecked<UObject>(Property.ToUObjectUnsafe())->GetClass();
+		if (Class == UScriptStruct::StaticClass())
+			OutType = FSliceFrame::EType::Struct;
+		else if (Class == UClass::StaticClass())
+			OutType = FSliceFrame::EType::Class;
+		else
+			return false;
+
+		FDcDeserializer* Owner = FindHandlerOwner(Self, &FDcDeserializer::UClassDeserializerMap, Class);
+		return Owner && Owner->SliceableUClasses.Contains(Class);
+	}
+	else
+	{
+		FFieldClass* FieldClass = Property.ToFieldUnsafe()->GetClass();
+		if (FieldClass == FArrayProperty::StaticClass())
+			OutType = FSliceFrame::EType::Array;
+		else if (FieldClass == FSetProperty::StaticClass())
+			OutType = FSliceFrame::EType::Set;
+		else if (FieldClass == FStructProperty::StaticClass())
+			OutType = FSliceFrame::EType::Struct;
+		else
+			return false;
+
+		FDcDeserializer* Owner = FindHandlerOwner(Self, &FDcDeserializer::FieldClassDeserializerMap, FieldClass);
+		return Owner && Owner->SliceableFieldClasses.Contains(FieldClass);
+	}
+}
+
+static FDcResult OpenSliceFrame(FDcDeserializeContext& Ctx, FSliceFrame::EType Type)
+{
+	FSliceFrame Frame;
+	Frame.Type = Type;
+
+	switch (Type)
+	{
+		case FSliceFrame::EType::Array:
+			DC_TRY(Ctx.Reader->ReadArrayRoot());
+			DC_TRY(Ctx.Writer->WriteArrayRoot());
+			DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
+			break;
+		case FSliceFrame::EType::Set:
+			DC_TRY(Ctx.Reader->ReadArrayRoot());
+			DC_TRY(Ctx.Writer->WriteSetRoot());
+			DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
+			break;
+		case FSliceFrame::EType::Struct:
+		{
+			FDcStructAccess Access;
+			DC_TRY(Ctx.Reader->ReadMapRoot());
+			DC_TRY(Ctx.Writer->WriteStructRootAccess(Access));
+			break;
+		}
+		case FSliceFrame::EType::Class:
+			Frame.ClassAccess.Control = FDcClassAccess::EControl::ExpandObject;
+			DC_TRY(Ctx.Reader->ReadMapRoot());
+			DC_TRY(Ctx.Writer->WriteClassRootAccess(Frame.ClassAccess));
+			break;
+		default:
+			return DcNoEntry();
+	}
+
+	Ctx.SliceFrames.Add(Frame);
+	return DcOk();
+}
 
+static FDcResult CloseSliceFrame(FDcDeserializeContext& Ctx, FSliceFrame& Frame)
+{
+	switch (Frame.Type)
+	{
+		case FSliceFrame::EType::Array:
+			DC_TRY(Ctx.Reader->ReadArrayEnd());
+			DC_TRY(Ctx.Writer->WriteArrayEnd());
+			break;
+		case FSliceFrame::EType::Set:
+			DC_TRY(Ctx.Reader->ReadArrayEnd());
+			DC_TRY(Ctx.Writer->WriteSetEnd());
+			break;
+		case FSliceFrame::EType::Struct:
+			DC_TRY(Ctx.Reader->ReadMapEnd());
+			DC_TRY(Ctx.Writer->WriteStructEnd());
+			break;
+		case FSliceFrame::EType::Class:
+			DC_TRY(Ctx.Reader->ReadMapEnd());
+			DC_TRY(Ctx.Writer->WriteClassEndAccess(Frame.ClassAccess));
+			break;
+		default:
+			return DcNoEntry();
+	}
+
+	return DcOk();
+}
+
+//	a step either closes the top container, opens a nested one or deserializes a single value,
+//	it mirrors `HandlerArrayDeserialize/HandlerMapToStructDeserialize/HandlerMapToClassDeserialize`
+static FDcResult DeserializeSliceStep(FDcDeserializer* Self, FDcDeserializeContext& Ctx)
+{
+	FSliceFrame::EType FrameType = Ctx.SliceFrames.Top().Type;
+	bool bIsLinear = FrameType == FSliceFrame::EType::Array || FrameType == FSliceFrame::EType::Set;
+
+	EDcDataEntry CurPeek;
+	DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
+	if (CurPeek == (bIsLinear ? EDcDataEntry::ArrayEnd : EDcDataEntry::MapEnd))
+	{
+		FSliceFrame Frame = Ctx.SliceFrames.Pop();
+		DC_TRY(CloseSliceFrame(Ctx, Frame));
+
+		//	root property is pushed by `Prepare` and stays
+		if (Ctx.SliceFrames.Num() > 0)
+			Ctx.Properties.Pop();
+		return DcOk();
+	}
+
+	if (FrameType == FSliceFrame::EType::Struct)
+	{
+		FName FieldName;
+		DC_TRY(Ctx.Reader->ReadName(&FieldName));
+
+		bool bSkipped;
+		DC_TRY(DcDeserializeUtils::WriteFieldNameOrSkip(Ctx, Ctx.Reader, FieldName, &bSkipped));
+		if (bSkipped)
+			return DcOk();
+	}
+	else if (FrameType == FSliceFrame::EType::Class)
+	{
+		if (CurPeek != EDcDataEntry::String)
+			return DC_FAIL(DcDSerDe, DataEntryMismatch2)
+				<< EDcDataEntry::Name << EDcDataEntry::String << CurPeek;
+
+		FString Value;
+		DC_TRY(Ctx.Reader->ReadString(&Value));
+		if (DcSerDeUtils::IsMeta(Value))
+			return Ctx.Reader->SkipValue();
+
+		bool bSkipped;
+		DC_TRY(DcDeserializeUtils::WriteFieldNameOrSkip(Ctx, Ctx.Reader, FName(*Value), &bSkipped));
+		if (bSkipped)
+			return DcOk();
+	}
+
+	FFieldVariant Property;
+	DC_TRY(Ctx.Writer->PeekWriteProperty(&Property));
+	Ctx.Properties.Push(Property);
+
+	//	property is popped when the nested container closes
+	FSliceFrame::EType NestedType;
+	if (TryGetSliceFrameType(Self, Ctx, NestedType))
+		return OpenSliceFrame(Ctx, NestedType);
+
+	DC_TRY(DeserializeBody(Self, Ctx));
+
+	FFieldVariant Popped = Ctx.Properties.Pop();
+	if (Property != Popped)
+		return DC_FAIL(DcDSerDe, RecursiveDeserializeTopPropertyChanged);
+
+	return DcOk();
+}
+
+}	// namespace DcDeserializerDetails
+
+FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx)
+{
+	using DcDeserializerDetails::AmendLastDiagnostic;
 	using ECtxState = FDcDeserializeContext::EState;
 	if (Ctx.State == ECtxState::Uninitialized)
 	{
@@ -134,6 +407,7 @@ FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx)
 	}
 	else if (Ctx.State == ECtxState::Ready)
 	{
+		DC_TRACE_SCOPE(DcDeserializerDetails::GetTraceRootName(Ctx.TopProperty()));
 		Ctx.State = FDcDeserializeContext::EState::DeserializeInProgress;
 
 		ON_SCOPE_EXIT
@@ -142,14 +416,14 @@ FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx)
 		};
 
 		FDcResult Result = DcDeserializerDetails::DeserializeBody(this, Ctx);
-		if (!Result.Ok()) _AmendDiag(Ctx);
+		if (!Result.Ok()) AmendLastDiagnostic(Ctx);
 
 		return Result;
 	}
 	else if (Ctx.State == FDcDeserializeContext::EState::DeserializeInProgress)
 	{
 		FDcResult Result = DcDeserializerDetails::DeserializeBody(this, Ctx);
-		if (!Result.Ok()) _AmendDiag(Ctx);
+		if (!Result.Ok()) AmendLastDiagnostic(Ctx);
 
 		return Result;
 	}
@@ -159,26 +433,121 @@ FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx)
 	}
 }
 
+FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx, const FDcDeserializeBudget& Budget, EDcDeserializeStatus* OutStatus)
+{
+	using namespace DcDeserializerDetails;
+	using ECtxState = FDcDeserializeContext::EState;
+
+	auto _Fail = [](FDcDeserializeContext& Ctx)
+	{
+		Ctx.State = ECtxState::DeserializeEnded;
+		Ctx.SliceFrames.Empty();
+		AmendLastDiagnostic(Ctx);
+		return DcFail();
+	};
+
+	if (Ctx.State == ECtxState::Uninitialized)
+		return DC_FAIL(DcDSerDe, NotPrepared);
+
+	//	a scope per slice
+	DC_TRACE_SCOPE(GetTraceRootName(Ctx.TopProperty()));
+	if (Ctx.State == ECtxState::Ready)
+	{
+		Ctx.State = ECtxState::DeserializeInProgress;
+
+		FSliceFrame::EType RootType;
+		if (!TryGetSliceFrameType(this, Ctx, RootType))
+		{
+			//	nothing to slice, run it in one go
+			if (!DeserializeBody(this, Ctx).Ok())
+				return _Fail(Ctx);
+
+			Ctx.State = ECtxState::DeserializeEnded;
+			return ReadOutOk(OutStatus, EDcDeserializeStatus::Done);
+		}
+
+		if (!OpenSliceFrame(Ctx, RootType).Ok())
+			return _Fail(Ctx);
+	}
+	else if (Ctx.State != ECtxState::DeserializeInProgress || Ctx.SliceFrames.Num() == 0)
+	{
+		return DC_FAIL(DcDSerDe, ContextInvalidState) << (int)Ctx.State;
+	}
+
+	double StartTime = FPlatformTime::Seconds();
+	int32 Steps = 0;
+	while (Ctx.SliceFrames.Num() > 0)
+	{
+		if (!DeserializeSliceStep(this, Ctx).Ok())
+			return _Fail(Ctx);
+
+		Steps++;
+		if (Ctx.SliceFrames.Num() > 0
+			&& ((Budget.Steps > 0 && Steps >= Budget.Steps)
+				|| (Budget.Seconds > 0 && FPlatformTime::Seconds() - StartTime >= Budget.Seconds)))
+			return ReadOutOk(OutStatus, EDcDeserializeStatus::InProgress);
+	}
+
+	Ctx.State = ECtxState::DeserializeEnded;
+	return ReadOutOk(OutStatus, EDcDeserializeStatus::Done);
+}
+
 void FDcDeserializer::AddDirectHandler(UClass* PropertyClass, FDcDeserializeDelegate&& Delegate)
 {
+	check(!bFrozen);
 	check(PropertyClass && !UClassDeserializerMap.Contains(PropertyClass));
 	UClassDeserializerMap.Add(PropertyClass, MoveTemp(Delegate));
 }
 
 void FDcDeserializer::AddDirectHandler(FFieldClass* PropertyClass, FDcDeserializeDelegate&& Delegate)
 {
+	check(!bFrozen);
 	check(PropertyClass && !FieldClassDeserializerMap.Contains(PropertyClass));
 	FieldClassDeserializerMap.Add(PropertyClass, MoveTemp(Delegate));
 }
 
+void FDcDeserializer::AddSliceableDirectHandler(UClass* PropertyClass, FDcDeserializeDelegate&& Delegate)
+{
+	AddDirectHandler(PropertyClass, MoveTemp(Delegate));
+	SliceableUClasses.Add(PropertyClass);
+}
+
+void FDcDeserializer::AddSliceableDirectHandler(FFieldClass* PropertyClass, FDcDeserializeDelegate&& Delegate)
+{
+	AddDirectHandler(PropertyClass, MoveTemp(Delegate));
+	SliceableFieldClasses.Add(PropertyClass);
+}
+
 void FDcDeserializer::AddPredicatedHandler(FDcDeserializePredicate&& Predicate, FDcDeserializeDelegate&& Delegate, const FName Name)
 {
+	check(!bFrozen);
 	PredicatedDeserializers.Add(FPredicatedHandlerEntry{MoveTemp(Predicate), MoveTemp(Delegate), Name});
 }
 
 void FDcDeserializer::AddStructHandler(UStruct* Struct, FDcDeserializeDelegate&& Delegate)
 {
+	check(!bFrozen);
 	check(Struct && !StructDeserializeMap.Contains(Struct));
 	StructDeserializeMap.Add(Struct, Delegate);
 }
 
+void FDcDeserializer::Freeze()
+{
+	check(!bFrozen);
+	using namespace DcDeserializerDetails;
+
+	for (FDcDeserializer* Cur = Parent; Cur; Cur = Cur->Parent)
+	{
+		PredicatedDeserializers.Append(Cur->PredicatedDeserializers);
+		FlattenSliceable(SliceableUClasses, UClassDeserializerMap, Cur->SliceableUClasses);
+		FlattenSliceable(SliceableFieldClasses, FieldClassDeserializerMap, Cur->SliceableFieldClasses);
+		FlattenHandlers(UClassDeserializerMap, Cur->UClassDeserializerMap);
+		FlattenHandlers(FieldClassDeserializerMap, Cur->FieldClassDeserializerMap);
+		FlattenHandlers(StructDeserializeMap, Cur->StructDeserializeMap);
+	}
+
+	PredicatedDeserializers.Shrink();
+	Parent = nullptr;
+	bFrozen = true;
+}
+
@@ -16,6 +16,27 @@
 #include "UObject/PropertyOptional.h"
 #endif // !UE_VERSION_OLDER_THAN(5, 4, 0)
 
+namespace DcDeserializerSetupDetails
+{
+
+template<typename TEnum, TEnum Type, void(*FuncSetup)(FDcDeserializer&, TEnum)>
+static FDcDeserializer& GetShared()
+{
+	//	function local statics are initialized exactly once even with concurrent calls
+	static FDcDeserializer Shared;
+	static bool bInitialized = []
+	{
+		FuncSetup(Shared, Type);
+		Shared.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
+
+	return Shared;
+}
+
+} // namespace DcDeserializerSetupDetails
+
 void DcSetupJsonDeserializeHandlers(FDcDeserializer& Deserializer, EDcJsonDeserializeType Type)
 {
 	using namespace DcCommonHandlers;
@@ -51,16 +72,16 @@ void DcSetupJsonDeserializeHandlers(FDcDeserializer& Deserializer, EDcJsonDeseri
 	Deserializer.AddDirectHandler(FFieldPathProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerStringToFieldPathDeserialize));
 
 	//	Containers
-	Deserializer.AddDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize));
-	Deserializer.AddDirectHandler(FSetProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayToSetDeserialize));
+	Deserializer.AddSliceableDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize));
+	Deserializer.AddSliceableDirectHandler(FSetProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayToSetDeserialize));
 	Deserializer.AddDirectHandler(FMapProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapOrArrayOfKeyValueDeserialize));
 
 	//	Struct
-	Deserializer.AddDirectHandler(UScriptStruct::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
-	Deserializer.AddDirectHandler(FStructProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
+	Deserializer.AddSliceableDirectHandler(UScriptStruct::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
+	Deserializer.AddSliceableDirectHandler(FStructProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
 
 	//	Class
-	Deserializer.AddDirectHandler(UClass::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToClassDeserialize));
+	Deserializer.AddSliceableDirectHandler(UClass::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToClassDeserialize));
 
 	//	Object
 	Deserializer.AddDirectHandler(FObjectProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerObjectReferenceDeserialize));
@@ -148,8 +169,8 @@ void DcSetupMsgPackDeserializeHandlers(FDcDeserializer& Deserializer, EDcMsgPack
 	Deserializer.AddDirectHandler(FStrProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeStringDeserialize));
 
 	//	Containers
-	Deserializer.AddDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize));
-	Deserializer.AddDirectHandler(FSetProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayToSetDeserialize));
+	Deserializer.AddSliceableDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize));
+	Deserializer.AddSliceableDirectHandler(FSetProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayToSetDeserialize));
 	Deserializer.AddDirectHandler(FMapProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(DcMsgPackHandlers::HandlerMapDeserialize));
 
 #if !UE_VERSION_OLDER_THAN(5, 4, 0)
@@ -157,11 +178,11 @@ void DcSetupMsgPackDeserializeHandlers(FDcDeserializer& Deserializer, EDcMsgPack
 #endif // !UE_VERSION_OLDER_THAN(5, 4, 0)
 
 	//	Struct
-	Deserializer.AddDirectHandler(UScriptStruct::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
-	Deserializer.AddDirectHandler(FStructProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
+	Deserializer.AddSliceableDirectHandler(UScriptStruct::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
+	Deserializer.AddSliceableDirectHandler(FStructProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
 
 	//	Class
-	Deserializer.AddDirectHandler(UClass::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToClassDeserialize));
+	Deserializer.AddSliceableDirectHandler(UClass::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToClassDeserialize));
 
 	//	Blob
 	Deserializer.AddPredicatedHandler(
@@ -331,3 +352,36 @@ void DcSetupCoreTypesDeserializeHandlers(FDcDeserializer& Deserializer)
 #endif // ENGINE_MAJOR_VERSION == 5
 
 }
+
+FDcDeserializer& DcGetSharedJsonDeserializer(EDcJsonDeserializeType Type)
+{
+	using namespace DcDeserializerSetupDetails;
+	switch (Type)
+	{
+		case EDcJsonDeserializeType::Default:
+			return GetShared<EDcJsonDeserializeType, EDcJsonDeserializeType::Default, DcSetupJsonDeserializeHandlers>();
+		case EDcJsonDeserializeType::StringSoftLazy:
+			return GetShared<EDcJsonDeserializeType, EDcJsonDeserializeType::StringSoftLazy, DcSetupJsonDeserializeHandlers>();
+		default:
+			checkNoEntry();
+			return GetShared<EDcJsonDeserializeType, EDcJsonDeserializeType::Default, DcSetupJsonDeserializeHandlers>();
+	}
+}
+
+FDcDeserializer& DcGetSharedMsgPackDeserializer(EDcMsgPackDeserializeType Type)
+{
+	using namespace DcDeserializerSetupDetails;
+	switch (Type)
+	{
+		case EDcMsgPackDeserializeType::Default:
+			return GetShared<EDcMsgPackDeserializeType, EDcMsgPackDeserializeType::Default, DcSetupMsgPackDeserializeHandlers>();
+		case EDcMsgPackDeserializeType::StringSoftLazy:
+			return GetShared<EDcMsgPackDeserializeType, EDcMsgPackDeserializeType::StringSoftLazy, DcSetupMsgPackDeserializeHandlers>();
+		case EDcMsgPackDeserializeType::InMemory:
+			return GetShared<EDcMsgPackDeserializeType, EDcMsgPackDeserializeType::InMemory, DcSetupMsgPackDeserializeHandlers>();
+		default:
+			checkNoEntry();
+			return GetShared<EDcMsgPackDeserializeType, EDcMsgPackDeserializeType::Default, DcSetupMsgPackDeserializeHandlers>();
+	}
+}
+
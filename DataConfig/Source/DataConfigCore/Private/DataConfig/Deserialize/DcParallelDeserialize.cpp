@@ -0,0 +1,166 @@
+#include "DataConfig/Deserialize/DcParallelDeserialize.h"
+#include "DataConfig/DcEnv.h"
+#include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/Deserialize/DcDeserializeTypes.h"
+#include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
+#include "DataConfig/Property/DcPropertyWriter.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Templates/Atomic.h"
+
+namespace DcParallelDeserializeDetails
+{
+
+struct FTaskResult
+{
+	int32 FailedItemIx = INDEX_NONE;
+	//	diagnostics of all items run by the task in item order, warnings included
+	TArray<FDcDiagnostic> Diagnostics;
+	TArray<int32> DiagnosticItemIxs;
+
+	void CollectDiags(FDcEnv& Env, int32 ItemIx)
+	{
+		for (FDcDiagnostic& Diag : Env.Diagnostics)
+		{
+			Diagnostics.Add(MoveTemp(Diag));
+			DiagnosticItemIxs.Add(ItemIx);
+		}
+		Env.Diagnostics.Reset();
+	}
+};
+
+template<typename CharType>
+static FDcResult DeserializeJsonArray(
+	FDcDeserializer* Deserializer,
+	const TDcJsonTape<CharType>& Tape,
+	FDcPropertyDatum ArrayDatum,
+	TFunctionRef<void(FDcDeserializeContext&)> SetupContext,
+	int32 MinItemsPerTask)
+{
+	check(Deserializer);
+	FArrayProperty* ArrayProperty = ArrayDatum.CastField<FArrayProperty>();
+	if (!ArrayProperty)
+		return DC_FAIL(DcDReadWrite, PropertyMismatch)
+			<< TEXT("ArrayProperty") << ArrayDatum.Property.GetFName() << ArrayDatum.Property.GetClassName();
+
+	//	root is checked by a reader for proper diagnostics
+	{
+		TDcJsonTapeReader<CharType> RootReader(&Tape);
+		DC_TRY(RootReader.ReadArrayRoot());
+	}
+
+	TArray<int32> ItemIxs;
+	Tape.GetArrayItems(0, ItemIxs);
+	int32 Num = ItemIxs.Num();
+
+	FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayDatum.DataPtr);
+	ArrayHelper.EmptyAndAddValues(Num);
+	if (Num == 0)
+		return DcOk();
+
+	//	a few tasks per worker so uneven items still balance out
+	int32 WorkerCount = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	int32 ItemsPerTask = FMath::Max(FMath::Max(MinItemsPerTask, 1), FMath::DivideAndRoundUp(Num, WorkerCount * 4));
+	int32 TaskCount = FMath::DivideAndRoundUp(Num, ItemsPerTask);
+
+	TArray<FTaskResult> TaskResults;
+	TaskResults.SetNum(TaskCount);
+
+	//	lowest failed item index, items past it are skipped while the ones before still run,
+	//	so the reported item doesn't depend on scheduling
+	TAtomic<int32> FirstFailedIx(MAX_int32);
+	bool bExpectFail = DcEnv().bExpectFail;
+
+	ParallelFor(TaskCount, [&](int32 TaskIx)
+	{
+		FDcScopedThreadEnv ThreadEnv;
+		ThreadEnv.Env.bExpectFail = bExpectFail;
+
+		int32 Begin = TaskIx * ItemsPerTask;
+		int32 End = FMath::Min(Begin + ItemsPerTask, Num);
+		for (int32 Ix = Begin; Ix < End; Ix++)
+		{
+			if (Ix > FirstFailedIx.Load(EMemoryOrder::Relaxed))
+				return;
+
+			TDcJsonTapeReader<CharType> Reader(&Tape, ItemIxs[Ix]);
+			FDcPropertyWriter Writer(FDcPropertyDatum(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Ix)));
+
+			FDcDeserializeContext Ctx;
+			Ctx.Reader = &Reader;
+			Ctx.Writer = &Writer;
+			Ctx.Deserializer = Deserializer;
+			SetupContext(Ctx);
+
+			FDcResult Result = Ctx.Prepare();
+			if (Result.Ok())
+				Result = Deserializer->Deserialize(Ctx);
+
+			TaskResults[TaskIx].CollectDiags(ThreadEnv.Env, Ix);
+			if (!Result.Ok())
+			{
+				TaskResults[TaskIx].FailedItemIx = Ix;
+
+				int32 Prev = FirstFailedIx.Load();
+				while (Ix < Prev && !FirstFailedIx.CompareExchange(Prev, Ix))
+				{
+					/*pass*/
+				}
+				return;
+			}
+		}
+	});
+
+	//	merge into caller env in item order, up to the failed item so output doesn't depend on scheduling
+	int32 FailedIx = FirstFailedIx.Load();
+	FDcEnv& Env = DcEnv();
+	int32 FailedItemDiagCount = 0;
+	for (FTaskResult& TaskResult : TaskResults)
+	{
+		for (int32 DiagIx = 0; DiagIx < TaskResult.Diagnostics.Num(); DiagIx++)
+		{
+			int32 ItemIx = TaskResult.DiagnosticItemIxs[DiagIx];
+			if (ItemIx > FailedIx)
+				break;
+
+			Env.Diagnostics.Add(MoveTemp(TaskResult.Diagnostics[DiagIx]));
+			if (ItemIx == FailedIx)
+				FailedItemDiagCount++;
+		}
+	}
+
+	if (FailedIx == MAX_int32)
+		return DcOk();
+
+	if (FailedItemDiagCount == 0)
+		return DcFail();
+
+	FDcDiagnosticHighlight Highlight(nullptr, TEXT("DcParallelDeserialize"));
+	Highlight.Formatted = FString::Printf(TEXT("Array item: %d"), FailedIx);
+	FDcDiagnostic& Diag = Env.GetLastDiag();
+	Diag << MoveTemp(Highlight);
+	return Diag;
+}
+
+} // namespace DcParallelDeserializeDetails
+
+FDcResult DcParallelDeserializeJsonArray(
+	FDcDeserializer* Deserializer,
+	const FDcWideJsonTape& Tape,
+	FDcPropertyDatum ArrayDatum,
+	TFunctionRef<void(FDcDeserializeContext&)> SetupContext,
+	int32 MinItemsPerTask)
+{
+	return DcParallelDeserializeDetails::DeserializeJsonArray(Deserializer, Tape, ArrayDatum, SetupContext, MinItemsPerTask);
+}
+
+FDcResult DcParallelDeserializeJsonArray(
+	FDcDeserializer* Deserializer,
+	const FDcAnsiJsonTape& Tape,
+	FDcPropertyDatum ArrayDatum,
+	TFunctionRef<void(FDcDeserializeContext&)> SetupContext,
+	int32 MinItemsPerTask)
+{
+	return DcParallelDeserializeDetails::DeserializeJsonArray(Deserializer, Tape, ArrayDatum, SetupContext, MinItemsPerTask);
+}
+
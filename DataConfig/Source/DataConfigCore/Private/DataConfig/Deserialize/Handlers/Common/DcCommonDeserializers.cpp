@@ -4,6 +4,7 @@
 #include "DataConfig/Deserialize/DcDeserializer.h"
 #include "DataConfig/Deserialize/DcDeserializeUtils.h"
 #include "DataConfig/SerDe/DcSerDeCommon.inl"
+#include "DataConfig/SerDe/DcSerDeEnumLookup.h"
 #include "DataConfig/SerDe/DcSerDeUtils.inl"
 
 namespace DcCommonHandlers {
@@ -89,33 +90,18 @@ FDcResult HandlerStringToEnumDeserialize(FDcDeserializeContext& Ctx)
 		return DcOk();
 	}
 
-	bool bIsBitFlags;
-
-#if WITH_EDITORONLY_DATA
-
-	#if WITH_METADATA
-	bIsBitFlags = Enum->HasMetaData(TEXT("Bitflags"));
-	#else
-	//	Program target is missing `UEnum::HasMetaData`
-	bIsBitFlags = ((UField*)Enum)->HasMetaData(TEXT("Bitflags"));
-	#endif
-
-#else // WITH_EDITORONLY_DATA
-	bIsBitFlags = false;
-#endif // WITH_EDITORONLY_DATA
-
-
-	if (!bIsBitFlags)
+	FDcEnumLookupRef Lookup = DcSerDeUtils::FindOrBuildEnumLookup(Enum);
+	if (!Lookup->bIsBitFlags)
 	{
 		FString Value;
 		DC_TRY(Ctx.Reader->ReadString(&Value));
 
-		FName ValueName(Enum->GenerateFullEnumName(*Value));
-		if (!Enum->IsValidEnumName(ValueName))
+		int Index = Lookup->FindIndexByName(Value);
+		if (Index == INDEX_NONE)
 			return DC_FAIL(DcDReadWrite, EnumNameNotFound) << Enum->GetFName() << Value;
 
 		FDcEnumData EnumData;
-		EnumData.Signed64 = Enum->GetValueByName(ValueName);
+		EnumData.Signed64 = Lookup->Values[Index];
 
 		DC_TRY(Ctx.Writer->WriteEnum(EnumData));
 		return DcOk();
@@ -136,11 +122,11 @@ FDcResult HandlerStringToEnumDeserialize(FDcDeserializeContext& Ctx)
 			FString Value;
 			DC_TRY(Ctx.Reader->ReadString(&Value));
 
-			FName ValueName(Enum->GenerateFullEnumName(*Value));
-			if (!Enum->IsValidEnumName(ValueName))
+			int Index = Lookup->FindIndexByName(Value);
+			if (Index == INDEX_NONE)
 				return DC_FAIL(DcDReadWrite, EnumNameNotFound) << Enum->GetFName() << Value;
 
-			EnumData.Signed64 |= Enum->GetValueByName(ValueName);
+			EnumData.Signed64 |= Lookup->Values[Index];
 		}
 		DC_TRY(Ctx.Reader->ReadArrayEnd());
 		DC_TRY(Ctx.Writer->WriteEnum(EnumData));
@@ -176,7 +162,11 @@ FDcResult HandlerMapToStructDeserialize(FDcDeserializeContext& Ctx)
 
 		FName FieldName;
 		DC_TRY(Ctx.Reader->ReadName(&FieldName));
-		DC_TRY(Ctx.Writer->WriteName(FieldName));
+
+		bool bSkipped;
+		DC_TRY(DcDeserializeUtils::WriteFieldNameOrSkip(Ctx, Ctx.Reader, FieldName, &bSkipped));
+		if (bSkipped)
+			continue;
 
 		DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
 	}
@@ -208,12 +198,15 @@ FDcResult HandlerMapToClassDeserialize(FDcDeserializeContext& Ctx)
 			if (DcSerDeUtils::IsMeta(Value))
 			{
 				//	skip next object
-				DC_TRY(DcSerDeUtils::ReadNoopConsumeValue(Ctx.Reader));
+				DC_TRY(Ctx.Reader->SkipValue());
 				continue;
 			}
 			else
 			{
-				DC_TRY(Ctx.Writer->WriteName(FName(*Value)));
+				bool bSkipped;
+				DC_TRY(DcDeserializeUtils::WriteFieldNameOrSkip(Ctx, Ctx.Reader, FName(*Value), &bSkipped));
+				if (bSkipped)
+					continue;
 			}
 		}
 		else
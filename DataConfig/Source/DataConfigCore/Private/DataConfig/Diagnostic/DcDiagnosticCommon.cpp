@@ -15,6 +15,9 @@ static FDcDiagnosticDetail _CommonDetails[] = {
 	{ StaleDelegateWithName, TEXT("Stale delegate: {0}") },
 
 	{ CustomMessage, TEXT("Custom Diagnostic Message: {0}") },
+
+	{ FileOpenFailed, TEXT("Failed to open file: '{0}'") },
+	{ FileReadFailed, TEXT("Failed to read file: '{0}'") },
 };
 
 FDcDiagnosticGroup Details = {
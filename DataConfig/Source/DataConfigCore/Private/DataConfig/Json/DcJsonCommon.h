@@ -0,0 +1,180 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+#include "DataConfig/Source/DcSourceTypes.h"
+#include "DataConfig/Source/DcSourceUtils.h"
+#include "DataConfig/Misc/DcTypeUtils.h"
+
+///	Token decoding shared by `TDcJsonReader` and `TDcJsonTapeReader`
+
+namespace DcJsonCommon
+{
+
+template<typename CharType>
+struct TNumericDispatch
+{
+	using CString = TCString<CharType>;
+
+	static FORCEINLINE void ParseIntDispatch(int8& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
+	static FORCEINLINE void ParseIntDispatch(int16& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
+	static FORCEINLINE void ParseIntDispatch(int32& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
+	static FORCEINLINE void ParseIntDispatch(int64& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi64(Ptr, OutEnd, 10); }
+
+	static FORCEINLINE void ParseIntDispatch(uint8& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
+	static FORCEINLINE void ParseIntDispatch(uint16& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
+	static FORCEINLINE void ParseIntDispatch(uint32& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
+	static FORCEINLINE void ParseIntDispatch(uint64& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
+
+	static FORCEINLINE void ParseFloatDispatch(float& OutValue, const CharType* Ptr) { OutValue = CString::Atof(Ptr); }
+	static FORCEINLINE void ParseFloatDispatch(double& OutValue, const CharType* Ptr) { OutValue = CString::Atod(Ptr); }
+
+};
+
+template<typename ETokenType>
+static FORCEINLINE EDcDataEntry TokenTypeToDataEntry(ETokenType TokenType)
+{
+	static EDcDataEntry _Mapping[(int)ETokenType::_Count] = {
+		EDcDataEntry::Ended,
+		EDcDataEntry::None,
+		EDcDataEntry::MapRoot,
+		EDcDataEntry::MapEnd,
+		EDcDataEntry::ArrayRoot,
+		EDcDataEntry::ArrayEnd,
+		EDcDataEntry::None,
+		EDcDataEntry::String,
+		EDcDataEntry::Double,
+		EDcDataEntry::Bool,
+		EDcDataEntry::Bool,
+		EDcDataEntry::None,
+
+		EDcDataEntry::None,
+		EDcDataEntry::None,
+		EDcDataEntry::None,
+	};
+
+	return _Mapping[(int)TokenType];
+}
+
+///	`Ref` is the number token, `IntLen` is length before the decimal point. Fails on trailing chars
+template<typename CharType, typename TInt>
+static bool ParseInteger(const TDcSourceRef<CharType>& Ref, int IntLen, TInt& OutValue)
+{
+	const CharType* BeginPtr = Ref.GetBeginPtr();
+	CharType* EndPtr = nullptr;
+
+	TNumericDispatch<CharType>::ParseIntDispatch(OutValue, &EndPtr, BeginPtr);
+	return EndPtr - BeginPtr == IntLen;
+}
+
+template<typename CharType>
+static FString ConvertStringLiteral(const TDcSourceRef<CharType>& Ref, bool bHasNonAscii)
+{
+	if (DcTypeUtils::TIsSame<CharType, ANSICHAR>::Value
+		&& bHasNonAscii)
+	{
+		//	UTF8 conv when detects non ascii chars
+		FUTF8ToTCHAR UTF8Conv((const ANSICHAR*)Ref.GetBeginPtr(), Ref.Num);
+		return FString(UTF8Conv.Length(), UTF8Conv.Get());
+	}
+	else
+	{
+		return Ref.CharsToString();
+	}
+}
+
+///	Unescape quoted string contents, returns false on invalid escaping
+inline bool UnescapeString(const FString& InStr, FString& OutStr)
+{
+	OutStr.Reserve(InStr.Len() + 1);
+
+	int _StrIx = 0;
+	auto _GetCh = [&InStr, &_StrIx]()
+	{
+		return _StrIx < InStr.Len()
+			? InStr[_StrIx++]
+			: '\0';
+	};
+
+	bool bHasUnicodeEscapes = false;
+	while (true)
+	{
+		TCHAR Ch = _GetCh();
+		if (Ch == '\0')
+			break;
+
+		switch (Ch)
+		{
+			case '\\':
+			{
+				switch (_GetCh())
+				{
+					case '\"': OutStr.AppendChar('"'); break;
+					case '\\': OutStr.AppendChar('\\'); break;
+					case '/': OutStr.AppendChar('/'); break;
+					case 'b': OutStr.AppendChar('\b'); break;
+					case 'f': OutStr.AppendChar('\f'); break;
+					case 'n': OutStr.AppendChar('\n'); break;
+					case 'r': OutStr.AppendChar('\r'); break;
+					case 't': OutStr.AppendChar('\t'); break;
+
+					case 'u':
+					{
+						bHasUnicodeEscapes = true;
+						int CodePoint = 0;
+						for (int Ix = 0; Ix < 4; Ix++)
+						{
+							TCHAR Hex = _GetCh();
+							if (Hex == '\0'
+								|| !TDcCSourceUtils<TCHAR>::IsHexDigit(Hex))
+								return false;
+
+							CodePoint += FParse::HexDigit(Hex) << ((3 - Ix) * 4);
+						}
+
+						OutStr.AppendChar(TCHAR(CodePoint));
+						break;
+					}
+
+					default:
+						return false;
+				}
+				break;
+			}
+
+			default:
+			{
+				OutStr.AppendChar(Ch);
+				break;
+			}
+		}
+	}
+
+	if (bHasUnicodeEscapes)
+		StringConv::InlineCombineSurrogates(OutStr);
+
+	return true;
+}
+
+///	Decode a quoted string token, returns false on invalid escaping
+template<typename CharType>
+static bool ParseStringToken(TDcSourceRef<CharType> Ref, bool bHasEscapeChar, bool bHasNonAscii, FString& OutStr)
+{
+	TDcSourceRef<CharType> UnquotedRef = Ref;
+	UnquotedRef.Begin += 1;
+	UnquotedRef.Num -= 2;
+
+	if (!bHasEscapeChar)
+	{
+		OutStr = ConvertStringLiteral(UnquotedRef, bHasNonAscii);
+		return true;
+	}
+	else
+	{
+		FString UnquotedStr = ConvertStringLiteral(UnquotedRef, bHasNonAscii);
+		return UnescapeString(UnquotedStr, OutStr);
+	}
+}
+
+} // namespace DcJsonCommon
+
@@ -1,5 +1,8 @@
 #include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/Json/DcJsonCommon.h"
 #include "DataConfig/DcEnv.h"
+#include "DataConfig/DcStats.h"
+#include "DataConfig/DcTrace.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
 #include "DataConfig/Diagnostic/DcDiagnosticJSON.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
@@ -9,26 +12,6 @@
 namespace DcJsonReaderDetails
 {
 
-template<typename CharType>
-struct TNumericDispatch
-{
-	using CString = TCString<CharType>;
-
-	static FORCEINLINE void ParseIntDispatch(int8& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(int16& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(int32& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(int64& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi64(Ptr, OutEnd, 10); }
-
-	static FORCEINLINE void ParseIntDispatch(uint8& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(uint16& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(uint32& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(uint64& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
-
-	static FORCEINLINE void ParseFloatDispatch(float& OutValue, const CharType* Ptr) { OutValue = CString::Atof(Ptr); }
-	static FORCEINLINE void ParseFloatDispatch(double& OutValue, const CharType* Ptr) { OutValue = CString::Atod(Ptr); }
-
-};
-
 template<typename CharType>
 struct TJsonReaderClassIdSelector;
 template<> struct TJsonReaderClassIdSelector<ANSICHAR> { static constexpr const TCHAR* Id = TEXT("AnsiCharDcJsonReader"); };
@@ -44,106 +27,9 @@ struct FDcJsonReaderDetails
 using TSelf = TDcJsonReader<CharType>;
 using ETokenType = typename TSelf::ETokenType;
 
-static FDcResult ParseQuotedString(TSelf* Self, const FString& InStr, FString& OutStr)
-{
-	OutStr.Reserve(InStr.Len() + 1);
-
-	int _StrIx = 0;
-	auto _GetCh = [&InStr, &_StrIx]()
-	{
-		return _StrIx < InStr.Len()
-			? InStr[_StrIx++]
-			: '\0';
-	};
-
-	auto _Fail = [Self, _StrIx]()
-	{
-		return DC_FAIL(DcDJSON, InvalidStringEscaping)
-			<< Self->FormatHighlight(Self->Token.Ref.Begin, _StrIx);
-	};
-
-	bool bHasUnicodeEscapes = false;
-	while (true)
-	{
-		TCHAR Ch = _GetCh();
-		if (Ch == '\0')
-			break;
-
-		switch (Ch)
-		{
-			case '\\':
-			{
-				switch (_GetCh())
-				{
-					case '\"': OutStr.AppendChar('"'); break;
-					case '\\': OutStr.AppendChar('\\'); break;
-					case '/': OutStr.AppendChar('/'); break;
-					case 'b': OutStr.AppendChar('\b'); break;
-					case 'f': OutStr.AppendChar('\f'); break;
-					case 'n': OutStr.AppendChar('\n'); break;
-					case 'r': OutStr.AppendChar('\r'); break;
-					case 't': OutStr.AppendChar('\t'); break;
-
-					case 'u':
-					{
-						bHasUnicodeEscapes = true;
-						int CodePoint = 0;
-						for (int Ix = 0; Ix < 4; Ix++)
-						{
-							TCHAR Hex = _GetCh();
-							if (Hex == '\0'
-								|| !TSelf::SourceUtils::IsHexDigit(Hex))
-								return _Fail();
-
-							CodePoint += FParse::HexDigit(Hex) << ((3 - Ix) * 4);
-						}
-
-						OutStr.AppendChar(TCHAR(CodePoint));
-						break;
-					}
-
-					default:
-						return _Fail();
-				}
-				break;
-			}
-
-			default:
-			{
-				OutStr.AppendChar(Ch);
-				break;
-			}
-		}
-	}
-
-	if (bHasUnicodeEscapes)
-		StringConv::InlineCombineSurrogates(OutStr);
-
-	return DcOk();
-}
-
 static FORCEINLINE EDcDataEntry TokenTypeToDataEntry(ETokenType TokenType)
 {
-	static EDcDataEntry _Mapping[(int)ETokenType::_Count] = {
-		EDcDataEntry::Ended,
-		EDcDataEntry::None,
-		EDcDataEntry::MapRoot,
-		EDcDataEntry::MapEnd,
-		EDcDataEntry::ArrayRoot,
-		EDcDataEntry::ArrayEnd,
-		EDcDataEntry::None,
-		EDcDataEntry::String,
-		EDcDataEntry::Double,
-		EDcDataEntry::Bool,
-		EDcDataEntry::Bool,
-		EDcDataEntry::None,
-
-		EDcDataEntry::None,
-		EDcDataEntry::None,
-		EDcDataEntry::None,
-	};
-
-	return _Mapping[(int)TokenType];
+	return DcJsonCommon::TokenTypeToDataEntry(TokenType);
 }
 
 static bool CheckCoercionRule(TSelf* Self, EDcDataEntry ToEntry)
@@ -168,12 +54,9 @@ static FDcResult ParseInteger(TSelf* Self, TInt* OutPtr)
 	int IntOffset = Self->Token.Flag.bNumberHasDecimal
 		? Self->Token.Flag.NumberDecimalOffset
 		: Self->Token.Ref.Num;
-	const CharType* BeginPtr = Self->Token.Ref.GetBeginPtr();
-	CharType* EndPtr = nullptr;
 
 	TInt Value;
-	DcJsonReaderDetails::TNumericDispatch<CharType>::ParseIntDispatch(Value, &EndPtr, BeginPtr);
-	if (EndPtr - BeginPtr != IntOffset)
+	if (!DcJsonCommon::ParseInteger(Self->Token.Ref, IntOffset, Value))
 		return DC_FAIL(DcDJSON, ParseIntegerFailed) << Self->FormatHighlight(Self->Token.Ref);
 
 	ReadOut(OutPtr, Value);
@@ -230,7 +113,7 @@ static FDcResult ReadFloating(TSelf* Self, TFloat* OutPtr)
 		DC_TRY(Self->CheckNotObjectKey());
 
 		TFloat Value;
-		DcJsonReaderDetails::TNumericDispatch<CharType>::ParseFloatDispatch(Value, Self->Token.Ref.GetBeginPtr());
+		DcJsonCommon::TNumericDispatch<CharType>::ParseFloatDispatch(Value, Self->Token.Ref.GetBeginPtr());
 
 		ReadOut(OutPtr, Value);
 		DC_TRY(Self->EndTopRead());
@@ -466,6 +349,7 @@ FDcResult TDcJsonReader<CharType>::ReadName(FName* OutPtr)
 		if (ParsedStr.Len() >= NAME_SIZE)
 			return DC_FAIL(DcDReadWrite, FNameOverSize);
 
+		DC_STATS_ADD(Stats, NamesCreated, 1);
 		ReadOut(OutPtr, FName(ParsedStr));
 
 		DC_TRY(EndTopRead());
@@ -491,12 +375,14 @@ FDcResult TDcJsonReader<CharType>::ReadString(FString* OutPtr)
 		if (IsAtObjectKey())
 			DC_TRY(CheckObjectDuplicatedKey(ParsedStr));
 
+		DC_STATS_ADD(Stats, StringsCreated, 1);
 		ReadOut(OutPtr, MoveTemp(ParsedStr));
 		DC_TRY(EndTopRead());
 		return DcOk();
 	}
 	else if (Token.Type == ETokenType::Number)
 	{
+		DC_STATS_ADD(Stats, StringsCreated, 1);
 		ReadOut(OutPtr, Token.Ref.CharsToString());
 		DC_TRY(EndTopRead());
 		return DcOk();
@@ -594,17 +480,7 @@ FDcResult TDcJsonReader<CharType>::ReadStringToken()
 template <typename CharType>
 FString TDcJsonReader<CharType>::ConvertStringTokenToLiteral(SourceRef Ref)
 {
-	if (DcTypeUtils::TIsSame<CharType, ANSICHAR>::Value
-		&& Token.Flag.bStringHasNonAscii)
-	{
-		//	UTF8 conv when detects non ascii chars
-		FUTF8ToTCHAR UTF8Conv((const ANSICHAR*)Ref.GetBeginPtr(), Ref.Num);
-		return FString(UTF8Conv.Length(), UTF8Conv.Get());
-	}
-	else
-	{
-		return Ref.CharsToString();
-	}
+	return DcJsonCommon::ConvertStringLiteral(Ref, Token.Flag.bStringHasNonAscii);
 }
 
 template <typename CharType>
@@ -618,20 +494,10 @@ FDcResult TDcJsonReader<CharType>::ParseStringToken(FString &OutStr)
 {
 	check(Token.Type == ETokenType::String);
 
-	SourceRef UnquotedRef = Token.Ref;
-	UnquotedRef.Begin += 1;
-	UnquotedRef.Num -= 2;
+	if (!DcJsonCommon::ParseStringToken(Token.Ref, Token.Flag.bStringHasEscapeChar, Token.Flag.bStringHasNonAscii, OutStr))
+		return DC_FAIL(DcDJSON, InvalidStringEscaping) << FormatHighlight(Token.Ref);
 
-	if (!Token.Flag.bStringHasEscapeChar)
-	{
-		OutStr = ConvertStringTokenToLiteral(UnquotedRef);
-		return DcOk();
-	}
-	else
-	{
-		FString UnquotedStr = ConvertStringTokenToLiteral(UnquotedRef);
-		return FDcJsonReaderDetails<CharType>::ParseQuotedString(this, UnquotedStr, OutStr);
-	}
+	return DcOk();
 }
 
 template<typename CharType>
@@ -929,6 +795,7 @@ FDcResult TDcJsonReader<CharType>::CheckConsumeToken(EDcDataEntry Expect)
 				<< FormatHighlight(Token.Ref);
 	}
 
+	DC_STATS_ENTRY(Stats, Expect);
 	//	setting need consume token for the next one when not at end
 	bNeedConsumeToken = true;
 	return DcOk();
@@ -1089,6 +956,100 @@ FDcResult TDcJsonReader<CharType>::ReadArrayEnd()
 	}
 }
 
+template<typename CharType>
+FDcResult TDcJsonReader<CharType>::SkipValue()
+{
+	//	keys still go through duplicate check
+	if (IsAtObjectKey())
+		return ReadString(nullptr);
+
+	if (bNeedConsumeToken)
+		DC_TRY(ConsumeEffectiveToken());
+	bNeedConsumeToken = true;
+
+	switch (Token.Type)
+	{
+		case ETokenType::String:
+		case ETokenType::Number:
+		case ETokenType::True:
+		case ETokenType::False:
+		case ETokenType::Null:
+			//	scalar is lexed but not decoded nor parsed
+			return EndTopRead();
+		case ETokenType::CurlyOpen:
+		case ETokenType::SquareOpen:
+			break;
+		default:
+			return DC_FAIL(DcDJSON, UnexpectedToken) << FormatHighlight(Token.Ref);
+	}
+
+	//	scan to the matching close bracket, strings are only checked to be closed
+	check(!CachedNext.IsValid());
+	SourceRef OpenRef = Token.Ref;
+	TArray<CharType, TInlineAllocator<16>> Closes;
+	Closes.Add(Token.Type == ETokenType::CurlyOpen ? CharType('}') : CharType(']'));
+
+	CharType LastClose = CharType('\0');
+	while (Closes.Num())
+	{
+		if (IsAtEnd())
+		{
+			if (Closes.Last() == CharType('}'))
+				return DC_FAIL(DcDJSON, EndUnclosedObject) << FormatHighlight(OpenRef);
+			else
+				return DC_FAIL(DcDJSON, EndUnclosedArray) << FormatHighlight(OpenRef);
+		}
+
+		CharType Char = PeekChar();
+		if (Char == CharType('"'))
+		{
+			DC_TRY(ReadStringToken());
+		}
+		else if (Char == CharType('/'))
+		{
+			CharType NextChar = PeekChar(1);
+			if (NextChar == CharType('/'))
+				ReadLineComment();
+			else if (NextChar == CharType('*'))
+				DC_TRY(ReadBlockComment());
+			else
+				return DC_FAIL(DcDJSON, UnexpectedChar) << Char << FormatHighlight(Cur, 1);
+		}
+		else if (Char == CharType('{'))
+		{
+			Closes.Add(CharType('}'));
+			Advance();
+		}
+		else if (Char == CharType('['))
+		{
+			Closes.Add(CharType(']'));
+			Advance();
+		}
+		else if (Char == CharType('}')
+			|| Char == CharType(']'))
+		{
+			if (Char != Closes.Last())
+				return DC_FAIL(DcDJSON, UnexpectedChar) << Char << FormatHighlight(Cur, 1);
+
+			LastClose = Closes.Pop();
+			Advance();
+		}
+		else
+		{
+			if (SourceUtils::IsLineBreak(Char))
+				NewLine();
+
+			Advance();
+		}
+	}
+
+	Token.Type = LastClose == CharType('}') ? ETokenType::CurlyClose : ETokenType::SquareClose;
+	Token.Ref.Begin = Cur - 1;
+	Token.Ref.Num = 1;
+	Token.Flag.Reset();
+	return EndTopRead();
+}
+
 template<typename CharType> FDcResult TDcJsonReader<CharType>::ReadInt8(int8* OutPtr) { return FDcJsonReaderDetails<CharType>::ReadSignedInteger(this, OutPtr); }
 template<typename CharType> FDcResult TDcJsonReader<CharType>::ReadInt16(int16* OutPtr) { return FDcJsonReaderDetails<CharType>::ReadSignedInteger(this, OutPtr); }
 template<typename CharType> FDcResult TDcJsonReader<CharType>::ReadInt32(int32* OutPtr) { return FDcJsonReaderDetails<CharType>::ReadSignedInteger(this, OutPtr); }
@@ -1214,13 +1175,29 @@ FDcResult TDcJsonReader<CharType>::ConsumeRawToken()
 template<typename CharType>
 FDcResult TDcJsonReader<CharType>::ConsumeEffectiveToken()
 {
+#if DC_TRACE_ENABLED || DC_STATS_ENABLED
+	bool bCountToken = !CachedNext.IsValid();
+	int32 CountBegin = Cur;
+#endif // DC_TRACE_ENABLED || DC_STATS_ENABLED
+
 	while (true)
 	{
 		FDcResult Ret = ConsumeRawToken();
 		if (!Ret.Ok())
 			return Ret;
 		else if (Token.Type < ETokenType::LineComment)
+		{
+#if DC_TRACE_ENABLED || DC_STATS_ENABLED
+			if (bCountToken)
+			{
+				int64 Bytes = (Cur - CountBegin) * sizeof(CharType);
+				DC_TRACE_COUNTER_ADD(DcTokensRead, 1);
+				DC_TRACE_COUNTER_ADD(DcBytesRead, Bytes);
+				DC_STATS_ADD(Stats, BytesConsumed, Bytes);
+			}
+#endif // DC_TRACE_ENABLED || DC_STATS_ENABLED
 			return DcOk();
+		}
 		else
 			continue;
 	}
@@ -1235,6 +1212,7 @@ void TDcJsonReader<CharType>::PutbackToken(const FToken& Putback)
 	check(!CachedNext.IsValid());
 	CachedNext = Token;
 	Token = Putback;
+	DC_STATS_ADD(Stats, Putbacks, 1);
 }
 
 template<typename CharType>
@@ -0,0 +1,637 @@
+#include "DataConfig/Json/DcJsonTape.h"
+#include "DataConfig/Json/DcJsonCommon.h"
+#include "DataConfig/Diagnostic/DcDiagnosticJSON.h"
+#include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
+#include "DataConfig/Source/DcHighlightFormatter.h"
+#include "DataConfig/Misc/DcTypeUtils.h"
+
+namespace DcJsonTapeDetails
+{
+
+template<typename CharType>
+struct TJsonTapeReaderClassIdSelector;
+template<> struct TJsonTapeReaderClassIdSelector<ANSICHAR> { static constexpr const TCHAR* Id = TEXT("AnsiCharDcJsonTapeReader"); };
+template<> struct TJsonTapeReaderClassIdSelector<WIDECHAR> { static constexpr const TCHAR* Id = TEXT("WideCharDcJsonTapeReader"); };
+
+} // namespace DcJsonTapeDetails
+
+template<typename CharType>
+void TDcJsonTape<CharType>::Reset()
+{
+	Buf = SourceView();
+	Entries.Reset();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTape<CharType>::Build(const CharType* InStrPtr, int32 InNum)
+{
+	Reset();
+	Buf = SourceView(InStrPtr, InNum);
+
+	//	lexing and diagnostics are `TDcJsonReader`'s, only structure is checked here
+	Lexer Lex(InStrPtr, InNum);
+	Lex.DiagFilePath = DiagFilePath;
+
+	enum class EExpect : uint8
+	{
+		Value,
+		Key,
+		Colon,
+		CommaOrClose,
+		End,
+	};
+
+	EExpect Expect = EExpect::Value;
+	TArray<int32, TInlineAllocator<16>> Opens;
+
+	auto _IsTopObject = [this, &Opens]
+	{
+		return Opens.Num() && Entries[Opens.Top()].Type == ETokenType::CurlyOpen;
+	};
+
+	auto _IsTopArray = [this, &Opens]
+	{
+		return Opens.Num() && Entries[Opens.Top()].Type == ETokenType::SquareOpen;
+	};
+
+	auto _AddEntry = [this, &Lex]() -> int32
+	{
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Type = Lex.Token.Type;
+		Entry.Begin = Lex.Token.Ref.Begin;
+		Entry.Num = Lex.Token.Ref.Num;
+		Entry.Line = Lex.Loc.Line;
+		Entry.Count = 0;
+
+		//	single char and word tokens don't reset flags
+		if (Entry.Type == ETokenType::String
+			|| Entry.Type == ETokenType::Number)
+			Entry.Flag = Lex.Token.Flag;
+		else
+			Entry.Flag.Reset();
+
+		Entry.Match = Entries.Num() - 1;
+		return Entry.Match;
+	};
+
+	auto _EndValue = [&]()
+	{
+		if (Opens.Num() == 0)
+			Expect = EExpect::End;
+		else
+			Expect = EExpect::CommaOrClose;
+	};
+
+	while (true)
+	{
+		DC_TRY(Lex.ConsumeEffectiveToken());
+		ETokenType Type = Lex.Token.Type;
+
+		if (Type == ETokenType::EOF_)
+		{
+			if (_IsTopObject())
+				return DC_FAIL(DcDJSON, EndUnclosedObject) << Lex.FormatHighlight(Lex.Cur, 0);
+			else if (_IsTopArray())
+				return DC_FAIL(DcDJSON, EndUnclosedArray) << Lex.FormatHighlight(Lex.Cur, 0);
+
+			//	empty document reads as ended, same as the reader
+			return DcOk();
+		}
+
+		switch (Expect)
+		{
+			case EExpect::End:
+			{
+				return DC_FAIL(DcDJSON, UnexpectedTrailingToken)
+					<< DcJsonCommon::TokenTypeToDataEntry(Type)
+					<< Lex.FormatHighlight(Lex.Token.Ref);
+			}
+			case EExpect::Key:
+			{
+				if (Type == ETokenType::String)
+				{
+					_AddEntry();
+					Entries[Opens.Top()].Count++;
+					Expect = EExpect::Colon;
+					continue;
+				}
+				else if (Type != ETokenType::CurlyClose)
+				{
+					return DC_FAIL(DcDJSON, KeyMustBeString) << Lex.FormatHighlight(Lex.Token.Ref);
+				}
+				break;
+			}
+			case EExpect::Colon:
+			{
+				if (Type != ETokenType::Colon)
+					return DC_FAIL(DcDJSON, UnexpectedToken) << Lex.FormatHighlight(Lex.Token.Ref);
+
+				Expect = EExpect::Value;
+				continue;
+			}
+			case EExpect::CommaOrClose:
+			{
+				if (Type == ETokenType::Comma)
+				{
+					//	allowing optional trailing comma
+					Expect = _IsTopObject() ? EExpect::Key : EExpect::Value;
+					continue;
+				}
+				else if (Type != ETokenType::CurlyClose
+					&& Type != ETokenType::SquareClose)
+				{
+					return DC_FAIL(DcDJSON, ExpectComma) << Lex.FormatHighlight(Lex.Token.Ref);
+				}
+				break;
+			}
+			case EExpect::Value:
+			{
+				if (Type == ETokenType::SquareClose
+					&& _IsTopArray())
+					break;
+
+				if (Type != ETokenType::CurlyOpen
+					&& Type != ETokenType::SquareOpen
+					&& Type != ETokenType::String
+					&& Type != ETokenType::Number
+					&& Type != ETokenType::True
+					&& Type != ETokenType::False
+					&& Type != ETokenType::Null)
+					return DC_FAIL(DcDJSON, UnexpectedToken) << Lex.FormatHighlight(Lex.Token.Ref);
+
+				if (_IsTopArray())
+					Entries[Opens.Top()].Count++;
+
+				int32 Ix = _AddEntry();
+				if (Type == ETokenType::CurlyOpen)
+				{
+					Opens.Add(Ix);
+					Expect = EExpect::Key;
+				}
+				else if (Type == ETokenType::SquareOpen)
+				{
+					Opens.Add(Ix);
+					Expect = EExpect::Value;
+				}
+				else
+				{
+					_EndValue();
+				}
+				continue;
+			}
+			default:
+				return DcNoEntry();
+		}
+
+		//	only closes reach here
+		bool bCloseMatch = Type == ETokenType::CurlyClose ? _IsTopObject() : _IsTopArray();
+		if (!bCloseMatch)
+			return DC_FAIL(DcDJSON, UnexpectedToken) << Lex.FormatHighlight(Lex.Token.Ref);
+
+		int32 OpenIx = Opens.Pop();
+		int32 CloseIx = _AddEntry();
+		Entries[CloseIx].Match = OpenIx;
+		Entries[OpenIx].Match = CloseIx;
+		_EndValue();
+	}
+
+	return DcNoEntry();
+}
+
+template<typename CharType>
+void TDcJsonTape<CharType>::GetArrayItems(int32 ArrayIx, TArray<int32>& OutIxs) const
+{
+	check(Entries[ArrayIx].Type == ETokenType::SquareOpen);
+	OutIxs.Reset(Entries[ArrayIx].Count);
+
+	int32 CloseIx = Entries[ArrayIx].Match;
+	for (int32 Ix = ArrayIx + 1; Ix < CloseIx; Ix = GetValueEnd(Ix))
+		OutIxs.Add(Ix);
+}
+
+template<typename CharType>
+struct FDcJsonTapeReaderDetails
+{
+
+using TSelf = TDcJsonTapeReader<CharType>;
+using ETokenType = typename TSelf::ETokenType;
+using FEntry = typename TSelf::FEntry;
+
+static FORCEINLINE const FEntry& CurEntry(TSelf* Self)
+{
+	return Self->Tape->Entries[Self->Cur];
+}
+
+static FORCEINLINE EDcDataEntry CurDataEntry(TSelf* Self)
+{
+	return Self->Cur < Self->End
+		? DcJsonCommon::TokenTypeToDataEntry(CurEntry(Self).Type)
+		: EDcDataEntry::Ended;
+}
+
+static bool CheckCoercionRule(TSelf* Self, EDcDataEntry ToEntry)
+{
+	if (Self->Cur >= Self->End)
+		return false;
+
+	ETokenType Type = CurEntry(Self).Type;
+	if (Type == ETokenType::Number)
+	{
+		return DcTypeUtils::IsNumericDataEntry(ToEntry)
+			|| ToEntry == EDcDataEntry::String;
+	}
+	else if (Type == ETokenType::String)
+	{
+		return ToEntry == EDcDataEntry::Name
+			|| ToEntry == EDcDataEntry::Text;
+	}
+
+	return false;
+}
+
+static FDcResult FailTypeMismatch(TSelf* Self, EDcDataEntry Expect)
+{
+	return DC_FAIL(DcDJSON, ReadTypeMismatch)
+		<< Expect << CurDataEntry(Self)
+		<< Self->FormatHighlight(Self->Cur);
+}
+
+template<typename TInt>
+static FDcResult ReadInteger(TSelf* Self, TInt* OutPtr)
+{
+	DC_TRY(Self->CheckEntry(DcTypeUtils::TDcDataEntryType<TInt>::Value));
+	const FEntry& Entry = CurEntry(Self);
+	if (Entry.Type != ETokenType::Number)
+		return FailTypeMismatch(Self, DcTypeUtils::TDcDataEntryType<TInt>::Value);
+
+	DC_TRY(Self->CheckNotObjectKey());
+	if (TNumericLimits<TInt>::Min() == 0
+		&& Entry.Flag.bNumberIsNegative)
+		return DC_FAIL(DcDJSON, ReadUnsignedWithNegativeNumber) << Self->FormatHighlight(Self->Cur);
+
+	int IntLen = Entry.Flag.bNumberHasDecimal
+		? Entry.Flag.NumberDecimalOffset
+		: Entry.Num;
+
+	TInt Value;
+	if (!DcJsonCommon::ParseInteger(Self->Tape->GetSourceRef(Self->Cur), IntLen, Value))
+		return DC_FAIL(DcDJSON, ParseIntegerFailed) << Self->FormatHighlight(Self->Cur);
+
+	ReadOut(OutPtr, Value);
+	Self->EndValue(Self->Cur + 1);
+	return DcOk();
+}
+
+template<typename TFloat>
+static FDcResult ReadFloating(TSelf* Self, TFloat* OutPtr)
+{
+	DC_TRY(Self->CheckEntry(DcTypeUtils::TDcDataEntryType<TFloat>::Value));
+	if (CurEntry(Self).Type != ETokenType::Number)
+		return FailTypeMismatch(Self, DcTypeUtils::TDcDataEntryType<TFloat>::Value);
+
+	DC_TRY(Self->CheckNotObjectKey());
+
+	TFloat Value;
+	DcJsonCommon::TNumericDispatch<CharType>::ParseFloatDispatch(Value, Self->Tape->GetSourceRef(Self->Cur).GetBeginPtr());
+
+	ReadOut(OutPtr, Value);
+	Self->EndValue(Self->Cur + 1);
+	return DcOk();
+}
+
+}; // struct FDcJsonTapeReaderDetails
+
+template<typename CharType>
+TDcJsonTapeReader<CharType>::TDcJsonTapeReader()
+{
+	States.Add({EParseState::Root, false, INDEX_NONE});
+}
+
+template<typename CharType>
+TDcJsonTapeReader<CharType>::TDcJsonTapeReader(const TTape* InTape, int32 InRootIx)
+	: TDcJsonTapeReader()
+{
+	SetTape(InTape, InRootIx);
+}
+
+template<typename CharType>
+void TDcJsonTapeReader<CharType>::SetTape(const TTape* InTape, int32 InRootIx)
+{
+	check(InTape);
+	Tape = InTape;
+	Cur = InRootIx;
+	End = InRootIx < InTape->Num()
+		? InTape->GetValueEnd(InRootIx)
+		: InRootIx;
+
+	States.Reset();
+	States.Add({EParseState::Root, false, INDEX_NONE});
+	Keys.Reset();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::CheckEntry(EDcDataEntry Expect)
+{
+	EDcDataEntry Actual = FDcJsonTapeReaderDetails<CharType>::CurDataEntry(this);
+	if (Actual != Expect
+		&& !FDcJsonTapeReaderDetails<CharType>::CheckCoercionRule(this, Expect))
+		return DC_FAIL(DcDReadWrite, DataTypeMismatchNoCoercion)
+			<< Expect << Actual
+			<< FormatHighlight(Cur);
+
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::CheckNotObjectKey()
+{
+	if (IsAtObjectKey())
+		return DC_FAIL(DcDJSON, KeyMustBeString) << FormatHighlight(Cur);
+	else
+		return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::CheckObjectDuplicatedKey(const FString& Key)
+{
+	check(Keys.Num() && IsAtObjectKey());
+	if (Keys.Top().Contains(Key))
+		return DC_FAIL(DcDJSON, DuplicatedKey) << Key << FormatHighlight(Cur);
+	else
+		Keys.Top().Add(Key);
+
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ParseStringEntry(FString& OutStr)
+{
+	const FEntry& Entry = Tape->Entries[Cur];
+	check(Entry.Type == ETokenType::String);
+
+	if (!DcJsonCommon::ParseStringToken(Tape->GetSourceRef(Cur), Entry.Flag.bStringHasEscapeChar, Entry.Flag.bStringHasNonAscii, OutStr))
+		return DC_FAIL(DcDJSON, InvalidStringEscaping) << FormatHighlight(Cur);
+
+	if (IsAtObjectKey())
+		DC_TRY(CheckObjectDuplicatedKey(OutStr));
+
+	return DcOk();
+}
+
+template<typename CharType>
+void TDcJsonTapeReader<CharType>::EndValue(int32 NextIx)
+{
+	Cur = NextIx;
+
+	FReadState& TopState = GetTopState();
+	if (TopState.Type == EParseState::Object)
+	{
+		if (TopState.bObjectAtValue)
+			TopState.Remain--;
+
+		TopState.bObjectAtValue = !TopState.bObjectAtValue;
+	}
+	else if (TopState.Type == EParseState::Array)
+	{
+		TopState.Remain--;
+	}
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::Coercion(EDcDataEntry ToEntry, bool* OutPtr)
+{
+	return ReadOutOk(OutPtr, FDcJsonTapeReaderDetails<CharType>::CheckCoercionRule(this, ToEntry));
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::PeekRead(EDcDataEntry* OutPtr)
+{
+	return ReadOutOk(OutPtr, FDcJsonTapeReaderDetails<CharType>::CurDataEntry(this));
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadNone()
+{
+	DC_TRY(CheckEntry(EDcDataEntry::None));
+	if (Tape->Entries[Cur].Type != ETokenType::Null)
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::None);
+
+	DC_TRY(CheckNotObjectKey());
+	EndValue(Cur + 1);
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadBool(bool* OutPtr)
+{
+	DC_TRY(CheckEntry(EDcDataEntry::Bool));
+	ETokenType Type = Tape->Entries[Cur].Type;
+	if (Type != ETokenType::True
+		&& Type != ETokenType::False)
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::Bool);
+
+	DC_TRY(CheckNotObjectKey());
+	ReadOut(OutPtr, Type == ETokenType::True);
+	EndValue(Cur + 1);
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadName(FName* OutPtr)
+{
+	DC_TRY(CheckEntry(EDcDataEntry::Name));
+	if (Tape->Entries[Cur].Type != ETokenType::String)
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::Name);
+
+	FString ParsedStr;
+	DC_TRY(ParseStringEntry(ParsedStr));
+
+	if (ParsedStr.Len() >= NAME_SIZE)
+		return DC_FAIL(DcDReadWrite, FNameOverSize);
+
+	ReadOut(OutPtr, FName(ParsedStr));
+	EndValue(Cur + 1);
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadString(FString* OutPtr)
+{
+	DC_TRY(CheckEntry(EDcDataEntry::String));
+	ETokenType Type = Tape->Entries[Cur].Type;
+	if (Type == ETokenType::String)
+	{
+		FString ParsedStr;
+		DC_TRY(ParseStringEntry(ParsedStr));
+
+		ReadOut(OutPtr, MoveTemp(ParsedStr));
+		EndValue(Cur + 1);
+		return DcOk();
+	}
+	else if (Type == ETokenType::Number)
+	{
+		DC_TRY(CheckNotObjectKey());
+		ReadOut(OutPtr, Tape->GetSourceRef(Cur).CharsToString());
+		EndValue(Cur + 1);
+		return DcOk();
+	}
+	else
+	{
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::String);
+	}
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadText(FText* OutPtr)
+{
+	DC_TRY(CheckEntry(EDcDataEntry::Text));
+	if (Tape->Entries[Cur].Type != ETokenType::String)
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::Text);
+
+	FString ParsedStr;
+	DC_TRY(ParseStringEntry(ParsedStr));
+
+	ReadOut(OutPtr, FText::FromString(MoveTemp(ParsedStr)));
+	EndValue(Cur + 1);
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadMapRoot()
+{
+	DC_TRY(CheckEntry(EDcDataEntry::MapRoot));
+	if (Tape->Entries[Cur].Type != ETokenType::CurlyOpen)
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::MapRoot);
+
+	DC_TRY(CheckNotObjectKey());
+	States.Add({EParseState::Object, false, Tape->Entries[Cur].Count});
+	Keys.AddDefaulted();
+	Cur++;
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadMapEnd()
+{
+	if (GetTopState().Type != EParseState::Object)
+		return DC_FAIL(DcDJSON, UnexpectedToken) << FormatHighlight(Cur);
+
+	DC_TRY(CheckEntry(EDcDataEntry::MapEnd));
+	if (Tape->Entries[Cur].Type != ETokenType::CurlyClose)
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::MapEnd);
+
+	States.Pop();
+	Keys.Pop();
+	EndValue(Cur + 1);
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadArrayRoot()
+{
+	DC_TRY(CheckEntry(EDcDataEntry::ArrayRoot));
+	if (Tape->Entries[Cur].Type != ETokenType::SquareOpen)
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::ArrayRoot);
+
+	DC_TRY(CheckNotObjectKey());
+	States.Add({EParseState::Array, false, Tape->Entries[Cur].Count});
+	Cur++;
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::ReadArrayEnd()
+{
+	if (GetTopState().Type != EParseState::Array)
+		return DC_FAIL(DcDJSON, UnexpectedToken) << FormatHighlight(Cur);
+
+	DC_TRY(CheckEntry(EDcDataEntry::ArrayEnd));
+	if (Tape->Entries[Cur].Type != ETokenType::SquareClose)
+		return FDcJsonTapeReaderDetails<CharType>::FailTypeMismatch(this, EDcDataEntry::ArrayEnd);
+
+	States.Pop();
+	EndValue(Cur + 1);
+	return DcOk();
+}
+
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadInt8(int8* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadInteger(this, OutPtr); }
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadInt16(int16* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadInteger(this, OutPtr); }
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadInt32(int32* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadInteger(this, OutPtr); }
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadInt64(int64* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadInteger(this, OutPtr); }
+
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadUInt8(uint8* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadInteger(this, OutPtr); }
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadUInt16(uint16* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadInteger(this, OutPtr); }
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadUInt32(uint32* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadInteger(this, OutPtr); }
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadUInt64(uint64* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadInteger(this, OutPtr); }
+
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadFloat(float* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadFloating(this, OutPtr); }
+template<typename CharType> FDcResult TDcJsonTapeReader<CharType>::ReadDouble(double* OutPtr) { return FDcJsonTapeReaderDetails<CharType>::ReadFloating(this, OutPtr); }
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::GetContainerSizeHint(int32* OutPtr)
+{
+	return ReadOutOk(OutPtr, GetTopState().Remain);
+}
+
+template<typename CharType>
+FDcResult TDcJsonTapeReader<CharType>::SkipValue()
+{
+	//	keys still go through duplicate check
+	if (IsAtObjectKey())
+		return ReadString(nullptr);
+
+	EDcDataEntry Next = FDcJsonTapeReaderDetails<CharType>::CurDataEntry(this);
+	if (Next == EDcDataEntry::Ended
+		|| Next == EDcDataEntry::MapEnd
+		|| Next == EDcDataEntry::ArrayEnd)
+		return DC_FAIL(DcDJSON, UnexpectedToken) << FormatHighlight(Cur);
+
+	EndValue(Tape->GetValueEnd(Cur));
+	return DcOk();
+}
+
+template<typename CharType>
+FDcDiagnosticHighlight TDcJsonTapeReader<CharType>::FormatHighlight(int32 EntryIx)
+{
+	FDcDiagnosticHighlight OutHighlight(this, ClassId().ToString());
+	if (Tape == nullptr)
+		return OutHighlight;
+
+	//	past the end highlights the last entry
+	int32 Ix = FMath::Min(EntryIx, Tape->Num() - 1);
+	SourceRef SpanRef = Ix >= 0
+		? Tape->GetSourceRef(Ix)
+		: SourceRef{ &Tape->Buf, 0, 0 };
+	int32 Line = Ix >= 0 ? Tape->Entries[Ix].Line : 1;
+
+	OutHighlight.FileContext.Emplace();
+	OutHighlight.FileContext->Loc = FDcSourceLocation{(uint32)Line, 0};
+	OutHighlight.FileContext->FilePath = Tape->DiagFilePath.IsEmpty() ? TEXT("<in-memory>") : Tape->DiagFilePath;
+
+	THightlightFormatter<CharType> Highlighter;
+	OutHighlight.Formatted = Highlighter.FormatHighlight(SpanRef, Line);
+
+	if (OutHighlight.Formatted.IsEmpty())
+		OutHighlight.Formatted = TEXT("<contents empty>");
+
+	return OutHighlight;
+}
+
+template<typename CharType>
+void TDcJsonTapeReader<CharType>::FormatDiagnostic(FDcDiagnostic& Diag)
+{
+	Diag << FormatHighlight(Cur);
+}
+
+template <typename CharType>
+FName TDcJsonTapeReader<CharType>::ClassId() { return FName(DcJsonTapeDetails::TJsonTapeReaderClassIdSelector<CharType>::Id); }
+
+template <typename CharType>
+FName TDcJsonTapeReader<CharType>::GetId() { return ClassId(); }
+
+template struct DATACONFIGCORE_API TDcJsonTape<ANSICHAR>;
+template struct DATACONFIGCORE_API TDcJsonTape<WIDECHAR>;
+
+template struct DATACONFIGCORE_API TDcJsonTapeReader<ANSICHAR>;
+template struct DATACONFIGCORE_API TDcJsonTapeReader<WIDECHAR>;
+
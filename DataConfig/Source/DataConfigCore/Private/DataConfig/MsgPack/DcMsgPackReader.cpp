@@ -1,10 +1,13 @@
 #include "DataConfig/MsgPack/DcMsgPackReader.h"
 #include "DataConfig/MsgPack/DcMsgPackCommon.h"
 #include "DataConfig/DcEnv.h"
+#include "DataConfig/DcStats.h"
+#include "DataConfig/DcTrace.h"
 #include "DataConfig/Diagnostic/DcDiagnosticMsgPack.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Misc/DcTemplateUtils.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
+#include "Hash/CityHash.h"
 
 namespace DcMsgPackReaderDetails
 {
@@ -48,8 +51,18 @@ FORCEINLINE FDcResult ReadN(FDcMsgPackReader* Self, FDcFixedBytes<N>* OutBytes)
 
 FORCEINLINE_DEBUGGABLE FDcResult ReadTypeByte(FDcMsgPackReader* Self, uint8* OutPtr)
 {
+#if DC_TRACE_ENABLED || DC_STATS_ENABLED
+	//	bytes are counted from the last type byte, which covers the previous value's payload
+	int32 Bytes = FMath::Max(0, Self->State.Index - Self->State.CountedIndex);
+	Self->State.CountedIndex = Self->State.Index;
+	DC_TRACE_COUNTER_ADD(DcTokensRead, 1);
+	DC_TRACE_COUNTER_ADD(DcBytesRead, Bytes);
+	DC_STATS_ADD(Self->Stats, BytesConsumed, Bytes);
+#endif // DC_TRACE_ENABLED || DC_STATS_ENABLED
+
 	DC_TRY(Read1(Self, OutPtr));
 	Self->State.LastTypeByte = *OutPtr;
+	DC_STATS_ENTRY(Self->Stats, DcMsgPackCommon::TypeByteToDataEntry(*OutPtr));
 	return DcOk();
 }
 
@@ -167,6 +180,102 @@ FORCEINLINE FDcResult ReadExtDispatch(FDcMsgPackReader* Self, uint8* OutType, FD
 	return EndTopRead(Self);
 }
 
+FORCEINLINE_DEBUGGABLE FDcResult ReadStringSize(FDcMsgPackReader* Self, int32* OutSize)
+{
+	uint8 TypeByte;
+	DC_TRY(ReadTypeByte(Self, &TypeByte));
+	int32 Size;
+	if (TypeByte >= DcMsgPackCommon::MSGPACK_MINFIXSTR && TypeByte <= DcMsgPackCommon::MSGPACK_MAXFIXSTR)
+	{
+		Size = 0b0001'1111 & TypeByte;
+	}
+	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR8)
+	{
+		uint8 Byte;
+		DC_TRY(Read1(Self, &Byte));
+		Size = Byte;
+	}
+	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR16)
+	{
+		FDcBytes2 Bytes;
+		DC_TRY(ReadN(Self, &Bytes));
+		Size = Bytes.As<uint16>();
+	}
+	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR32)
+	{
+		FDcBytes4 Bytes;
+		DC_TRY(ReadN(Self, &Bytes));
+		uint32 USize = Bytes.As<uint32>();
+		if (USize > (uint32)TNumericLimits<int32>::Max())
+			return DC_FAIL(DcDMsgPack, SizeOverInt32Max);
+
+		Size = (int32)USize;
+	}
+	else
+	{
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch)
+			<< EDcDataEntry::String << DcMsgPackCommon::TypeByteToDataEntry(TypeByte);
+	}
+
+	DC_TRY(CheckNoEOF(Self, Size));
+	*OutSize = Size;
+	return DcOk();
+}
+
+FORCEINLINE bool IsAllAscii(const FAnsiStringView& Sv)
+{
+	for (ANSICHAR Ch : Sv)
+	{
+		if ((uint8)Ch & 0x80)
+			return false;
+	}
+	return true;
+}
+
+FORCEINLINE_DEBUGGABLE void UTF8ToString(const FAnsiStringView& Sv, FString& OutStr)
+{
+	int32 Size = Sv.Len();
+	if (Size == 0)
+	{
+		OutStr.Reset();
+	}
+	else if (IsAllAscii(Sv))
+	{
+		//	ASCII widens char by char, skip the converter
+		TArray<TCHAR>& CharArray = OutStr.GetCharArray();
+		CharArray.SetNumUninitialized(Size + 1);
+		for (int32 Ix = 0; Ix < Size; Ix++)
+			CharArray[Ix] = (TCHAR)Sv[Ix];
+		CharArray[Size] = TCHAR('\0');
+	}
+	else
+	{
+		FUTF8ToTCHAR UTF8Conv(Sv.GetData(), Size);
+		OutStr = FString(UTF8Conv.Length(), UTF8Conv.Get());
+	}
+}
+
+FORCEINLINE_DEBUGGABLE FName FindOrAddCachedName(FDcMsgPackReader* Self, const FAnsiStringView& Sv)
+{
+	if (Self->NameCache.Num() == 0)
+		Self->NameCache.SetNum(FDcMsgPackReader::NAME_CACHE_SIZE);
+
+	uint32 Hash = CityHash32(Sv.GetData(), Sv.Len());
+	FDcMsgPackReader::FNameCacheEntry& Entry = Self->NameCache[Hash & (FDcMsgPackReader::NAME_CACHE_SIZE - 1)];
+	if (!Entry.Name.IsNone()
+		&& Entry.Hash == Hash
+		&& Entry.Chars.Num() == Sv.Len()
+		&& FMemory::Memcmp(Entry.Chars.GetData(), Sv.GetData(), Sv.Len()) == 0)
+		return Entry.Name;
+
+	Entry.Hash = Hash;
+	Entry.Chars.Reset();
+	Entry.Chars.Append(Sv.GetData(), Sv.Len());
+	Entry.Name = FName(Sv.Len(), Sv.GetData());
+	DC_STATS_ADD(Self->Stats, NamesCreated, 1);
+	return Entry.Name;
+}
+
 } // namespace DcMsgPackReaderDetails
 
 
@@ -260,67 +369,57 @@ FDcResult FDcMsgPackReader::ReadBool(bool* OutPtr)
 	return DcMsgPackReaderDetails::EndTopRead(this);
 }
 
-FDcResult FDcMsgPackReader::ReadString(FString* OutPtr)
+FDcResult FDcMsgPackReader::ReadStringView(FAnsiStringView* OutPtr)
 {
 	DC_TRY(DcMsgPackReaderDetails::CheckTopStateRemains(this));
 
-	uint8 TypeByte;
-	DC_TRY(DcMsgPackReaderDetails::ReadTypeByte(this, &TypeByte));
 	int32 Size;
-	if (TypeByte >= DcMsgPackCommon::MSGPACK_MINFIXSTR && TypeByte <= DcMsgPackCommon::MSGPACK_MAXFIXSTR)
-	{
-		Size = 0b0001'1111 & TypeByte;
-	}
-	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR8)
-	{
-		uint8 Byte;
-		DC_TRY(DcMsgPackReaderDetails::Read1(this, &Byte));
-		Size = Byte;
-	}
-	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR16)
-	{
-		FDcBytes2 Bytes;
-		DC_TRY(DcMsgPackReaderDetails::ReadN(this, &Bytes));
-		Size = Bytes.As<uint16>();
-	}
-	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR32)
-	{
-		FDcBytes4 Bytes;
-		DC_TRY(DcMsgPackReaderDetails::ReadN(this, &Bytes));
-		uint32 USize = Bytes.As<uint32>();
-		if (USize > (uint32)TNumericLimits<int32>::Max())
-			return DC_FAIL(DcDMsgPack, SizeOverInt32Max);
+	DC_TRY(DcMsgPackReaderDetails::ReadStringSize(this, &Size));
+	ReadOut(OutPtr, FAnsiStringView((const ANSICHAR*)(View.DataPtr + State.Index), Size));
 
-		Size = (int32)USize;
-	}
-	else
-	{
-		return DC_FAIL(DcDReadWrite, DataTypeMismatch)
-			<< EDcDataEntry::String << DcMsgPackCommon::TypeByteToDataEntry(TypeByte);
-	}
+	State.Index += Size;
+	return DcMsgPackReaderDetails::EndTopRead(this);
+}
+
+FDcResult FDcMsgPackReader::ReadString(FString* OutPtr)
+{
+	FAnsiStringView Sv;
+	DC_TRY(ReadStringView(&Sv));
 
-	DC_TRY(DcMsgPackReaderDetails::CheckNoEOF(this, Size));
 	if (OutPtr)
 	{
-		//	UTF8 conv when detects non ascii chars
-		FUTF8ToTCHAR UTF8Conv((const ANSICHAR*)(View.DataPtr + State.Index), Size);
-		*OutPtr = FString(UTF8Conv.Length(), UTF8Conv.Get());
+		DcMsgPackReaderDetails::UTF8ToString(Sv, *OutPtr);
+		DC_STATS_ADD(Stats, StringsCreated, 1);
 	}
 
-	State.Index += Size;
-	return DcMsgPackReaderDetails::EndTopRead(this);
+	return DcOk();
 }
 
 FDcResult FDcMsgPackReader::ReadName(FName* OutPtr)
 {
-	FString Str;
-	DC_TRY(ReadString(&Str));
+	FAnsiStringView Sv;
+	DC_TRY(ReadStringView(&Sv));
+
+	if (!DcMsgPackReaderDetails::IsAllAscii(Sv))
+	{
+		FString Str;
+		DcMsgPackReaderDetails::UTF8ToString(Sv, Str);
 
-	if (Str.Len() >= NAME_SIZE)
+		if (Str.Len() >= NAME_SIZE)
+			return DC_FAIL(DcDReadWrite, FNameOverSize);
+
+		DC_STATS_ADD(Stats, NamesCreated, 1);
+		if (OutPtr)
+			*OutPtr = FName(Str);
+
+		return DcOk();
+	}
+
+	if (Sv.Len() >= NAME_SIZE)
 		return DC_FAIL(DcDReadWrite, FNameOverSize);
 
 	if (OutPtr)
-		*OutPtr = FName(Str);
+		*OutPtr = DcMsgPackReaderDetails::FindOrAddCachedName(this, Sv);
 
 	return DcOk();
 }
@@ -543,6 +642,142 @@ FDcResult FDcMsgPackReader::ReadFloat(float* OutPtr) { return DcMsgPackReaderDet
 FDcResult FDcMsgPackReader::ReadDouble(double* OutPtr) { return DcMsgPackReaderDetails::ReadNumericDispatch(this, OutPtr); }
 
 
+FDcResult FDcMsgPackReader::GetContainerSizeHint(int32* OutPtr)
+{
+	//	array/map headers carry the count, `Remain` of a map counts pairs
+	const FReadState& TopState = States.Top();
+	if (TopState.Type == EReadState::Root)
+		return ReadOutOk(OutPtr, INDEX_NONE);
+
+	//	count comes from untrusted input, clamp it to what the rest of the blob can hold:
+	//	at least 1 byte per item and 2 per map pair, and a fixed cap on top
+	const int32 BytesPerItem = TopState.Type == EReadState::Map ? 2 : 1;
+	const int32 BytesLeft = FMath::Max(0, View.Num - State.Index);
+	return ReadOutOk(OutPtr, FMath::Min3(TopState.Remain, BytesLeft / BytesPerItem, (int32)MAX_CONTAINER_SIZE_HINT));
+}
+
+FDcResult FDcMsgPackReader::SkipValue()
+{
+	using namespace DcMsgPackCommon;
+
+	DC_TRY(DcMsgPackReaderDetails::CheckTopStateRemains(this));
+
+	//	walk headers only and jump over payloads, containers add their items to `Pending`
+	int64 Pending = 1;
+	while (Pending > 0)
+	{
+		--Pending;
+
+		uint8 TypeByte;
+		DC_TRY(DcMsgPackReaderDetails::ReadTypeByte(this, &TypeByte));
+
+		int64 Size = 0;
+		if (TypeByte <= MSGPACK_MAXFIXINT
+			|| TypeByte >= MSGPACK_MINNEGATIVEFIXINT)
+		{
+			//	pass
+		}
+		else if (TypeByte >= MSGPACK_MINFIXMAP && TypeByte <= MSGPACK_MAXFIXMAP)
+		{
+			Pending += 2 * (0b1111 & TypeByte);
+		}
+		else if (TypeByte >= MSGPACK_MINFIXARRAY && TypeByte <= MSGPACK_MAXFIXARRAY)
+		{
+			Pending += 0b1111 & TypeByte;
+		}
+		else if (TypeByte >= MSGPACK_MINFIXSTR && TypeByte <= MSGPACK_MAXFIXSTR)
+		{
+			Size = 0b0001'1111 & TypeByte;
+		}
+		else
+		{
+			switch (TypeByte)
+			{
+				case MSGPACK_NIL:
+				case MSGPACK_FALSE:
+				case MSGPACK_TRUE:
+					break;
+				case MSGPACK_UINT8:
+				case MSGPACK_INT8:
+					Size = 1;
+					break;
+				case MSGPACK_UINT16:
+				case MSGPACK_INT16:
+					Size = 2;
+					break;
+				case MSGPACK_FLOAT32:
+				case MSGPACK_UINT32:
+				case MSGPACK_INT32:
+					Size = 4;
+					break;
+				case MSGPACK_FLOAT64:
+				case MSGPACK_UINT64:
+				case MSGPACK_INT64:
+					Size = 8;
+					break;
+				case MSGPACK_FIXEXT1: Size = 1 + 1; break;
+				case MSGPACK_FIXEXT2: Size = 1 + 2; break;
+				case MSGPACK_FIXEXT4: Size = 1 + 4; break;
+				case MSGPACK_FIXEXT8: Size = 1 + 8; break;
+				case MSGPACK_FIXEXT16: Size = 1 + 16; break;
+				case MSGPACK_STR8:
+				case MSGPACK_BIN8:
+				case MSGPACK_EXT8:
+				{
+					uint8 Byte;
+					DC_TRY(DcMsgPackReaderDetails::Read1(this, &Byte));
+					Size = TypeByte == MSGPACK_EXT8 ? Byte + 1 : Byte;
+					break;
+				}
+				case MSGPACK_STR16:
+				case MSGPACK_BIN16:
+				case MSGPACK_EXT16:
+				case MSGPACK_ARRAY16:
+				case MSGPACK_MAP16:
+				{
+					FDcBytes2 Bytes;
+					DC_TRY(DcMsgPackReaderDetails::ReadN(this, &Bytes));
+					int64 Len = Bytes.As<uint16>();
+					if (TypeByte == MSGPACK_ARRAY16)
+						Pending += Len;
+					else if (TypeByte == MSGPACK_MAP16)
+						Pending += 2 * Len;
+					else
+						Size = TypeByte == MSGPACK_EXT16 ? Len + 1 : Len;
+					break;
+				}
+				case MSGPACK_STR32:
+				case MSGPACK_BIN32:
+				case MSGPACK_EXT32:
+				case MSGPACK_ARRAY32:
+				case MSGPACK_MAP32:
+				{
+					FDcBytes4 Bytes;
+					DC_TRY(DcMsgPackReaderDetails::ReadN(this, &Bytes));
+					int64 Len = Bytes.As<uint32>();
+					if (TypeByte == MSGPACK_ARRAY32)
+						Pending += Len;
+					else if (TypeByte == MSGPACK_MAP32)
+						Pending += 2 * Len;
+					else
+						Size = TypeByte == MSGPACK_EXT32 ? Len + 1 : Len;
+					break;
+				}
+				default:
+					return DC_FAIL(DcDMsgPack, UnknownMsgTypeByte)
+						<< FString::Printf(TEXT("%x"), TypeByte);
+			}
+		}
+
+		if (State.Index + Size > View.Num)
+			return DC_FAIL(DcDMsgPack, ReadingPastEnd);
+
+		State.Index += (int)Size;
+	}
+
+	return DcMsgPackReaderDetails::EndTopRead(this);
+}
+
 FDcResult FDcMsgPackReader::ReadFixExt1(uint8* OutType, uint8* OutByte)
 {
 	DC_TRY(DcMsgPackReaderDetails::CheckTopStateRemains(this));
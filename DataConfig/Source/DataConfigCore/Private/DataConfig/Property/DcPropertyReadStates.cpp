@@ -92,10 +92,7 @@ FDcResult FDcReadStateClass::PeekRead(FDcPropertyReader* Parent, EDcDataEntry* O
 	else if (State == EState::ExpectValue)
 	{
 		check(Property);
-		if (DcPropertyUtils::IsScalarArray(Property))
-			return ReadOutOk(OutPtr, EDcDataEntry::ArrayRoot);
-		else
-			return ReadOutOk(OutPtr, DcPropertyUtils::PropertyToDataEntry(Property));
+		return ReadOutOk(OutPtr, PropertyEntry.Get(Property));
 	}
 	else
 	{
@@ -358,10 +355,7 @@ FDcResult FDcReadStateStruct::PeekRead(FDcPropertyReader* Parent, EDcDataEntry*
 	else if (State == EState::ExpectValue)
 	{
 		check(Property);
-		if (DcPropertyUtils::IsScalarArray(Property))
-			return ReadOutOk(OutPtr, EDcDataEntry::ArrayRoot);
-		else
-			return ReadOutOk(OutPtr, DcPropertyUtils::PropertyToDataEntry(Property));
+		return ReadOutOk(OutPtr, PropertyEntry.Get(Property));
 	}
 	else if (State == EState::Ended)
 	{
@@ -69,6 +69,7 @@ struct FDcReadStateClass : public FDcBaseReadState
 	UObject* ClassObject;
 	UClass* Class;
 	FProperty* Property;
+	DcPropertyUtils::FDcPropertyEntryCache PropertyEntry;
 
 	enum class EState : uint16
 	{
@@ -124,6 +125,7 @@ struct FDcReadStateStruct : public FDcBaseReadState
 	void* StructPtr;
 	UScriptStruct* StructClass;
 	FProperty* Property;
+	DcPropertyUtils::FDcPropertyEntryCache PropertyEntry;
 
 	enum class EState
 	{
@@ -694,6 +694,21 @@ FDcResult FDcPropertyReader::ReadUInt64(uint64* OutPtr) { return ReadTopStateSca
 FDcResult FDcPropertyReader::ReadFloat(float* OutPtr) { return ReadTopStateScalarProperty(this, OutPtr); }
 FDcResult FDcPropertyReader::ReadDouble(double* OutPtr) { return ReadTopStateScalarProperty(this, OutPtr); }
 
+FDcResult FDcPropertyReader::GetContainerSizeHint(int32* OutPtr)
+{
+	FDcBaseReadState& TopState = GetTopState(this);
+	if (FDcReadStateArray* ArrayState = TopState.As<FDcReadStateArray>())
+		return ReadOutOk(OutPtr, ArrayState->ArrayHelper.Num() - ArrayState->Index);
+
+	//	map and set iterate sparse index, only know the count before reading any
+	if (FDcReadStateMap* MapState = TopState.As<FDcReadStateMap>())
+		return ReadOutOk(OutPtr, MapState->SparseIndex == 0 ? MapState->MapHelper.Num() : INDEX_NONE);
+	if (FDcReadStateSet* SetState = TopState.As<FDcReadStateSet>())
+		return ReadOutOk(OutPtr, SetState->SparseIndex == 0 ? SetState->SetHelper.Num() : INDEX_NONE);
+
+	return ReadOutOk(OutPtr, INDEX_NONE);
+}
+
 FDcResult FDcPropertyReader::ReadBlob(FDcBlobViewData* OutPtr)
 {
 	FFieldVariant NextProperty;
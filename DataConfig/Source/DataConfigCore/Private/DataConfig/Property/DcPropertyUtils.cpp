@@ -168,72 +168,112 @@ FDcResult FindEffectivePropertyByOffset(UStruct* Struct, size_t Offset, FPropert
 	}
 }
 
-EDcDataEntry PropertyToDataEntry(FField* Property)
+static EDcDataEntry FieldClassToDataEntry(FFieldClass* Class)
 {
-	check(Property)
-	if (Property->IsA<FBoolProperty>()) return EDcDataEntry::Bool;
-	if (Property->IsA<FNameProperty>()) return EDcDataEntry::Name;
-	if (Property->IsA<FStrProperty>()) return EDcDataEntry::String;
-	if (Property->IsA<FTextProperty>()) return EDcDataEntry::Text;
-	if (Property->IsA<FEnumProperty>()) return EDcDataEntry::Enum;
+	check(Class);
+	if (Class->IsChildOf(FBoolProperty::StaticClass())) return EDcDataEntry::Bool;
+	if (Class->IsChildOf(FNameProperty::StaticClass())) return EDcDataEntry::Name;
+	if (Class->IsChildOf(FStrProperty::StaticClass())) return EDcDataEntry::String;
+	if (Class->IsChildOf(FTextProperty::StaticClass())) return EDcDataEntry::Text;
+	if (Class->IsChildOf(FEnumProperty::StaticClass())) return EDcDataEntry::Enum;
 
-	if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
-	{
-		if (NumericProperty->IsEnum())
-		{
-			return EDcDataEntry::Enum;
-		}
-		else
-		{
-			if (Property->IsA<FInt8Property>()) return EDcDataEntry::Int8;
-			if (Property->IsA<FInt16Property>()) return EDcDataEntry::Int16;
-			if (Property->IsA<FIntProperty>()) return EDcDataEntry::Int32;
-			if (Property->IsA<FInt64Property>()) return EDcDataEntry::Int64;
-
-			if (Property->IsA<FByteProperty>()) return EDcDataEntry::UInt8;
-			if (Property->IsA<FUInt16Property>()) return EDcDataEntry::UInt16;
-			if (Property->IsA<FUInt32Property>()) return EDcDataEntry::UInt32;
-			if (Property->IsA<FUInt64Property>()) return EDcDataEntry::UInt64;
-
-			if (Property->IsA<FFloatProperty>()) return EDcDataEntry::Float;
-			if (Property->IsA<FDoubleProperty>()) return EDcDataEntry::Double;
-		}
-	}
+	if (Class->IsChildOf(FInt8Property::StaticClass())) return EDcDataEntry::Int8;
+	if (Class->IsChildOf(FInt16Property::StaticClass())) return EDcDataEntry::Int16;
+	if (Class->IsChildOf(FIntProperty::StaticClass())) return EDcDataEntry::Int32;
+	if (Class->IsChildOf(FInt64Property::StaticClass())) return EDcDataEntry::Int64;
+
+	if (Class->IsChildOf(FByteProperty::StaticClass())) return EDcDataEntry::UInt8;
+	if (Class->IsChildOf(FUInt16Property::StaticClass())) return EDcDataEntry::UInt16;
+	if (Class->IsChildOf(FUInt32Property::StaticClass())) return EDcDataEntry::UInt32;
+	if (Class->IsChildOf(FUInt64Property::StaticClass())) return EDcDataEntry::UInt64;
+
+	if (Class->IsChildOf(FFloatProperty::StaticClass())) return EDcDataEntry::Float;
+	if (Class->IsChildOf(FDoubleProperty::StaticClass())) return EDcDataEntry::Double;
 
 	{
 		//	order significant
-		if (Property->IsA<FClassProperty>()) return EDcDataEntry::ClassReference;
-		if (Property->IsA<FStructProperty>()) return EDcDataEntry::StructRoot;
+		if (Class->IsChildOf(FClassProperty::StaticClass())) return EDcDataEntry::ClassReference;
+		if (Class->IsChildOf(FStructProperty::StaticClass())) return EDcDataEntry::StructRoot;
 	}
 
-	if (Property->IsA<FWeakObjectProperty>()) return EDcDataEntry::WeakObjectReference;
-	if (Property->IsA<FLazyObjectProperty>()) return EDcDataEntry::LazyObjectReference;
+	if (Class->IsChildOf(FWeakObjectProperty::StaticClass())) return EDcDataEntry::WeakObjectReference;
+	if (Class->IsChildOf(FLazyObjectProperty::StaticClass())) return EDcDataEntry::LazyObjectReference;
 
 	{
 		//	order significant
-		if (Property->IsA<FSoftClassProperty>()) return EDcDataEntry::SoftClassReference;
-		if (Property->IsA<FSoftObjectProperty>()) return EDcDataEntry::SoftObjectReference;
-		if (Property->IsA<FInterfaceProperty>()) return EDcDataEntry::InterfaceReference;
-		if (Property->IsA<FObjectProperty>()) return EDcDataEntry::ClassRoot;
+		if (Class->IsChildOf(FSoftClassProperty::StaticClass())) return EDcDataEntry::SoftClassReference;
+		if (Class->IsChildOf(FSoftObjectProperty::StaticClass())) return EDcDataEntry::SoftObjectReference;
+		if (Class->IsChildOf(FInterfaceProperty::StaticClass())) return EDcDataEntry::InterfaceReference;
+		if (Class->IsChildOf(FObjectProperty::StaticClass())) return EDcDataEntry::ClassRoot;
 	}
 
-	if (Property->IsA<FFieldPathProperty>()) return EDcDataEntry::FieldPath;
-	if (Property->IsA<FDelegateProperty>()) return EDcDataEntry::Delegate;
-	if (Property->IsA<FMulticastInlineDelegateProperty>()) return EDcDataEntry::MulticastInlineDelegate;
-	if (Property->IsA<FMulticastSparseDelegateProperty>()) return EDcDataEntry::MulticastSparseDelegate;
+	if (Class->IsChildOf(FFieldPathProperty::StaticClass())) return EDcDataEntry::FieldPath;
+	if (Class->IsChildOf(FDelegateProperty::StaticClass())) return EDcDataEntry::Delegate;
+	if (Class->IsChildOf(FMulticastInlineDelegateProperty::StaticClass())) return EDcDataEntry::MulticastInlineDelegate;
+	if (Class->IsChildOf(FMulticastSparseDelegateProperty::StaticClass())) return EDcDataEntry::MulticastSparseDelegate;
 
-	if (Property->IsA<FMapProperty>()) return EDcDataEntry::MapRoot;
-	if (Property->IsA<FArrayProperty>()) return EDcDataEntry::ArrayRoot;
-	if (Property->IsA<FSetProperty>()) return EDcDataEntry::SetRoot;
+	if (Class->IsChildOf(FMapProperty::StaticClass())) return EDcDataEntry::MapRoot;
+	if (Class->IsChildOf(FArrayProperty::StaticClass())) return EDcDataEntry::ArrayRoot;
+	if (Class->IsChildOf(FSetProperty::StaticClass())) return EDcDataEntry::SetRoot;
 
 #if !UE_VERSION_OLDER_THAN(5, 4, 0)
-	if (Property->IsA<FOptionalProperty>()) return EDcDataEntry::OptionalRoot;
+	if (Class->IsChildOf(FOptionalProperty::StaticClass())) return EDcDataEntry::OptionalRoot;
 #endif // !UE_VERSION_OLDER_THAN(5, 4, 0)
 
-	checkNoEntry();
 	return EDcDataEntry::Ended;
 }
 
+struct FPropertyEntryTable
+{
+	struct FEntry
+	{
+		EDcDataEntry Entry;
+		//	numeric properties can be enums, which is per property
+		bool bNumeric;
+	};
+
+	TMap<FFieldClass*, FEntry> Entries;
+
+	FPropertyEntryTable()
+	{
+		VisitAllEffectivePropertyClass([this](FFieldClass* Class)
+		{
+			Entries.Add(Class, {
+				FieldClassToDataEntry(Class),
+				Class->IsChildOf(FNumericProperty::StaticClass())
+			});
+		});
+	}
+};
+
+EDcDataEntry PropertyToDataEntry(FField* Property)
+{
+	check(Property);
+	//	built once on first use, classes not in the table like derived property classes
+	//	go through the class checks each time
+	static const FPropertyEntryTable Table;
+
+	FFieldClass* Class = Property->GetClass();
+	EDcDataEntry Entry;
+	bool bNumeric;
+	if (const FPropertyEntryTable::FEntry* EntryPtr = Table.Entries.Find(Class))
+	{
+		Entry = EntryPtr->Entry;
+		bNumeric = EntryPtr->bNumeric;
+	}
+	else
+	{
+		Entry = FieldClassToDataEntry(Class);
+		bNumeric = Class->IsChildOf(FNumericProperty::StaticClass());
+	}
+
+	if (bNumeric && static_cast<FNumericProperty*>(Property)->IsEnum())
+		return EDcDataEntry::Enum;
+
+	check(Entry != EDcDataEntry::Ended);
+	return Entry;
+}
+
 FString FormatArrayTypeName(FProperty* InnerProperty)
 {
 	return FString::Printf(TEXT("TArray<%s>"),
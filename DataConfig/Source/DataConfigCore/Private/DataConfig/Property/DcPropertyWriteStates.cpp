@@ -1,5 +1,7 @@
 #include "DataConfig/Property/DcPropertyWriteStates.h"
 #include "DataConfig/DcTypes.h"
+#include "DataConfig/DcStats.h"
+#include "DataConfig/DcTrace.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
@@ -49,6 +51,15 @@ static FORCEINLINE FDcResult HeuristicCheckStatesTooDeep(FDcPropertyWriter* Pare
 	return DcOk();
 }
 
+#if DC_STATS_ENABLED
+static FORCEINLINE int32 GetArraySlack(const DcSerDeCommon::FScriptArrayHelperAccess& ArrayAccess)
+{
+	return ((int32)ArrayAccess.ArrayFlags & (int32)EArrayPropertyFlags::UsesMemoryImageAllocator)
+		? ArrayAccess.FreezableArray->GetSlack()
+		: ArrayAccess.HeapArray->GetSlack();
+}
+#endif // DC_STATS_ENABLED
+
 
 }	// namespace DcPropertyWriteStatesDetails
 
@@ -91,17 +102,10 @@ FDcResult FDcWriteStateStruct::PeekWrite(FDcPropertyWriter* Parent, EDcDataEntry
 	else if (State == EState::ExpectValue)
 	{
 		check(Property);
-		if (DcPropertyUtils::IsScalarArray(Property))
-		{
-			return ReadOutOk(bOutOk, Next == EDcDataEntry::ArrayRoot
-				||  Next == EDcDataEntry::Blob);
-		}
-		else
-		{
-			EDcDataEntry Actual = DcPropertyUtils::PropertyToDataEntry(Property);
-			return ReadOutOk(bOutOk, Next == Actual
-				|| DcPropertyWriteStatesDetails::CheckPropertyCoercion(Next, Actual));
-		}
+		//	scalar arrays are `ArrayRoot` which also accepts blob
+		EDcDataEntry Actual = PropertyEntry.Get(Property);
+		return ReadOutOk(bOutOk, Next == Actual
+			|| DcPropertyWriteStatesDetails::CheckPropertyCoercion(Next, Actual));
 	}
 	else if (State == EState::Ended)
 	{
@@ -265,18 +269,10 @@ FDcResult FDcWriteStateClass::PeekWrite(FDcPropertyWriter* Parent, EDcDataEntry
 	else if (State == EState::ExpectExpandValue)
 	{
 		check(!Datum.IsNone());
-		FProperty* Property = Datum.CastFieldChecked<FProperty>();
-		if (DcPropertyUtils::IsScalarArray(Property))
-		{
-			return ReadOutOk(bOutOk, Next == EDcDataEntry::ArrayRoot\
-				|| Next == EDcDataEntry::Blob);
-		}
-		else
-		{
-			EDcDataEntry Actual = DcPropertyUtils::PropertyToDataEntry(Property);
-			return ReadOutOk(bOutOk, Next == Actual
-				|| DcPropertyWriteStatesDetails::CheckPropertyCoercion(Next, Actual));
-		}
+		//	scalar arrays are `ArrayRoot` which also accepts blob
+		EDcDataEntry Actual = PropertyEntry.Get(Datum.CastFieldChecked<FProperty>());
+		return ReadOutOk(bOutOk, Next == Actual
+			|| DcPropertyWriteStatesDetails::CheckPropertyCoercion(Next, Actual));
 	}
 	else if (State == EState::Ended)
 	{
@@ -540,6 +536,7 @@ FDcResult FDcWriteStateMap::WriteDataEntry(FDcPropertyWriter* Parent, FFieldClas
 	{
 		//	crucial to construct, future write is copy assignment
 		MapHelper.AddDefaultValue_Invalid_NeedsRehash();
+		DC_TRACE_COUNTER_ADD(DcElementsAllocated, 1);
 		bNeedsRehash = true;
 		MapHelper.GetKeyPtr(Index);
 
@@ -638,6 +635,16 @@ FDcResult FDcWriteStateMap::WriteMapRoot(FDcPropertyWriter* Parent)
 	}
 }
 
+void FDcWriteStateMap::Reserve(int32 Num)
+{
+	//	only reserve into an untouched empty map, don't discard existing pairs
+	if (State == EState::ExpectKeyOrEnd
+		&& Index == 0
+		&& Num > 0
+		&& MapHelper.Num() == 0)
+		MapHelper.EmptyValues(Num);
+}
+
 FDcResult FDcWriteStateMap::WriteMapEnd(FDcPropertyWriter* Parent)
 {
 	if (State == EState::ExpectKeyOrEnd)
@@ -647,6 +654,7 @@ FDcResult FDcWriteStateMap::WriteMapEnd(FDcPropertyWriter* Parent)
 		if (bNeedsRehash)
 		{
 			MapHelper.Rehash();
+			DC_STATS_ADD(Parent->Stats, ContainerGrowths, 1);
 		}
 
 		return DcOk();
@@ -714,7 +722,14 @@ FDcResult FDcWriteStateArray::WriteDataEntry(FDcPropertyWriter* Parent, FFieldCl
 	auto& ArrayAccess = (DcSerDeCommon::FScriptArrayHelperAccess&)ArrayHelper;
 	DC_TRY(DcPropertyWriteStatesDetails::CheckExpectedProperty(Parent, ArrayAccess.InnerProperty, ExpectedPropertyClass));
 
+#if DC_STATS_ENABLED
+	if (Parent->Stats
+		&& DcPropertyWriteStatesDetails::GetArraySlack(ArrayAccess) == 0)
+		++Parent->Stats->ContainerGrowths;
+#endif // DC_STATS_ENABLED
+
 	ArrayHelper.AddValue();
+	DC_TRACE_COUNTER_ADD(DcElementsAllocated, 1);
 	OutDatum.Property = ArrayAccess.InnerProperty;
 	OutDatum.DataPtr = ArrayHelper.GetRawPtr(Index);
 
@@ -774,6 +789,15 @@ FDcResult FDcWriteStateArray::WriteArrayRoot(FDcPropertyWriter* Parent)
 	}
 }
 
+void FDcWriteStateArray::Reserve(int32 Num)
+{
+	if (State == EState::ExpectItemOrEnd
+		&& Index == 0
+		&& Num > 0
+		&& ArrayHelper.Num() == 0)
+		ArrayHelper.EmptyValues(Num);
+}
+
 FDcResult FDcWriteStateArray::WriteArrayEnd(FDcPropertyWriter* Parent)
 {
 	if (State == EState::ExpectItemOrEnd)
@@ -844,6 +868,7 @@ FDcResult FDcWriteStateSet::WriteDataEntry(FDcPropertyWriter* Parent, FFieldClas
 	DC_TRY(DcPropertyWriteStatesDetails::CheckExpectedProperty(Parent, SetHelper.ElementProp, ExpectedPropertyClass));
 
 	SetHelper.AddDefaultValue_Invalid_NeedsRehash();
+	DC_TRACE_COUNTER_ADD(DcElementsAllocated, 1);
 	OutDatum.Property = SetHelper.ElementProp;
 	OutDatum.DataPtr = SetHelper.GetElementPtr(Index);
 
@@ -903,6 +928,15 @@ FDcResult FDcWriteStateSet::WriteSetRoot(FDcPropertyWriter* Parent)
 	}
 }
 
+void FDcWriteStateSet::Reserve(int32 Num)
+{
+	if (State == EState::ExpectItemOrEnd
+		&& Index == 0
+		&& Num > 0
+		&& SetHelper.Num() == 0)
+		SetHelper.EmptyElements(Num);
+}
+
 FDcResult FDcWriteStateSet::WriteSetEnd(FDcPropertyWriter* Parent)
 {
 	if (State == EState::ExpectItemOrEnd)
@@ -912,6 +946,7 @@ FDcResult FDcWriteStateSet::WriteSetEnd(FDcPropertyWriter* Parent)
 		if (bNeedsRehash)
 		{
 			SetHelper.Rehash();
+			DC_STATS_ADD(Parent->Stats, ContainerGrowths, 1);
 		}
 
 		return DcOk();
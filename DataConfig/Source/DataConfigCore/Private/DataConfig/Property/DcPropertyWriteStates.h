@@ -72,6 +72,7 @@ struct FDcWriteStateStruct : public FDcBaseWriteState
 	void* StructPtr;
 	UScriptStruct* StructClass;
 	FProperty* Property;
+	DcPropertyUtils::FDcPropertyEntryCache PropertyEntry;
 
 	enum class EState
 	{
@@ -133,6 +134,7 @@ struct FDcWriteStateClass : public FDcBaseWriteState
 
 	FName ObjectName;
 	FDcPropertyDatum Datum;
+	DcPropertyUtils::FDcPropertyEntryCache PropertyEntry;
 
 	FDcWriteStateClass(UObject* InClassObject, UClass* InClass)
 	{
@@ -217,6 +219,7 @@ struct FDcWriteStateMap : public FDcBaseWriteState
 
 	FDcResult WriteMapRoot(FDcPropertyWriter* Parent);
 	FDcResult WriteMapEnd(FDcPropertyWriter* Parent);
+	void Reserve(int32 Num);
 
 	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
@@ -261,6 +264,7 @@ struct FDcWriteStateArray : public FDcBaseWriteState
 
 	FDcResult WriteArrayRoot(FDcPropertyWriter* Parent);
 	FDcResult WriteArrayEnd(FDcPropertyWriter* Parent);
+	void Reserve(int32 Num);
 
 	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
@@ -306,6 +310,7 @@ struct FDcWriteStateSet : public FDcBaseWriteState
 
 	FDcResult WriteSetRoot(FDcPropertyWriter* Parent);
 	FDcResult WriteSetEnd(FDcPropertyWriter* Parent);
+	void Reserve(int32 Num);
 
 	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
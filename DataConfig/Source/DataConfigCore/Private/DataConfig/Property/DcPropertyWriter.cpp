@@ -1,6 +1,7 @@
 #include "DataConfig/Property/DcPropertyWriter.h"
 #include "DataConfig/Property/DcPropertyWriteStates.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
+#include "DataConfig/Misc/DcTemplateUtils.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/DcEnv.h"
 #include "UObject/TextProperty.h"
@@ -777,6 +778,36 @@ FDcResult FDcPropertyWriter::WriteBlob(const FDcBlobViewData& Value)
 	}
 }
 
+FDcResult FDcPropertyWriter::ReserveContainer(int32 Num)
+{
+	FDcBaseWriteState& TopState = GetTopState(this);
+	if (FDcWriteStateArray* ArrayState = TopState.As<FDcWriteStateArray>())
+		ArrayState->Reserve(Num);
+	else if (FDcWriteStateMap* MapState = TopState.As<FDcWriteStateMap>())
+		MapState->Reserve(Num);
+	else if (FDcWriteStateSet* SetState = TopState.As<FDcWriteStateSet>())
+		SetState->Reserve(Num);
+
+	return DcOk();
+}
+
+FDcResult FDcPropertyWriter::PeekWriteName(const FName& Value, bool* bOutOk)
+{
+	FDcBaseWriteState& TopState = GetTopState(this);
+	if (FDcWriteStateStruct* StructState = TopState.As<FDcWriteStateStruct>())
+	{
+		if (StructState->State == FDcWriteStateStruct::EState::ExpectKeyOrEnd)
+			return ReadOutOk(bOutOk, Config.NextProcessPropertyByName(StructState->StructClass, StructState->Property, Value) != nullptr);
+	}
+	else if (FDcWriteStateClass* ClassState = TopState.As<FDcWriteStateClass>())
+	{
+		if (ClassState->State == FDcWriteStateClass::EState::ExpectExpandKeyOrEnd)
+			return ReadOutOk(bOutOk, Config.NextProcessPropertyByName(ClassState->Class, ClassState->Datum.CastField<FProperty>(), Value) != nullptr);
+	}
+
+	return ReadOutOk(bOutOk, true);
+}
+
 FDcResult FDcPropertyWriter::SkipWrite()
 {
 	return GetTopState(this).SkipWrite(this);
@@ -3,6 +3,7 @@
 #include "DataConfig/Misc/DcTypeUtils.h"
 #include "DataConfig/Diagnostic/DcDiagnosticUtils.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
+#include "DataConfig/SerDe/DcSerDeUtils.h"
 
 
 namespace DcPutbackReaderDetails
@@ -297,6 +298,29 @@ FDcResult FDcPutbackReader::ReadBlob(FDcBlobViewData* OutPtr)
 	return DcPutbackReaderDetails::CanNotCachedRead(this, EDcDataEntry::Blob, &FDcReader::ReadBlob, OutPtr);
 }
 
+FDcResult FDcPutbackReader::GetContainerSizeHint(int32* OutPtr)
+{
+	if (Cached.Num())
+		return ReadOutOk(OutPtr, INDEX_NONE);
+
+	return Reader->GetContainerSizeHint(OutPtr);
+}
+
+FDcResult FDcPutbackReader::SkipValue()
+{
+	if (Cached.Num())
+	{
+		//	put back container roots still need their items read through
+		if (Cached.Last().bDataTypeOnly)
+			return DcSerDeUtils::ReadNoopConsumeValue(this);
+
+		Cached.Pop();
+		return DcOk();
+	}
+
+	return Reader->SkipValue();
+}
+
 FDcResult FDcPutbackReader::Coercion(EDcDataEntry ToEntry, bool* OutPtr)
 {
 	if (Cached.Num())
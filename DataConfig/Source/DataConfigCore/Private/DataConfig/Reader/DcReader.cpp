@@ -1,6 +1,8 @@
 #include "DataConfig/Reader/DcReader.h"
 #include "DataConfig/DcEnv.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
+#include "DataConfig/Misc/DcTemplateUtils.h"
+#include "DataConfig/SerDe/DcSerDeUtils.h"
 
 FDcReader::~FDcReader() {}
 
@@ -46,6 +48,8 @@ FDcResult FDcReader::ReadUInt64(uint64*) { return DC_FAIL(DcDCommon, NotImplemen
 FDcResult FDcReader::ReadFloat(float*) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcReader::ReadDouble(double*) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcReader::ReadBlob(FDcBlobViewData*) { return DC_FAIL(DcDCommon, NotImplemented); }
+FDcResult FDcReader::GetContainerSizeHint(int32* OutPtr) { return ReadOutOk(OutPtr, INDEX_NONE); }
+FDcResult FDcReader::SkipValue() { return DcSerDeUtils::ReadNoopConsumeValue(this); }
 
 void FDcReader::FormatDiagnostic(FDcDiagnostic& Diag) { /*pass*/ }
 
@@ -0,0 +1,140 @@
+#include "DataConfig/SerDe/DcSerDeEnumLookup.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+
+void FDcEnumLookup::Build(UEnum* InEnum)
+{
+	check(InEnum);
+	Enum = InEnum;
+
+#if WITH_EDITORONLY_DATA
+	#if WITH_METADATA
+	bIsBitFlags = InEnum->HasMetaData(TEXT("Bitflags"));
+	#else
+	//	Program target is missing `UEnum::HasMetaData`
+	bIsBitFlags = ((UField*)InEnum)->HasMetaData(TEXT("Bitflags"));
+	#endif
+#else // WITH_EDITORONLY_DATA
+	bIsBitFlags = false;
+#endif // WITH_EDITORONLY_DATA
+
+	int Len = InEnum->NumEnums();
+	Values.Reset(Len);
+	Names.Reset(Len);
+	AuthoredNames.Reset(Len);
+	NameToIndex.Reset();
+	AuthoredNameToIndex.Reset();
+	ValueToIndex.Reset();
+
+	for (int Ix = 0; Ix < Len; Ix++)
+	{
+		int64 Value = InEnum->GetValueByIndex(Ix);
+		Values.Add(Value);
+		Names.Add(InEnum->GetNameStringByIndex(Ix));
+		AuthoredNames.Add(InEnum->GetAuthoredNameStringByIndex(Ix));
+
+		//	first one wins on duplicates, same as `UEnum` linear lookups
+		if (!NameToIndex.Contains(Names.Last()))
+			NameToIndex.Add(Names.Last(), Ix);
+		if (!AuthoredNameToIndex.Contains(AuthoredNames.Last()))
+			AuthoredNameToIndex.Add(AuthoredNames.Last(), Ix);
+		if (!ValueToIndex.Contains(Value))
+			ValueToIndex.Add(Value, Ix);
+	}
+}
+
+namespace DcSerDeEnumLookupDetails
+{
+
+static FRWLock Lock;
+static TMap<UEnum*, TSharedPtr<const FDcEnumLookup, ESPMode::ThreadSafe>> Lookups;
+
+static bool IsLookupValid(const FDcEnumLookup& Lookup, UEnum* Enum)
+{
+	return Lookup.Enum.Get() == Enum
+		&& Lookup.Num() == Enum->NumEnums();
+}
+
+#if WITH_EDITOR
+static FDelegateHandle ObjectModifiedHandle;
+static FDelegateHandle ObjectPropertyChangedHandle;
+
+static void OnObjectModified(UObject* Object)
+{
+	//	non native enums get edited in place, e.g `FEnumEditorUtils` renaming `UUserDefinedEnum` display names
+	if (UEnum* Enum = Cast<UEnum>(Object))
+		DcSerDeUtils::InvalidateEnumLookup(Enum);
+}
+
+static void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent&)
+{
+	//	also covers undo/redo which restores the enum without `Modify`
+	OnObjectModified(Object);
+}
+#endif // WITH_EDITOR
+
+} // namespace DcSerDeEnumLookupDetails
+
+namespace DcSerDeUtils
+{
+
+FDcEnumLookupRef FindOrBuildEnumLookup(UEnum* Enum)
+{
+	using namespace DcSerDeEnumLookupDetails;
+	check(Enum);
+
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (TSharedPtr<const FDcEnumLookup, ESPMode::ThreadSafe>* LookupPtr = Lookups.Find(Enum))
+		{
+			if (IsLookupValid(**LookupPtr, Enum))
+				return LookupPtr->ToSharedRef();
+		}
+	}
+
+	TSharedRef<FDcEnumLookup, ESPMode::ThreadSafe> Lookup = MakeShared<FDcEnumLookup, ESPMode::ThreadSafe>();
+	Lookup->Build(Enum);
+
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Lookups.Add(Enum, Lookup);
+	}
+
+	return Lookup;
+}
+
+void InvalidateEnumLookup(UEnum* Enum)
+{
+	using namespace DcSerDeEnumLookupDetails;
+
+	FWriteScopeLock WriteLock(Lock);
+	if (Enum)
+		Lookups.Remove(Enum);
+	else
+		Lookups.Empty();
+}
+
+void RegisterEnumLookupHooks()
+{
+#if WITH_EDITOR
+	using namespace DcSerDeEnumLookupDetails;
+	if (!ObjectModifiedHandle.IsValid())
+		ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(OnObjectModified);
+	if (!ObjectPropertyChangedHandle.IsValid())
+		ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(OnObjectPropertyChanged);
+#endif // WITH_EDITOR
+}
+
+void UnregisterEnumLookupHooks()
+{
+#if WITH_EDITOR
+	using namespace DcSerDeEnumLookupDetails;
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	ObjectModifiedHandle.Reset();
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	ObjectPropertyChangedHandle.Reset();
+#endif // WITH_EDITOR
+}
+
+} // namespace DcSerDeUtils
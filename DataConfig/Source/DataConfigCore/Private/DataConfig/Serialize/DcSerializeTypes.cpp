@@ -3,6 +3,7 @@
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/Diagnostic/DcDiagnosticUtils.h"
 #include "DataConfig/Property/DcPropertyReader.h"
+#include "DataConfig/Writer/DcWriter.h"
 
 FDcResult FDcSerializeContext::Prepare()
 {
@@ -38,6 +39,12 @@ FDcResult FDcSerializeContext::Prepare()
 		return DC_FAIL(DcDSerDe, ContextExpectOneProperty) << Properties.Num();
 	}
 
+	if (Stats)
+	{
+		Reader->Stats = Stats;
+		Writer->Stats = Stats;
+	}
+
 	State = EState::Ready;
 	return DcOk();
 
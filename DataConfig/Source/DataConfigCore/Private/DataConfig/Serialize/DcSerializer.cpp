@@ -1,4 +1,6 @@
 #include "DataConfig/Serialize/DcSerializer.h"
+#include "DataConfig/DcStats.h"
+#include "DataConfig/DcTrace.h"
 #include "DataConfig/Property/DcPropertyReader.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
@@ -10,31 +12,76 @@
 namespace DcSerializerDetails
 {
 
-static FORCEINLINE FDcResult ExecuteSerializeHandler(FDcSerializeContext& Ctx, FDcSerializeDelegate& Handler)
+static FORCEINLINE FDcResult ExecuteSerializeHandler(FDcSerializeContext& Ctx, FDcSerializeDelegate& Handler, const FName& HandlerName)
 {
 	if (!Handler.IsBound())
 		return DC_FAIL(DcDCommon, StaleDelegate);
 
+	DC_STATS_HANDLER(Ctx.Stats, HandlerName, Ctx.Properties.Num());
+	DC_TRACE_SCOPE(HandlerName);
 	return Handler.Execute(Ctx);
 }
 
+#if DC_TRACE_ENABLED
+static FName GetTraceRootName(FFieldVariant& Property)
+{
+	if (UStruct* Struct = DcPropertyUtils::TryGetStruct(Property))
+		return Struct->GetFName();
+	else if (Property.IsUObject())
+		return Property.GetFName();
+	else
+		return Property.ToFieldUnsafe()->GetClass()->GetFName();
+}
+#endif // DC_TRACE_ENABLED
+
+template<typename TKey>
+static FORCEINLINE FDcSerializeDelegate* FindHandler(FDcSerializer* Self, TMap<TKey, FDcSerializeDelegate> FDcSerializer::*Map, TKey Key)
+{
+	for (FDcSerializer* Cur = Self; Cur; Cur = Cur->Parent)
+	{
+		if (FDcSerializeDelegate* HandlerPtr = (Cur->*Map).Find(Key))
+			return HandlerPtr;
+	}
+
+	return nullptr;
+}
+
+template<typename TKey>
+static void FlattenHandlers(TMap<TKey, FDcSerializeDelegate>& Map, const TMap<TKey, FDcSerializeDelegate>& ParentMap)
+{
+	for (const auto& Pair : ParentMap)
+	{
+		if (!Map.Contains(Pair.Key))
+			Map.Add(Pair.Key, Pair.Value);
+	}
+	Map.Shrink();
+}
+
 static FDcResult SerializeBody(FDcSerializer* Self, FDcSerializeContext& Ctx)
 {
 	//	try predicated serializers first, if not handled then try direct handlers
-	for (auto& PredEntry : Self->PredicatedSerializers)
+	for (FDcSerializer* Cur = Self; Cur; Cur = Cur->Parent)
 	{
-		if (!PredEntry.Predicate.IsBound())
-			return DC_FAIL(DcDCommon, StaleDelegate);
+		for (auto& PredEntry : Cur->PredicatedSerializers)
+		{
+			if (!PredEntry.Predicate.IsBound())
+				return DC_FAIL(DcDCommon, StaleDelegate);
 
-		if (PredEntry.Predicate.Execute(Ctx) == EDcSerializePredicateResult::Process)
-			return ExecuteSerializeHandler(Ctx, PredEntry.Handler);
+			DC_STATS_ADD(Ctx.Stats, PredicateEvaluations, 1);
+			if (PredEntry.Predicate.Execute(Ctx) == EDcSerializePredicateResult::Process)
+				return ExecuteSerializeHandler(Ctx, PredEntry.Handler, PredEntry.Name);
+		}
 	}
 
 	FFieldVariant& Property = Ctx.TopProperty();
 	FDcSerializeDelegate* HandlerPtr = nullptr;
+	FName HandlerName;
 
 	if (UStruct* Struct = DcPropertyUtils::TryGetStruct(Property))
-		HandlerPtr = Self->StructSerializerMap.Find(Struct);
+	{
+		HandlerPtr = FindHandler(Self, &FDcSerializer::StructSerializerMap, Struct);
+		HandlerName = Struct->GetFName();
+	}
 
 	if (!HandlerPtr)
 	{
@@ -43,7 +90,8 @@ static FDcResult SerializeBody(FDcSerializer* Self, FDcSerializeContext& Ctx)
 			UObject* Object = CastChecked<UObject>(Property.ToUObjectUnsafe());
 			check(IsValid(Object));
 			UClass* Class = Object->GetClass();
-			HandlerPtr = Self->UClassSerializerMap.Find(Class);
+			HandlerPtr = FindHandler(Self, &FDcSerializer::UClassSerializerMap, Class);
+			HandlerName = Class->GetFName();
 			if (HandlerPtr == nullptr)
 				return DC_FAIL(DcDSerDe, NoMatchingHandler)
 					<< Ctx.TopProperty().GetFName() << Class->GetFName();
@@ -53,14 +101,15 @@ static FDcResult SerializeBody(FDcSerializer* Self, FDcSerializeContext& Ctx)
 			FField* Field = Property.ToFieldUnsafe();
 			check(Field->IsValidLowLevel());
 			FFieldClass* FieldClass = Field->GetClass();
-			HandlerPtr = Self->FieldClassSerializerMap.Find(FieldClass);
+			HandlerPtr = FindHandler(Self, &FDcSerializer::FieldClassSerializerMap, FieldClass);
+			HandlerName = FieldClass->GetFName();
 			if (HandlerPtr == nullptr)
 				return DC_FAIL(DcDSerDe, NoMatchingHandler)
 					<< Ctx.TopProperty().GetFName() << FieldClass->GetFName();
 		}
 	}
 
-	return ExecuteSerializeHandler(Ctx, *HandlerPtr);
+	return ExecuteSerializeHandler(Ctx, *HandlerPtr, HandlerName);
 }
 
 static void AmendDiagnostic(FDcDiagnostic& Diag, FDcSerializeContext& Ctx)
@@ -112,6 +161,7 @@ FDcResult FDcSerializer::Serialize(FDcSerializeContext& Ctx)
 	}
 	else if (Ctx.State == ECtxState::Ready)
 	{
+		DC_TRACE_SCOPE(DcSerializerDetails::GetTraceRootName(Ctx.TopProperty()));
 		Ctx.State = ECtxState::SerializeInProgress;
 
 		ON_SCOPE_EXIT
@@ -139,24 +189,46 @@ FDcResult FDcSerializer::Serialize(FDcSerializeContext& Ctx)
 
 void FDcSerializer::AddDirectHandler(UClass* PropertyClass, FDcSerializeDelegate&& Delegate)
 {
+	check(!bFrozen);
 	check(PropertyClass && !UClassSerializerMap.Contains(PropertyClass));
 	UClassSerializerMap.Add(PropertyClass, MoveTemp(Delegate));
 }
 
 void FDcSerializer::AddDirectHandler(FFieldClass* PropertyClass, FDcSerializeDelegate&& Delegate)
 {
+	check(!bFrozen);
 	check(PropertyClass && !FieldClassSerializerMap.Contains(PropertyClass));
 	FieldClassSerializerMap.Add(PropertyClass, MoveTemp(Delegate));
 }
 
 void FDcSerializer::AddPredicatedHandler(FDcSerializePredicate&& Predicate, FDcSerializeDelegate&& Delegate, const FName Name)
 {
+	check(!bFrozen);
 	PredicatedSerializers.Add(FPredicatedHandlerEntry{MoveTemp(Predicate), MoveTemp(Delegate), Name});
 }
 
 void FDcSerializer::AddStructHandler(UStruct* Struct, FDcSerializeDelegate&& Delegate)
 {
+	check(!bFrozen);
 	check(Struct && !StructSerializerMap.Contains(Struct));
 	StructSerializerMap.Add(Struct, MoveTemp(Delegate));
 }
 
+void FDcSerializer::Freeze()
+{
+	check(!bFrozen);
+	using namespace DcSerializerDetails;
+
+	for (FDcSerializer* Cur = Parent; Cur; Cur = Cur->Parent)
+	{
+		PredicatedSerializers.Append(Cur->PredicatedSerializers);
+		FlattenHandlers(UClassSerializerMap, Cur->UClassSerializerMap);
+		FlattenHandlers(FieldClassSerializerMap, Cur->FieldClassSerializerMap);
+		FlattenHandlers(StructSerializerMap, Cur->StructSerializerMap);
+	}
+
+	PredicatedSerializers.Shrink();
+	Parent = nullptr;
+	bFrozen = true;
+}
+
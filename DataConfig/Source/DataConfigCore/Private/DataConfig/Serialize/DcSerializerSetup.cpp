@@ -16,6 +16,27 @@
 #include "UObject/PropertyOptional.h"
 #endif // !UE_VERSION_OLDER_THAN(5, 4, 0)
 
+namespace DcSerializerSetupDetails
+{
+
+template<typename TEnum, TEnum Type, void(*FuncSetup)(FDcSerializer&, TEnum)>
+static FDcSerializer& GetShared()
+{
+	//	function local statics are initialized exactly once even with concurrent calls
+	static FDcSerializer Shared;
+	static bool bInitialized = []
+	{
+		FuncSetup(Shared, Type);
+		Shared.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
+
+	return Shared;
+}
+
+} // namespace DcSerializerSetupDetails
+
 void DcSetupJsonSerializeHandlers(FDcSerializer& Serializer, EDcJsonSerializeType Type)
 {
 	using namespace DcCommonHandlers;
@@ -331,3 +352,36 @@ void DcSetupCoreTypesSerializeHandlers(FDcSerializer& Serializer)
 #endif // ENGINE_MAJOR_VERSION == 5
 
 }
+
+FDcSerializer& DcGetSharedJsonSerializer(EDcJsonSerializeType Type)
+{
+	using namespace DcSerializerSetupDetails;
+	switch (Type)
+	{
+		case EDcJsonSerializeType::Default:
+			return GetShared<EDcJsonSerializeType, EDcJsonSerializeType::Default, DcSetupJsonSerializeHandlers>();
+		case EDcJsonSerializeType::StringSoftLazy:
+			return GetShared<EDcJsonSerializeType, EDcJsonSerializeType::StringSoftLazy, DcSetupJsonSerializeHandlers>();
+		default:
+			checkNoEntry();
+			return GetShared<EDcJsonSerializeType, EDcJsonSerializeType::Default, DcSetupJsonSerializeHandlers>();
+	}
+}
+
+FDcSerializer& DcGetSharedMsgPackSerializer(EDcMsgPackSerializeType Type)
+{
+	using namespace DcSerializerSetupDetails;
+	switch (Type)
+	{
+		case EDcMsgPackSerializeType::Default:
+			return GetShared<EDcMsgPackSerializeType, EDcMsgPackSerializeType::Default, DcSetupMsgPackSerializeHandlers>();
+		case EDcMsgPackSerializeType::StringSoftLazy:
+			return GetShared<EDcMsgPackSerializeType, EDcMsgPackSerializeType::StringSoftLazy, DcSetupMsgPackSerializeHandlers>();
+		case EDcMsgPackSerializeType::InMemory:
+			return GetShared<EDcMsgPackSerializeType, EDcMsgPackSerializeType::InMemory, DcSetupMsgPackSerializeHandlers>();
+		default:
+			checkNoEntry();
+			return GetShared<EDcMsgPackSerializeType, EDcMsgPackSerializeType::Default, DcSetupMsgPackSerializeHandlers>();
+	}
+}
+
@@ -2,6 +2,7 @@
 #include "DataConfig/Writer/DcWriter.h"
 #include "DataConfig/Property/DcPropertyReader.h"
 #include "DataConfig/SerDe/DcSerDeCommon.inl"
+#include "DataConfig/SerDe/DcSerDeEnumLookup.h"
 #include "DataConfig/SerDe/DcSerDeUtils.inl"
 #include "DataConfig/Serialize/DcSerializer.h"
 #include "DataConfig/Serialize/DcSerializeUtils.h"
@@ -88,46 +89,32 @@ FDcResult HandlerEnumToStringSerialize(FDcSerializeContext& Ctx)
 		return Ctx.Writer->WriteUInt64(Value.Unsigned64);
 	}
 
-	bool bIsBitFlags;
-
-#if WITH_EDITORONLY_DATA
-
-	#if WITH_METADATA
-	bIsBitFlags = Enum->HasMetaData(TEXT("Bitflags"));
-	#else
-	//	Program target is missing `UEnum::HasMetaData`
-	bIsBitFlags = ((UField*)Enum)->HasMetaData(TEXT("Bitflags"));
-	#endif
-
-#else // WITH_EDITORONLY_DATA
-	bIsBitFlags = false;
-#endif // WITH_EDITORONLY_DATA
-
-	if (!bIsBitFlags)
+	FDcEnumLookupRef Lookup = DcSerDeUtils::FindOrBuildEnumLookup(Enum);
+	if (!Lookup->bIsBitFlags)
 	{
-		int ValueIndex = Enum->GetIndexByValue(Value.Signed64);
+		int ValueIndex = Lookup->FindIndexByValue(Value.Signed64);
 		if (ValueIndex == INDEX_NONE)
 			return DC_FAIL(DcDReadWrite, EnumValueInvalid)
 				<< Enum->GetName() << Value.Signed64;
 
-		DC_TRY(Ctx.Writer->WriteString(Enum->GetNameStringByValue(Value.Signed64)));
+		DC_TRY(Ctx.Writer->WriteString(Lookup->Names[ValueIndex]));
 	}
 	else
 	{
 		DC_TRY(Ctx.Writer->WriteArrayRoot());
 
-		int Len = Enum->NumEnums();
+		int Len = Lookup->Num();
 		uint64 Data = Value.Unsigned64;
 		for (int Ix = 0; Ix < Len; Ix++)
 		{
-			int64 Cur = Enum->GetValueByIndex(Ix);
+			int64 Cur = Lookup->Values[Ix];
 			int CurPopCount = FPlatformMath::CountBits(Cur);
 			if (CurPopCount == 0)
 				continue;
 
 			if (FPlatformMath::CountBits(Data & Cur) == CurPopCount)
 			{
-				DC_TRY(Ctx.Writer->WriteString(Enum->GetNameStringByIndex(Ix)));
+				DC_TRY(Ctx.Writer->WriteString(Lookup->Names[Ix]));
 				Data ^= Cur;
 			}
 		}
@@ -0,0 +1,122 @@
+#include "DataConfig/Source/DcAsyncFileSource.h"
+#include "DataConfig/DcEnv.h"
+#include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
+#include "Async/AsyncFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+
+FDcAsyncFileSource::~FDcAsyncFileSource()
+{
+	Reset();
+}
+
+FDcResult FDcAsyncFileSource::Open(const FString& InPath, int64 ChunkSize)
+{
+	check(ChunkSize > 0);
+	Reset();
+	Path = InPath;
+
+	auto _Fail = [this]
+	{
+		FString FailedPath = Path;
+		Reset();
+		return DC_FAIL(DcDCommon, FileOpenFailed) << FailedPath;
+	};
+
+	Handle = FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*Path);
+	if (!Handle)
+		return _Fail();
+
+	//	only the size is waited on, missing files report negative size
+	int64 Size = -1;
+	if (IAsyncReadRequest* SizeRequest = Handle->SizeRequest())
+	{
+		SizeRequest->WaitCompletion();
+		Size = SizeRequest->GetSizeResults();
+		delete SizeRequest;
+	}
+
+	if (Size < 0 || Size > MAX_int32)
+		return _Fail();
+
+	Buffer.SetNumUninitialized((int32)Size);
+	for (int64 Offset = 0; Offset < Size; Offset += ChunkSize)
+	{
+		int64 BytesToRead = FMath::Min(ChunkSize, Size - Offset);
+		IAsyncReadRequest* Request = Handle->ReadRequest(Offset, BytesToRead, AIOP_Normal, nullptr, Buffer.GetData() + Offset);
+		if (!Request)
+			return _Fail();
+
+		Requests.Add(Request);
+	}
+
+	return DcOk();
+}
+
+bool FDcAsyncFileSource::IsReady() const
+{
+	for (IAsyncReadRequest* Request : Requests)
+	{
+		if (!Request->PollCompletion())
+			return false;
+	}
+
+	return true;
+}
+
+FDcResult FDcAsyncFileSource::Wait()
+{
+	bool bAllRead = true;
+	for (IAsyncReadRequest* Request : Requests)
+	{
+		Request->WaitCompletion();
+		//	user supplied memory is returned on success
+		bAllRead &= Request->GetReadResults() != nullptr;
+		delete Request;
+	}
+	Requests.Empty();
+
+	//	requests needs to be deleted before the handle
+	delete Handle;
+	Handle = nullptr;
+
+	if (!bAllRead)
+	{
+		Buffer.Empty();
+		return DC_FAIL(DcDCommon, FileReadFailed) << Path;
+	}
+
+	return DcOk();
+}
+
+void FDcAsyncFileSource::Reset()
+{
+	for (IAsyncReadRequest* Request : Requests)
+	{
+		Request->Cancel();
+		Request->WaitCompletion();
+		delete Request;
+	}
+	Requests.Empty();
+
+	delete Handle;
+	Handle = nullptr;
+
+	Path.Empty();
+	Buffer.Empty();
+}
+
+FDcAnsiSourceBuffer FDcAsyncFileSource::GetAnsiSource() const
+{
+	check(Requests.Num() == 0);
+
+	const ANSICHAR* Ptr = (const ANSICHAR*)Buffer.GetData();
+	int32 Num = Buffer.Num();
+	if (Num >= 3 && Buffer[0] == 0xEF && Buffer[1] == 0xBB && Buffer[2] == 0xBF)
+	{
+		Ptr += 3;
+		Num -= 3;
+	}
+
+	return FDcAnsiSourceBuffer(Ptr, Num);
+}
+
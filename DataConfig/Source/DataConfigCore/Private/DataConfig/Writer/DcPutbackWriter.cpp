@@ -243,6 +243,14 @@ FDcResult FDcPutbackWriter::WriteBlob(const FDcBlobViewData& Value)
 	return DcPutbackWriterDetails::CachedWrite<EDcDataEntry::Blob>(this, &FDcWriter::WriteBlob, Value);
 }
 
+FDcResult FDcPutbackWriter::ReserveContainer(int32 Num)
+{
+	if (Cached.Num())
+		return DcOk();
+
+	return Writer->ReserveContainer(Num);
+}
+
 void FDcPutbackWriter::FormatDiagnostic(FDcDiagnostic& Diag)
 {
 	Writer->FormatDiagnostic(Diag);
@@ -217,6 +217,11 @@ FDcResult FDcWeakCompositeWriter::WriteBlob(const FDcBlobViewData& Value)
 	return CompositeDispatch(this, &FDcWriter::WriteBlob, Value);
 }
 
+FDcResult FDcWeakCompositeWriter::ReserveContainer(int32 Num)
+{
+	return CompositeDispatch(this, &FDcWriter::ReserveContainer, Num);
+}
+
 void FDcWeakCompositeWriter::FormatDiagnostic(FDcDiagnostic& Diag)
 {
 	for (FDcWriter* Writer : Writers)
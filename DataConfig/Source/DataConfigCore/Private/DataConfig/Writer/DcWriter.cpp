@@ -46,6 +46,7 @@ FDcResult FDcWriter::WriteUInt64(const uint64&) { return DC_FAIL(DcDCommon, NotI
 FDcResult FDcWriter::WriteFloat(const float&) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcWriter::WriteDouble(const double&) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcWriter::WriteBlob(const FDcBlobViewData&) { return DC_FAIL(DcDCommon, NotImplemented); }
+FDcResult FDcWriter::ReserveContainer(int32) { return DcOk(); }
 
 void FDcWriter::FormatDiagnostic(FDcDiagnostic& Diag) { /*pass*/ }
 
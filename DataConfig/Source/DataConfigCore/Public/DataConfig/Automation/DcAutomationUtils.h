@@ -83,6 +83,7 @@ DATACONFIGCORE_API double DebugGetRealPropertyValue(const FDcPropertyDatum& Datu
 enum class EDefaultSetupType
 {
 	SetupJSONHandlers,
+	SharedJSONHandlers,	// layer on the shared frozen JSON handlers instead of setting up new ones
 	SetupNothing,
 };
 
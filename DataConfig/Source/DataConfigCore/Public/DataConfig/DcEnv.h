@@ -66,6 +66,17 @@ struct DATACONFIGCORE_API FDcScopedEnv
 	FORCEINLINE FDcEnv& Parent() { return gDcEnvs[gDcEnvs.Num() - 2]; }
 };
 
+///	Override `DcEnv()` on current thread with a standalone env, for running on worker threads
+///	without touching the global env stack. Diagnostics raised in scope are collected in `Env`.
+struct DATACONFIGCORE_API FDcScopedThreadEnv : private FNoncopyable
+{
+	FDcScopedThreadEnv();
+	~FDcScopedThreadEnv();
+
+	FDcEnv Env;
+	FDcEnv* PrevEnv;
+};
+
 #define DC_FAIL(DiagNamespace, DiagID) (DcFail(FDcErrorCode{DiagNamespace::Category, DiagNamespace::DiagID}))
 
 FORCEINLINE FDcDiagnostic& DcFail(FDcErrorCode InErr)
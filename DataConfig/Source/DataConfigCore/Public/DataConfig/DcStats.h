@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcMacros.h"
+#include "DataConfig/DcTypes.h"
+#include "Templates/Function.h"
+
+///	Counters collected when a `FDcStats` is attached to `FDcDeserializeContext::Stats`
+///	or `FDcSerializeContext::Stats`. Counting is on in all builds including
+///	shipping and dedicated servers, it costs a null check when no stats are attached.
+///	Define `DC_STATS_ENABLED=0` to compile it out.
+#ifndef DC_STATS_ENABLED
+	#define DC_STATS_ENABLED 1
+#endif
+
+struct DATACONFIGCORE_API FDcStats
+{
+	//	entries read from JSON/MsgPack readers, indexed by `EDcDataEntry`
+	int64 EntryCounts[(int)EDcDataEntry::Ended + 1] = {};
+	int64 BytesConsumed = 0;
+	int64 StringsCreated = 0;
+	int64 NamesCreated = 0;
+	int64 PredicateEvaluations = 0;
+	int64 Putbacks = 0;
+	//	array reallocations and map/set rehashes in property writer
+	int64 ContainerGrowths = 0;
+	int32 PeakDepth = 0;
+
+	TMap<FName, int64> HandlerCalls;
+
+	FORCEINLINE int64 GetEntryCount(EDcDataEntry Entry) const { return EntryCounts[(int)Entry]; }
+	int64 GetEntryTotal() const;
+
+	void Reset();
+	void Merge(const FDcStats& Other);
+
+	///	Flatten into `Name, Value` pairs, like `Entry.String` or `Handler.DcHandlerDeserializeMapToStruct`
+	void ForEachMetric(TFunctionRef<void(const FString&, int64)> Func) const;
+	FString ToString() const;
+
+	FORCEINLINE void AddEntry(EDcDataEntry Entry) { ++EntryCounts[(int)Entry]; }
+	FORCEINLINE void AddHandlerCall(const FName& Name, int32 Depth)
+	{
+		++HandlerCalls.FindOrAdd(Name);
+		PeakDepth = FMath::Max(PeakDepth, Depth);
+	}
+};
+
+#if DC_STATS_ENABLED
+
+#define DC_STATS_ADD(StatsPtr, Field, Value) do { if (FDcStats* DcStats_ = (StatsPtr)) { DcStats_->Field += (Value); } } while (0)
+#define DC_STATS_ENTRY(StatsPtr, Entry) do { if (FDcStats* DcStats_ = (StatsPtr)) { DcStats_->AddEntry(Entry); } } while (0)
+#define DC_STATS_HANDLER(StatsPtr, Name, Depth) do { if (FDcStats* DcStats_ = (StatsPtr)) { DcStats_->AddHandlerCall(Name, Depth); } } while (0)
+
+#else
+
+#define DC_STATS_ADD(StatsPtr, Field, Value)
+#define DC_STATS_ENTRY(StatsPtr, Entry)
+#define DC_STATS_HANDLER(StatsPtr, Name, Depth)
+
+#endif // DC_STATS_ENABLED
+
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcMacros.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if !UE_VERSION_OLDER_THAN(4, 26, 0)
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#endif // !UE_VERSION_OLDER_THAN(4, 26, 0)
+
+///	Unreal Insights instrumentation. It's off unless the channel is enabled, e.g. `-trace=cpu,counters,DataConfig`
+///	 - a CPU scope per root deserialize/serialize named by the root struct/class
+///	 - a CPU scope per handler call named by the predicated handler name, or the struct/property class
+///	 - counters for bytes and tokens read, and container elements allocated by the property writer
+#ifndef DC_TRACE_ENABLED
+	#if !UE_VERSION_OLDER_THAN(4, 26, 0) && CPUPROFILERTRACE_ENABLED && COUNTERSTRACE_ENABLED
+		#define DC_TRACE_ENABLED 1
+	#else
+		#define DC_TRACE_ENABLED 0
+	#endif
+#endif
+
+#if DC_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(DataConfigChannel, DATACONFIGCORE_API);
+
+#define DC_TRACE_IS_ON() UE_TRACE_CHANNELEXPR_IS_ENABLED(DataConfigChannel)
+
+struct DATACONFIGCORE_API FDcTraceScope
+{
+	FORCEINLINE FDcTraceScope(const FName& Name)
+	{
+		if (DC_TRACE_IS_ON())
+			Begin(Name);
+	}
+
+	FORCEINLINE ~FDcTraceScope()
+	{
+		if (bActive)
+			FCpuProfilerTrace::OutputEndEvent();
+	}
+
+	bool bActive = false;
+
+private:
+	void Begin(const FName& Name);
+};
+
+#define DC_TRACE_SCOPE(Name) FDcTraceScope DC_UNIQUE(DcTraceScope_)(Name)
+#define DC_TRACE_COUNTER_ADD(Counter, Value) do { if (DC_TRACE_IS_ON()) { TRACE_COUNTER_ADD(Counter, Value); } } while (0)
+
+//	counters are only updated within core
+TRACE_DECLARE_INT_COUNTER_EXTERN(DcBytesRead);
+TRACE_DECLARE_INT_COUNTER_EXTERN(DcTokensRead);
+TRACE_DECLARE_INT_COUNTER_EXTERN(DcElementsAllocated);
+
+#else
+
+#define DC_TRACE_IS_ON() false
+#define DC_TRACE_SCOPE(Name)
+#define DC_TRACE_COUNTER_ADD(Counter, Value)
+
+#endif // DC_TRACE_ENABLED
+
@@ -3,10 +3,35 @@
 #include "CoreMinimal.h"
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Property/DcPropertyDatum.h"
+#include "UObject/WeakObjectPtr.h"
 
 struct FDcReader;
 struct FDcPropertyWriter;
 struct FDcDeserializer;
+struct FDcStats;
+
+///	Object references resolved by reference string, keyed by the class they're looked up with.
+///	Assign to `FDcDeserializeContext::ObjectCache` to skip repeated find/load calls on the same reference,
+///	and keep it around across contexts to share results between documents.
+struct DATACONFIGCORE_API FDcObjectResolveCache
+{
+	TMap<UClass*, TMap<FString, TWeakObjectPtr<UObject>>> Resolved;
+
+	//	type strings resolved to a class with custom rules, e.g Blueprint assets unwrapped to the generated class.
+	//	kept apart from `Resolved` as the same string looked up as an object can be a different object.
+	TMap<FString, TWeakObjectPtr<UClass>> ResolvedClasses;
+
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+
+	bool Find(UClass* Class, const FString& Str, UObject*& OutObject);
+	void Add(UClass* Class, const FString& Str, UObject* Object);
+
+	bool FindClass(const FString& Str, UClass*& OutClass);
+	void AddClass(const FString& Str, UClass* Class);
+
+	void Empty();
+};
 
 struct DATACONFIGCORE_API FDcDeserializeContext
 {
@@ -20,6 +45,8 @@ struct DATACONFIGCORE_API FDcDeserializeContext
 
 	EState State = EState::Uninitialized;
 	bool bSkipStructHandlers = false;
+	//	skip values of fields not found on target struct/class instead of failing
+	bool bIgnoreUnknownFields = false;
 
 	TArray<UObject*, TInlineAllocator<4>> Objects;
 	TArray<FFieldVariant, TInlineAllocator<8>> Properties;
@@ -28,8 +55,29 @@ struct DATACONFIGCORE_API FDcDeserializeContext
 	FDcReader* Reader = nullptr;
 	FDcPropertyWriter* Writer = nullptr;
 
+	//	optional, not owned
+	FDcObjectResolveCache* ObjectCache = nullptr;
+	//	optional, not owned, forwarded to reader and writer on `Prepare()`
+	FDcStats* Stats = nullptr;
+
 	void* UserData = nullptr;
 
+	//	containers opened by time sliced `FDcDeserializer::Deserialize`, kept across calls
+	struct FSliceFrame
+	{
+		enum class EType : uint8
+		{
+			Array,
+			Set,
+			Struct,
+			Class,
+		};
+
+		EType Type;
+		FDcClassAccess ClassAccess;
+	};
+	TArray<FSliceFrame, TInlineAllocator<8>> SliceFrames;
+
 	FORCEINLINE FFieldVariant& TopProperty()
 	{
 		checkf(Properties.Num(), TEXT("Expect TopProperty found none."));
@@ -45,6 +93,19 @@ struct DATACONFIGCORE_API FDcDeserializeContext
 	FDcResult Prepare();
 };
 
+///	Limits of a single time sliced `FDcDeserializer::Deserialize` call, zero means no limit
+struct FDcDeserializeBudget
+{
+	double Seconds = 0;
+	int32 Steps = 0;
+};
+
+enum class EDcDeserializeStatus : uint8
+{
+	InProgress,
+	Done,
+};
+
 using FDcDeserializeDelegateSignature = FDcResult(*)(FDcDeserializeContext& Ctx);
 DECLARE_DELEGATE_RetVal_OneParam(FDcResult, FDcDeserializeDelegate, FDcDeserializeContext&);
 
@@ -11,6 +11,10 @@ DATACONFIGCORE_API FDcResult RecursiveDeserialize(FDcDeserializeContext& Ctx);
 
 DATACONFIGCORE_API EDcDeserializePredicateResult PredicateIsRootProperty(FDcDeserializeContext& Ctx);
 
+///	Write field name to `Ctx.Writer`. With `Ctx.bIgnoreUnknownFields` a field that's not on the target
+///	has its value skipped on `Reader` and `bOutSkipped` set, caller should move on to next key.
+DATACONFIGCORE_API FDcResult WriteFieldNameOrSkip(FDcDeserializeContext& Ctx, FDcReader* Reader, const FName& FieldName, bool* bOutSkipped);
+
 } // namespace DcDeserializeUtils
 
 
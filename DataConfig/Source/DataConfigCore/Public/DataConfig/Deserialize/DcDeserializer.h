@@ -9,11 +9,23 @@ struct DATACONFIGCORE_API FDcDeserializer : public FNoncopyable
 {
 	FDcResult Deserialize(FDcDeserializeContext& Ctx);
 
+	///	Time sliced deserialize. Containers going to handlers added with `AddSliceableDirectHandler` are walked
+	///	with an explicit stack kept in `Ctx` and it returns with `InProgress` once `Budget` is used up. Call again
+	///	with the same context, reader and writer to resume until it's `Done`. Containers matched by a predicated,
+	///	struct or other direct handler, and all other values run through their handlers in one step.
+	FDcResult Deserialize(FDcDeserializeContext& Ctx, const FDcDeserializeBudget& Budget, EDcDeserializeStatus* OutStatus);
+
 	void AddDirectHandler(FFieldClass* PropertyClass, FDcDeserializeDelegate&& Delegate);
 	void AddDirectHandler(UClass* PropertyClass, FDcDeserializeDelegate&& Delegate);
 	void AddPredicatedHandler(FDcDeserializePredicate&& Predicate, FDcDeserializeDelegate&& Delegate, const FName Name = NAME_None);
 	void AddStructHandler(UStruct* Struct, FDcDeserializeDelegate&& Delegate);
 
+	///	Direct handler that time sliced `Deserialize` is allowed to bypass by walking the container itself.
+	///	Only for handlers reading and writing the same as `HandlerArrayDeserialize`, `HandlerArrayToSetDeserialize`,
+	///	`HandlerMapToStructDeserialize` and `HandlerMapToClassDeserialize` on array, set, struct and class.
+	void AddSliceableDirectHandler(FFieldClass* PropertyClass, FDcDeserializeDelegate&& Delegate);
+	void AddSliceableDirectHandler(UClass* PropertyClass, FDcDeserializeDelegate&& Delegate);
+
 	struct FPredicatedHandlerEntry
 	{
 		FDcDeserializePredicate Predicate;
@@ -25,5 +37,20 @@ struct DATACONFIGCORE_API FDcDeserializer : public FNoncopyable
 	TMap<UClass*, FDcDeserializeDelegate> UClassDeserializerMap;
 	TMap<FFieldClass*, FDcDeserializeDelegate> FieldClassDeserializerMap;
 	TMap<UStruct*, FDcDeserializeDelegate> StructDeserializeMap;
+
+	TSet<UClass*> SliceableUClasses;
+	TSet<FFieldClass*> SliceableFieldClasses;
+
+	///	Handlers not found here are looked up in `Parent`, which allows layering small per call
+	///	overrides on top of a shared deserializer. Predicated handlers here run before the parent ones.
+	FDcDeserializer* Parent = nullptr;
+
+	///	Flatten `Parent` into this and disallow adding handlers afterwards.
+	///	A frozen deserializer is read only and can be shared across threads.
+	void Freeze();
+	FORCEINLINE bool IsFrozen() const { return bFrozen; }
+
+private:
+	bool bFrozen = false;
 };
 
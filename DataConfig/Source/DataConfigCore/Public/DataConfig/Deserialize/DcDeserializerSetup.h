@@ -11,6 +11,10 @@ enum class EDcJsonDeserializeType
 
 DATACONFIGCORE_API void DcSetupJsonDeserializeHandlers(FDcDeserializer& Deserializer, EDcJsonDeserializeType Type = EDcJsonDeserializeType::Default);
 
+///	Shared deserializer set up with `DcSetupJsonDeserializeHandlers`, built on first call then frozen.
+///	Set it as `Parent` of a local deserializer to add per call handlers.
+DATACONFIGCORE_API FDcDeserializer& DcGetSharedJsonDeserializer(EDcJsonDeserializeType Type = EDcJsonDeserializeType::Default);
+
 DATACONFIGCORE_API void DcSetupPropertyPipeDeserializeHandlers(FDcDeserializer& Deserializer);
 
 enum class EDcMsgPackDeserializeType
@@ -22,5 +26,8 @@ enum class EDcMsgPackDeserializeType
 
 DATACONFIGCORE_API void DcSetupMsgPackDeserializeHandlers(FDcDeserializer& Deserializer, EDcMsgPackDeserializeType Type = EDcMsgPackDeserializeType::Default);
 
+///	Shared deserializer set up with `DcSetupMsgPackDeserializeHandlers`, built on first call then frozen.
+DATACONFIGCORE_API FDcDeserializer& DcGetSharedMsgPackDeserializer(EDcMsgPackDeserializeType Type = EDcMsgPackDeserializeType::Default);
+
 DATACONFIGCORE_API void DcSetupCoreTypesDeserializeHandlers(FDcDeserializer& Deserializer);
 
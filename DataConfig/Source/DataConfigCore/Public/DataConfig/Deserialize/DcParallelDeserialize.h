@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+#include "DataConfig/Property/DcPropertyDatum.h"
+#include "DataConfig/Json/DcJsonTape.h"
+
+struct FDcDeserializer;
+struct FDcDeserializeContext;
+
+///	Deserialize a document that's a single top level JSON array into the `TArray` at `ArrayDatum`.
+///	The array is sized up front, then items are split into contiguous ranges deserialized on task graph
+///	workers, each item with its own context, `TDcJsonTapeReader` and `FDcPropertyWriter` over its slot.
+///
+///	- `Deserializer` is shared across threads and must not be modified during the call.
+///	- `SetupContext` runs on worker threads, don't assign caches that aren't thread safe.
+///	- Handlers must be thread safe, e.g. no `NewObject` for instanced subobjects.
+///	- Worker diagnostics, warnings included, are merged into the caller env in item order.
+///	  On failure it stops at the lowest index failed item, which gets its index attached.
+///	  Items past a failed one may be skipped, so `ArrayDatum` is partially written.
+DATACONFIGCORE_API FDcResult DcParallelDeserializeJsonArray(
+	FDcDeserializer* Deserializer,
+	const FDcWideJsonTape& Tape,
+	FDcPropertyDatum ArrayDatum,
+	TFunctionRef<void(FDcDeserializeContext&)> SetupContext,
+	int32 MinItemsPerTask = 64);
+
+DATACONFIGCORE_API FDcResult DcParallelDeserializeJsonArray(
+	FDcDeserializer* Deserializer,
+	const FDcAnsiJsonTape& Tape,
+	FDcPropertyDatum ArrayDatum,
+	TFunctionRef<void(FDcDeserializeContext&)> SetupContext,
+	int32 MinItemsPerTask = 64);
+
+template<typename CharType>
+FORCEINLINE FDcResult DcParallelDeserializeJsonArray(
+	FDcDeserializer* Deserializer,
+	const TDcJsonTape<CharType>& Tape,
+	FDcPropertyDatum ArrayDatum)
+{
+	return DcParallelDeserializeJsonArray(Deserializer, Tape, ArrayDatum, [](FDcDeserializeContext&)
+	{
+		/*pass*/
+	});
+}
+
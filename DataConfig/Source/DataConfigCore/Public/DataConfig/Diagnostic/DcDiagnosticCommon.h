@@ -20,6 +20,10 @@ enum Type : uint16
 
 	CustomMessage,
 
+	//	File
+	FileOpenFailed,
+	FileReadFailed,
+
 	PlaceHoldError,
 };
 
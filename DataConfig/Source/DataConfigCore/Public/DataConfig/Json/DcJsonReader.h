@@ -128,6 +128,8 @@ struct TDcJsonReader : public FDcReader, private FNoncopyable
 	FDcResult ReadFloat(float* OutPtr) override;
 	FDcResult ReadDouble(double* OutPtr) override;
 
+	FDcResult SkipValue() override;
+
 	FDcResult ConsumeRawToken();
 	FDcResult ConsumeEffectiveToken();
 
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+#include "DataConfig/Json/DcJsonReader.h"
+
+///	Structural index of a JSON document. `Build` lexes the buffer in one pass and records every
+///	value as an entry, with containers pointing to their matching close and knowing their item count.
+///	Strings and numbers are classified by `FTokenFlag` but decoded only when read.
+///	The tape references the source buffer, which must outlive it.
+template<typename CharType>
+struct TDcJsonTape : private FNoncopyable
+{
+	using Lexer = TDcJsonReader<CharType>;
+	using ETokenType = typename Lexer::ETokenType;
+	using FTokenFlag = typename Lexer::FTokenFlag;
+
+	using SourceView = TDcSourceView<CharType>;
+	using SourceRef = TDcSourceRef<CharType>;
+
+	struct FEntry
+	{
+		ETokenType Type;
+		FTokenFlag Flag;
+
+		int32 Begin;
+		int32 Num;
+		int32 Line;
+
+		//	open: matching close index, close: matching open index, scalar: itself
+		int32 Match;
+		//	open: item count, key value pairs for objects
+		int32 Count;
+	};
+
+	SourceView Buf = {};
+	TArray<FEntry> Entries;
+	FString DiagFilePath;
+
+	FDcResult Build(const CharType* InStrPtr, int32 Num);
+	FORCEINLINE FDcResult Build(const CharType* InStrPtr) { return Build(InStrPtr, TCString<CharType>::Strlen(InStrPtr)); }
+
+	template<typename TArrayChar, typename TArrayAllocator>
+	FDcResult Build(const TArray<TArrayChar, TArrayAllocator>& InCharArr)
+	{
+		static_assert(DcTypeUtils::TIsSameSize<TArrayChar, CharType>::Value, "array element type isn't same size as this tape");
+		return Build((const CharType*)(InCharArr.GetData()), InCharArr.Num());
+	}
+
+	void Reset();
+
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+	FORCEINLINE bool IsContainer(int32 Ix) const
+	{
+		return Entries[Ix].Type == ETokenType::CurlyOpen
+			|| Entries[Ix].Type == ETokenType::SquareOpen;
+	}
+
+	///	Index right past the value starting at `Ix`, which is the next sibling in the parent container
+	FORCEINLINE int32 GetValueEnd(int32 Ix) const { return Entries[Ix].Match + 1; }
+
+	///	Collect entry indices of each item of the array starting at `ArrayIx`
+	void GetArrayItems(int32 ArrayIx, TArray<int32>& OutIxs) const;
+
+	FORCEINLINE SourceRef GetSourceRef(int32 Ix) const { return SourceRef{ &Buf, Entries[Ix].Begin, Entries[Ix].Num }; }
+};
+
+///	Read a single value on a `TDcJsonTape`, which defaults to the document root. Reading from
+///	an inner entry index gives random access to a subtree, e.g. one reader per array item.
+template<typename CharType>
+struct TDcJsonTapeReader : public FDcReader, private FNoncopyable
+{
+	using TTape = TDcJsonTape<CharType>;
+	using ETokenType = typename TTape::ETokenType;
+	using FEntry = typename TTape::FEntry;
+	using SourceRef = typename TTape::SourceRef;
+
+	TDcJsonTapeReader();
+	TDcJsonTapeReader(const TTape* InTape, int32 InRootIx = 0);
+
+	void SetTape(const TTape* InTape, int32 InRootIx = 0);
+
+	const TTape* Tape = nullptr;
+	int32 Cur = 0;
+	int32 End = 0;
+
+	enum class EParseState : uint8
+	{
+		Root,
+		Object,
+		Array,
+	};
+
+	struct FReadState
+	{
+		EParseState Type;
+		bool bObjectAtValue;
+
+		int32 Remain;
+	};
+	TArray<FReadState, TInlineAllocator<8>> States;
+
+	using FKeys = TArray<FString, TInlineAllocator<8>>;
+	TArray<FKeys, TInlineAllocator<8>> Keys;
+
+	FORCEINLINE FReadState& GetTopState() { return States.Top(); }
+	FORCEINLINE bool IsAtObjectKey() { return GetTopState().Type == EParseState::Object && !GetTopState().bObjectAtValue; }
+
+	FDcResult Coercion(EDcDataEntry ToEntry, bool* OutPtr) override;
+	FDcResult PeekRead(EDcDataEntry* OutPtr) override;
+
+	FDcResult ReadNone() override;
+	FDcResult ReadBool(bool* OutPtr) override;
+	FDcResult ReadName(FName* OutPtr) override;
+	FDcResult ReadString(FString* OutPtr) override;
+	FDcResult ReadText(FText* OutPtr) override;
+
+	FDcResult ReadMapRoot() override;
+	FDcResult ReadMapEnd() override;
+	FDcResult ReadArrayRoot() override;
+	FDcResult ReadArrayEnd() override;
+
+	FDcResult ReadInt8(int8* OutPtr) override;
+	FDcResult ReadInt16(int16* OutPtr) override;
+	FDcResult ReadInt32(int32* OutPtr) override;
+	FDcResult ReadInt64(int64* OutPtr) override;
+
+	FDcResult ReadUInt8(uint8* OutPtr) override;
+	FDcResult ReadUInt16(uint16* OutPtr) override;
+	FDcResult ReadUInt32(uint32* OutPtr) override;
+	FDcResult ReadUInt64(uint64* OutPtr) override;
+
+	FDcResult ReadFloat(float* OutPtr) override;
+	FDcResult ReadDouble(double* OutPtr) override;
+
+	FDcResult GetContainerSizeHint(int32* OutPtr) override;
+	FDcResult SkipValue() override;
+
+	FDcResult CheckEntry(EDcDataEntry Expect);
+	FDcResult CheckNotObjectKey();
+	FDcResult CheckObjectDuplicatedKey(const FString& Key);
+	FDcResult ParseStringEntry(FString& OutStr);
+
+	void EndValue(int32 NextIx);
+
+	FDcDiagnosticHighlight FormatHighlight(int32 EntryIx);
+	void FormatDiagnostic(FDcDiagnostic& Diag) override;
+
+	static FName ClassId();
+	FName GetId() override;
+};
+
+using FDcJsonTape = TDcJsonTape<TCHAR>;
+using FDcJsonTapeReader = TDcJsonTapeReader<TCHAR>;
+
+using FDcWideJsonTape = TDcJsonTape<WIDECHAR>;
+using FDcWideJsonTapeReader = TDcJsonTapeReader<WIDECHAR>;
+using FDcAnsiJsonTape = TDcJsonTape<ANSICHAR>;
+using FDcAnsiJsonTapeReader = TDcJsonTapeReader<ANSICHAR>;
+
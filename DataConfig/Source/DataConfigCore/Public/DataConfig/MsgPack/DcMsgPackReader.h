@@ -4,6 +4,7 @@
 #include "DataConfig/DcTypes.h"
 #include "DcMsgPackUtils.h"
 #include "DataConfig/Reader/DcReader.h"
+#include "Containers/StringView.h"
 
 struct DATACONFIGCORE_API FDcMsgPackReader : public FDcReader, private FNoncopyable
 {
@@ -34,10 +35,25 @@ struct DATACONFIGCORE_API FDcMsgPackReader : public FDcReader, private FNoncopya
 		uint8 LastTypeByte;
 
 		int Index;
+		//	index already counted into trace and stats bytes
+		int CountedIndex;
 		FORCEINLINE void Reset() { *this = FState{}; }
 	};
 	FState State = {};
 
+	//	direct mapped string bytes to `FName` cache for `ReadName`, as struct field names repeat a lot
+	struct FNameCacheEntry
+	{
+		uint32 Hash;
+		TArray<ANSICHAR, TInlineAllocator<32>> Chars;
+		FName Name;
+	};
+	static constexpr int32 NAME_CACHE_SIZE = 64;
+	TArray<FNameCacheEntry> NameCache;
+
+	//	upper bound of `GetContainerSizeHint`, writers grow past it as items are actually read
+	static constexpr int32 MAX_CONTAINER_SIZE_HINT = 1 << 16;
+
 	FDcResult PeekRead(EDcDataEntry* OutPtr) override;
 	FDcResult Coercion(EDcDataEntry ToEntry, bool* OutPtr) override;
 
@@ -67,8 +83,15 @@ struct DATACONFIGCORE_API FDcMsgPackReader : public FDcReader, private FNoncopya
 	FDcResult ReadFloat(float* OutPtr) override;
 	FDcResult ReadDouble(double* OutPtr) override;
 
+	FDcResult GetContainerSizeHint(int32* OutPtr) override;
+	FDcResult SkipValue() override;
+
 	FDcResult PeekTypeByte(uint8* OutPtr);
 
+	///	Read string as a view of its UTF8 bytes in `View`, no conversion nor allocation.
+	///	The view is valid as long as the underlying buffer is.
+	FDcResult ReadStringView(FAnsiStringView* OutPtr);
+
 	FDcResult ReadFixExt1(uint8* OutType, uint8* OutByte);
 	FDcResult ReadFixExt2(uint8* OutType, FDcBytes2* OutBytes);
 	FDcResult ReadFixExt4(uint8* OutType, FDcBytes4* OutBytes);
@@ -85,6 +85,8 @@ struct DATACONFIGCORE_API FDcPropertyReader : public FDcReader, private FNoncopy
 	FDcResult ReadDouble(double* OutPtr) override;
 	FDcResult ReadBlob(FDcBlobViewData* OutPtr) override;
 
+	FDcResult GetContainerSizeHint(int32* OutPtr) override;
+
 	///	try skip read at current position
 	FDcResult SkipRead();
 	///	peek next write property
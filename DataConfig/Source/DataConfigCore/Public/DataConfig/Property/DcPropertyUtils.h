@@ -46,6 +46,24 @@ DATACONFIGCORE_API FDcResult FindEffectivePropertyByOffset(UStruct* Struct, size
 DATACONFIGCORE_API EDcDataEntry PropertyToDataEntry(const FFieldVariant& Field);
 DATACONFIGCORE_API EDcDataEntry PropertyToDataEntry(FField* Property);
 
+///	Data entry of the last property queried, with scalar arrays as `ArrayRoot`.
+///	Property reader/writer states keep one for the field under cursor so repeated peeks are cheap.
+struct FDcPropertyEntryCache
+{
+	FField* Property = nullptr;
+	EDcDataEntry Entry = EDcDataEntry::Ended;
+
+	FORCEINLINE EDcDataEntry Get(FField* InProperty)
+	{
+		if (InProperty != Property)
+		{
+			Entry = IsScalarArray(InProperty) ? EDcDataEntry::ArrayRoot : PropertyToDataEntry(InProperty);
+			Property = InProperty;
+		}
+		return Entry;
+	}
+};
+
 DATACONFIGCORE_API FString FormatArrayTypeName(FProperty* InnerProperty);
 DATACONFIGCORE_API FString FormatSetTypeName(FProperty* InnerProperty);
 DATACONFIGCORE_API FString FormatMapTypeName(FProperty* KeyProperty, FProperty* ValueProperty);
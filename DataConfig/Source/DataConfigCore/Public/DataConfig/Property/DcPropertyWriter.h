@@ -82,10 +82,14 @@ struct DATACONFIGCORE_API FDcPropertyWriter : public FDcWriter, private FNoncopy
 	FDcResult WriteDouble(const double& Value) override;
 	FDcResult WriteBlob(const FDcBlobViewData& Value) override;
 
+	FDcResult ReserveContainer(int32 Num) override;
+
 	///	try skip write at current position
 	FDcResult SkipWrite();
 	///	get the next write property
 	FDcResult PeekWriteProperty(FFieldVariant* OutProperty);
+	///	check if struct/class at key position has a field named `Value`, always ok elsewhere
+	FDcResult PeekWriteName(const FName& Value, bool* bOutOk);
 	///	manual writing
 	FDcResult WriteDataEntry(FFieldClass* ExpectedPropertyClass, FDcPropertyDatum& OutDatum);
 
@@ -102,6 +106,7 @@ struct DATACONFIGCORE_API FDcPropertyWriter : public FDcWriter, private FNoncopy
 	TArray<DcPropertyWriterDetails::FWriteState, TInlineAllocator<4>> States;
 
 	FDcDiagnosticHighlight FormatHighlight();
+
 	void FormatDiagnostic(FDcDiagnostic& Diag) override;
 
 	static FName ClassId();
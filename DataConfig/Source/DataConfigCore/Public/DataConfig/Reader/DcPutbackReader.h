@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DataConfig/Reader/DcReader.h"
+#include "DataConfig/DcStats.h"
 #include "DataConfig/Misc/DcDataVariant.h"
 
 struct DATACONFIGCORE_API FDcPutbackReader : public FDcReader
@@ -60,6 +61,9 @@ struct DATACONFIGCORE_API FDcPutbackReader : public FDcReader
 
 	FDcResult ReadBlob(FDcBlobViewData* OutPtr) override;
 
+	FDcResult GetContainerSizeHint(int32* OutPtr) override;
+	FDcResult SkipValue() override;
+
 	template<typename T>
 	void Putback(T&& InValue);
 
@@ -78,5 +82,6 @@ template<typename T>
 void FDcPutbackReader::Putback(T&& InValue)
 {
 	Cached.Insert(Forward<T>(InValue), 0);
+	DC_STATS_ADD(Reader->Stats, Putbacks, 1);
 }
 
@@ -6,6 +6,7 @@
 #include "DataConfig/DcTypes.h"
 
 struct FDcDiagnostic;
+struct FDcStats;
 
 struct DATACONFIGCORE_API FDcReader
 {
@@ -97,6 +98,14 @@ struct DATACONFIGCORE_API FDcReader
 
 	virtual FDcResult ReadBlob(FDcBlobViewData* OutPtr);
 
+	///	Remaining item count of the container just read into, `INDEX_NONE` when unknown.
+	///	Only a hint for writers to reserve, defaults to unknown.
+	virtual FDcResult GetContainerSizeHint(int32* OutPtr);
+
+	///	Consume next value as a whole, including nested containers.
+	///	Defaults to peek and read through it, format readers override it to skip without decoding.
+	virtual FDcResult SkipValue();
+
 	virtual void FormatDiagnostic(FDcDiagnostic& Diag);
 
 	FORCEINLINE friend FDcDiagnostic& operator<<(FDcDiagnostic& Diag, FDcReader& Self)
@@ -118,6 +127,9 @@ struct DATACONFIGCORE_API FDcReader
 
 	template<typename T>
 	T* CastByIdChecked();
+
+	//	optional, not owned, usually set by context `Prepare()`
+	FDcStats* Stats = nullptr;
 };
 
 
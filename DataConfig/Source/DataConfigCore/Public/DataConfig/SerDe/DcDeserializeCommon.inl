@@ -14,6 +14,28 @@
 #include "UObject/Package.h"
 #include "Misc/EngineVersionComparison.h"
 
+FORCEINLINE bool DcFindCachedObject(FDcDeserializeContext& Ctx, UClass* Class, const FString& Str, UObject*& OutObject)
+{
+	return Ctx.ObjectCache && Ctx.ObjectCache->Find(Class, Str, OutObject);
+}
+
+FORCEINLINE void DcAddCachedObject(FDcDeserializeContext& Ctx, UClass* Class, const FString& Str, UObject* Object)
+{
+	if (Ctx.ObjectCache)
+		Ctx.ObjectCache->Add(Class, Str, Object);
+}
+
+FORCEINLINE bool DcFindCachedClass(FDcDeserializeContext& Ctx, const FString& Str, UClass*& OutClass)
+{
+	return Ctx.ObjectCache && Ctx.ObjectCache->FindClass(Str, OutClass);
+}
+
+FORCEINLINE void DcAddCachedClass(FDcDeserializeContext& Ctx, const FString& Str, UClass* Class)
+{
+	if (Ctx.ObjectCache)
+		Ctx.ObjectCache->AddClass(Str, Class);
+}
+
 FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& Ctx, FObjectPropertyBase* ObjectProperty, UObject*& OutObject)
 {
 	check(ObjectProperty);
@@ -25,6 +47,9 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 		FString Value;
 		DC_TRY(Ctx.Reader->ReadString(&Value));
 
+		if (DcFindCachedObject(Ctx, ObjectProperty->PropertyClass, Value, OutObject))
+			return DcOk();
+
 		if (!Value.StartsWith(TEXT("'"))
 			&& Value.EndsWith(TEXT("'")))
 		{
@@ -49,6 +74,7 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 				if (Loaded)
 				{
 					OutObject = Loaded;
+					DcAddCachedObject(Ctx, ObjectProperty->PropertyClass, Value, OutObject);
 					return DcOk();
 				}
 			}
@@ -59,10 +85,13 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 		}
 		else
 		{
-			return DcSerDeUtils::TryStaticLocateObject(
+			DC_TRY(DcSerDeUtils::TryStaticLocateObject(
 				ObjectProperty->PropertyClass,
 				*Value,
-				OutObject);
+				OutObject));
+
+			DcAddCachedObject(Ctx, ObjectProperty->PropertyClass, Value, OutObject);
+			return DcOk();
 		}
 	}
 	else if (Next == EDcDataEntry::MapRoot)
@@ -90,12 +119,28 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 		DC_TRY(Ctx.Reader->ReadMapEnd());
 
 		UClass* LoadClass;
-		DC_TRY(DcSerDeUtils::TryFindFirstObject<UClass>(*LoadClassName, true, LoadClass));
+		UObject* CachedClass;
+		if (DcFindCachedObject(Ctx, UClass::StaticClass(), LoadClassName, CachedClass))
+		{
+			LoadClass = Cast<UClass>(CachedClass);
+			if (LoadClass == nullptr)
+				return DC_FAIL(DcDSerDe, ClassLhsIsNotChildOfRhs)
+					<< CachedClass->GetClass()->GetFName() << UClass::StaticClass()->GetFName();
+		}
+		else
+		{
+			DC_TRY(DcSerDeUtils::TryFindFirstObject<UClass>(*LoadClassName, true, LoadClass));
+			DcAddCachedObject(Ctx, UClass::StaticClass(), LoadClassName, LoadClass);
+		}
 
 		DC_TRY(DcSerDeUtils::ExpectLhsChildOfRhs(LoadClass, ObjectProperty->PropertyClass));
 
 		UObject* Loaded;
-		DC_TRY(DcSerDeUtils::TryStaticLoadObject(LoadClass, nullptr, *LoadPath, Loaded));
+		if (!DcFindCachedObject(Ctx, LoadClass, LoadPath, Loaded))
+		{
+			DC_TRY(DcSerDeUtils::TryStaticLoadObject(LoadClass, nullptr, *LoadPath, Loaded));
+			DcAddCachedObject(Ctx, LoadClass, LoadPath, Loaded);
+		}
 
 		OutObject = Loaded;
 		return DcOk();
@@ -277,7 +322,11 @@ FORCEINLINE_DEBUGGABLE FDcResult DcDeserializeSoftClassReference(FDcDeserializeC
 FORCEINLINE_DEBUGGABLE FDcResult TryReadTypeStr(FDcDeserializeContext& Ctx, FObjectPropertyBase* ObjectProperty, const FString& TypeStr, UClass*& OutClass)
 {
 	UObject* Obj = nullptr;
-	DC_TRY(DcSerDeUtils::TryStaticLocateObject(UClass::StaticClass(), *TypeStr, Obj));
+	if (!DcFindCachedObject(Ctx, UClass::StaticClass(), TypeStr, Obj))
+	{
+		DC_TRY(DcSerDeUtils::TryStaticLocateObject(UClass::StaticClass(), *TypeStr, Obj));
+		DcAddCachedObject(Ctx, UClass::StaticClass(), TypeStr, Obj);
+	}
 	OutClass = Cast<UClass>(Obj);
 	return DcOk();
 }
@@ -376,17 +425,16 @@ FORCEINLINE_DEBUGGABLE FDcResult DcDeserializeInstancedSubObject(FDcDeserializeC
 	DC_TRY(PutbackReader.PeekRead(&CurPeek));
 	while (CurPeek != EDcDataEntry::MapEnd)
 	{
+		FName FieldName;
 		if (CurPeek == EDcDataEntry::Name)
 		{
-			FName Value;
-			DC_TRY(PutbackReader.ReadName(&Value));
-			DC_TRY(Ctx.Writer->WriteName(Value));
+			DC_TRY(PutbackReader.ReadName(&FieldName));
 		}
 		else if (CurPeek == EDcDataEntry::String)
 		{
 			FString Value;
 			DC_TRY(PutbackReader.ReadString(&Value));
-			DC_TRY(Ctx.Writer->WriteName(FName(*Value)));
+			FieldName = FName(*Value);
 		}
 		else
 		{
@@ -394,7 +442,10 @@ FORCEINLINE_DEBUGGABLE FDcResult DcDeserializeInstancedSubObject(FDcDeserializeC
 				<< EDcDataEntry::Name << EDcDataEntry::String << CurPeek;
 		}
 
-		DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
+		bool bSkipped;
+		DC_TRY(DcDeserializeUtils::WriteFieldNameOrSkip(Ctx, &PutbackReader, FieldName, &bSkipped));
+		if (!bSkipped)
+			DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
 
 		DC_TRY(PutbackReader.PeekRead(&CurPeek));
 	}
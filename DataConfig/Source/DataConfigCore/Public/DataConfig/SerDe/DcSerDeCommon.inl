@@ -2,6 +2,7 @@
 
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/SerDe/DcSerDeUtils.h"
+#include "DataConfig/SerDe/DcSerDeUtils.inl"
 
 template<typename TCtx>
 FORCEINLINE_DEBUGGABLE FDcResult DcHandlerPipeScalar(TCtx& Ctx)
@@ -27,6 +28,7 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeLinearContainer(
 {
 	DC_TRY((Ctx.Reader->*ReadMethodStart)());
 	DC_TRY((Ctx.Writer->*WriteMethodStart)());
+	DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
 
 	EDcDataEntry CurPeek;
 	while (true)
@@ -54,6 +56,7 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeMap(
 {
 	DC_TRY(Ctx.Reader->ReadMapRoot());
 	DC_TRY(Ctx.Writer->WriteMapRoot());
+	DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
 
 	EDcDataEntry CurPeek;
 	while (true)
@@ -82,6 +85,7 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeStringKeyMap(
 {
 	DC_TRY(Ctx.Reader->ReadMapRoot());
 	DC_TRY(Ctx.Writer->WriteMapRoot());
+	DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
 
 	EDcDataEntry CurPeek;
 	while (true)
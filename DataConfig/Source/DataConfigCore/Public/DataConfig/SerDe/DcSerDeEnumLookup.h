@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/WeakObjectPtr.h"
+
+///	Case sensitive `FString` keys, `TMap<FString, ...>` defaults to case insensitive
+template<typename TValue>
+struct TDcCaseSensitiveStringKeyFuncs : BaseKeyFuncs<TPair<FString, TValue>, FString, false>
+{
+	static FORCEINLINE const FString& GetSetKey(const TPair<FString, TValue>& Element) { return Element.Key; }
+	static FORCEINLINE bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static FORCEINLINE uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+};
+
+///	Per `UEnum` name/value lookup tables, built once on first use and shared by enum handlers.
+///	Name lookups are case insensitive, matching `UEnum::IsValidEnumName`.
+///	`AuthoredNames` are `GetAuthoredNameStringByIndex`, which are display names for `UUserDefinedEnum`.
+///	Authored name lookups are case sensitive, matching `FText::EqualTo` on display names.
+struct DATACONFIGCORE_API FDcEnumLookup
+{
+	TWeakObjectPtr<UEnum> Enum;
+	bool bIsBitFlags = false;
+
+	TArray<int64> Values;
+	TArray<FString> Names;
+	TArray<FString> AuthoredNames;
+
+	TMap<FString, int32> NameToIndex;
+	TMap<FString, int32, FDefaultSetAllocator, TDcCaseSensitiveStringKeyFuncs<int32>> AuthoredNameToIndex;
+	TMap<int64, int32> ValueToIndex;
+
+	FORCEINLINE int32 Num() const { return Values.Num(); }
+
+	FORCEINLINE int32 FindIndexByName(const FString& Name) const
+	{
+		const int32* IndexPtr = NameToIndex.Find(Name);
+		return IndexPtr ? *IndexPtr : INDEX_NONE;
+	}
+
+	FORCEINLINE int32 FindIndexByAuthoredName(const FString& Name) const
+	{
+		const int32* IndexPtr = AuthoredNameToIndex.Find(Name);
+		return IndexPtr ? *IndexPtr : INDEX_NONE;
+	}
+
+	FORCEINLINE int32 FindIndexByValue(int64 Value) const
+	{
+		const int32* IndexPtr = ValueToIndex.Find(Value);
+		return IndexPtr ? *IndexPtr : INDEX_NONE;
+	}
+
+	void Build(UEnum* InEnum);
+};
+
+using FDcEnumLookupRef = TSharedRef<const FDcEnumLookup, ESPMode::ThreadSafe>;
+
+namespace DcSerDeUtils
+{
+
+///	Find cached lookup or build one. Lookup gets rebuilt when the enum is reinstanced or its entry count changes.
+///	In editor lookups are also dropped when the enum is modified, e.g renaming `UUserDefinedEnum` entries.
+DATACONFIGCORE_API FDcEnumLookupRef FindOrBuildEnumLookup(UEnum* Enum);
+
+///	Drop cached lookup for `Enum`, or all lookups when passing `nullptr`.
+DATACONFIGCORE_API void InvalidateEnumLookup(UEnum* Enum = nullptr);
+
+///	Hook editor object change delegates to drop lookups of edited enums. Called by `DcStartUp/DcShutDown`.
+DATACONFIGCORE_API void RegisterEnumLookupHooks();
+DATACONFIGCORE_API void UnregisterEnumLookupHooks();
+
+} // namespace DcSerDeUtils
+
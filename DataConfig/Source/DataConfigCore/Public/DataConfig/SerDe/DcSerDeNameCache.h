@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+#include "Misc/ScopeRWLock.h"
+
+///	Memoized `FName` transform for key renaming handlers, e.g camelCase field names.
+///	Each name is transformed once and shared across calls and threads.
+///	 - `Transform` runs outside of the lock and can be called concurrently, it needs to be pure
+///	 - returned reference stays valid until `Reset()`
+///	 - keyed by display string, as `FName` equality is case insensitive `Url` and `URL` are cached separately
+template<typename TValue>
+struct TDcNameTransformCache : public FNoncopyable
+{
+	using FTransform = TFunction<TValue(const FName&)>;
+
+	explicit TDcNameTransformCache(FTransform InTransform)
+		: Transform(MoveTemp(InTransform))
+	{}
+
+	const TValue& Get(const FName& Name)
+	{
+		const uint64 Key = MakeKey(Name);
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (const TUniquePtr<TValue>* ValuePtr = Cache.Find(Key))
+				return **ValuePtr;
+		}
+
+		TUniquePtr<TValue> Value = MakeUnique<TValue>(Transform(Name));
+
+		FWriteScopeLock WriteLock(Lock);
+		//	first one wins when racing on the same name
+		if (const TUniquePtr<TValue>* ValuePtr = Cache.Find(Key))
+			return **ValuePtr;
+
+		return *Cache.Add(Key, MoveTemp(Value));
+	}
+
+	int32 Num() const
+	{
+		FReadScopeLock ReadLock(Lock);
+		return Cache.Num();
+	}
+
+	void Reset()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Cache.Empty();
+	}
+
+private:
+	FORCEINLINE static uint64 MakeKey(const FName& Name)
+	{
+		return ((uint64)Name.GetDisplayIndex().ToUnstableInt() << 32) | (uint32)Name.GetNumber();
+	}
+
+	FTransform Transform;
+	mutable FRWLock Lock;
+
+	//	values are boxed so references survive rehash
+	TMap<uint64, TUniquePtr<TValue>> Cache;
+};
+
+using FDcNameToStringCache = TDcNameTransformCache<FString>;
+using FDcNameToNameCache = TDcNameTransformCache<FName>;
+
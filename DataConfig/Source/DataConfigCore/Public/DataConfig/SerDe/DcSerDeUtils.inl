@@ -78,11 +78,23 @@ FORCEINLINE FDcResult DcPipe_StructEnd(TReader* Reader, TWriter* Writer)
 	return DcOk();
 }
 
+template<typename TReader, typename TWriter>
+FORCEINLINE FDcResult DcPipe_ContainerSizeHint(TReader* Reader, TWriter* Writer)
+{
+	//	let writer reserve up front when reader knows the container size
+	int32 SizeHint;
+	DC_TRY(Reader->GetContainerSizeHint(&SizeHint));
+	if (SizeHint > 0)
+		DC_TRY(Writer->ReserveContainer(SizeHint));
+	return DcOk();
+}
+
 template<typename TReader, typename TWriter>
 FORCEINLINE FDcResult DcPipe_MapRoot(TReader* Reader, TWriter* Writer)
 {
 	DC_TRY(Reader->ReadMapRoot());
 	DC_TRY(Writer->WriteMapRoot());
+	DC_TRY(DcPipe_ContainerSizeHint(Reader, Writer));
 	return DcOk();
 }
 
@@ -117,6 +129,7 @@ FORCEINLINE FDcResult DcPipe_ArrayRoot(TReader* Reader, TWriter* Writer)
 {
 	DC_TRY(Reader->ReadArrayRoot());
 	DC_TRY(Writer->WriteArrayRoot());
+	DC_TRY(DcPipe_ContainerSizeHint(Reader, Writer));
 	return DcOk();
 }
 
@@ -133,6 +146,7 @@ FORCEINLINE FDcResult DcPipe_SetRoot(TReader* Reader, TWriter* Writer)
 {
 	DC_TRY(Reader->ReadSetRoot());
 	DC_TRY(Writer->WriteSetRoot());
+	DC_TRY(DcPipe_ContainerSizeHint(Reader, Writer));
 	return DcOk();
 }
 
@@ -7,6 +7,7 @@
 struct FDcWriter;
 struct FDcPropertyReader;
 struct FDcSerializer;
+struct FDcStats;
 
 struct DATACONFIGCORE_API FDcSerializeContext
 {
@@ -26,6 +27,9 @@ struct DATACONFIGCORE_API FDcSerializeContext
 	FDcPropertyReader* Reader = nullptr;
 	FDcWriter* Writer = nullptr;
 
+	//	optional, not owned, forwarded to reader and writer on `Prepare()`
+	FDcStats* Stats = nullptr;
+
 	void* UserData = nullptr;
 
 	FORCEINLINE FFieldVariant& TopProperty()
@@ -24,6 +24,18 @@ struct DATACONFIGCORE_API FDcSerializer : public FNoncopyable
 	TMap<UClass*, FDcSerializeDelegate> UClassSerializerMap;
 	TMap<FFieldClass*, FDcSerializeDelegate> FieldClassSerializerMap;
 	TMap<UStruct*, FDcSerializeDelegate> StructSerializerMap;
+
+	///	Handlers not found here are looked up in `Parent`, which allows layering small per call
+	///	overrides on top of a shared serializer. Predicated handlers here run before the parent ones.
+	FDcSerializer* Parent = nullptr;
+
+	///	Flatten `Parent` into this and disallow adding handlers afterwards.
+	///	A frozen serializer is read only and can be shared across threads.
+	void Freeze();
+	FORCEINLINE bool IsFrozen() const { return bFrozen; }
+
+private:
+	bool bFrozen = false;
 };
 
 
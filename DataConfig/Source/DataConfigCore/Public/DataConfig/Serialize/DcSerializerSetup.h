@@ -11,6 +11,10 @@ enum class EDcJsonSerializeType
 
 DATACONFIGCORE_API void DcSetupJsonSerializeHandlers(FDcSerializer& Serializer, EDcJsonSerializeType Type = EDcJsonSerializeType::Default);
 
+///	Shared serializer set up with `DcSetupJsonSerializeHandlers`, built on first call then frozen.
+///	Set it as `Parent` of a local serializer to add per call handlers.
+DATACONFIGCORE_API FDcSerializer& DcGetSharedJsonSerializer(EDcJsonSerializeType Type = EDcJsonSerializeType::Default);
+
 DATACONFIGCORE_API void DcSetupPropertyPipeSerializeHandlers(FDcSerializer& Serializer);
 
 enum class EDcMsgPackSerializeType
@@ -22,5 +26,8 @@ enum class EDcMsgPackSerializeType
 
 DATACONFIGCORE_API void DcSetupMsgPackSerializeHandlers(FDcSerializer& Serializer, EDcMsgPackSerializeType Type = EDcMsgPackSerializeType::Default);
 
+///	Shared serializer set up with `DcSetupMsgPackSerializeHandlers`, built on first call then frozen.
+DATACONFIGCORE_API FDcSerializer& DcGetSharedMsgPackSerializer(EDcMsgPackSerializeType Type = EDcMsgPackSerializeType::Default);
+
 DATACONFIGCORE_API void DcSetupCoreTypesSerializeHandlers(FDcSerializer& Serializer);
 
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+#include "DataConfig/Source/DcSourceTypes.h"
+
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+
+///	File contents read with `IAsyncReadFileHandle`, all chunks are issued at once into a single buffer.
+///	Start sources of a file set up front then parse each one as it's ready, so disk IO of the rest
+///	overlaps with parsing. Readers need the whole buffer so `Wait()` before handing it to one.
+struct DATACONFIGCORE_API FDcAsyncFileSource : public FNoncopyable
+{
+	FDcAsyncFileSource() = default;
+	~FDcAsyncFileSource();
+
+	FDcResult Open(const FString& InPath, int64 ChunkSize = 1024 * 1024);
+
+	bool IsReady() const;
+	FDcResult Wait();
+	void Reset();
+
+	FORCEINLINE FDcBlobViewData GetBlob() const { return FDcBlobViewData::From(Buffer); }
+	///	UTF8 bytes with BOM skipped, for `FDcAnsiJsonReader`
+	FDcAnsiSourceBuffer GetAnsiSource() const;
+
+	FString Path;
+	TArray<uint8> Buffer;
+
+private:
+	IAsyncReadFileHandle* Handle = nullptr;
+	TArray<IAsyncReadRequest*> Requests;
+};
+
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DataConfig/Writer/DcWriter.h"
+#include "DataConfig/DcStats.h"
 
 struct DATACONFIGCORE_API FDcPutbackWriter : public FDcWriter
 {
@@ -59,8 +60,14 @@ struct DATACONFIGCORE_API FDcPutbackWriter : public FDcWriter
 
 	FDcResult WriteBlob(const FDcBlobViewData& Value) override;
 
+	FDcResult ReserveContainer(int32 Num) override;
+
 	void FormatDiagnostic(FDcDiagnostic& Diag) override;
-	void Putback(EDcDataEntry Entry) { Cached.Insert(Entry, 0); }
+	void Putback(EDcDataEntry Entry)
+	{
+		Cached.Insert(Entry, 0);
+		DC_STATS_ADD(Writer->Stats, Putbacks, 1);
+	}
 
 	TArray<EDcDataEntry> Cached;
 	FDcWriter* Writer;
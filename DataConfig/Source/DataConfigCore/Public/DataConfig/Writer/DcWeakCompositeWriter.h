@@ -55,6 +55,8 @@ struct DATACONFIGCORE_API FDcWeakCompositeWriter : public FDcWriter
 
 	FDcResult WriteBlob(const FDcBlobViewData& Value) override;
 
+	FDcResult ReserveContainer(int32 Num) override;
+
 	TArray<FDcWriter*, TInlineAllocator<4>> Writers;
 
 	void FormatDiagnostic(FDcDiagnostic& Diag) override;
@@ -5,6 +5,7 @@
 #include "DataConfig/DcTypes.h"
 
 struct FDcDiagnostic;
+struct FDcStats;
 
 struct DATACONFIGCORE_API FDcWriter
 {
@@ -92,6 +93,9 @@ struct DATACONFIGCORE_API FDcWriter
 
 	virtual FDcResult WriteBlob(const FDcBlobViewData& Value);
 
+	///	Hint that the container just written into is getting `Num` items, defaults to noop.
+	virtual FDcResult ReserveContainer(int32 Num);
+
 	virtual void FormatDiagnostic(FDcDiagnostic& Diag);
 
 	FORCEINLINE friend FDcDiagnostic& operator<<(FDcDiagnostic& Diag, FDcWriter& Self)
@@ -113,6 +117,9 @@ struct DATACONFIGCORE_API FDcWriter
 
 	template<typename T>
 	T* CastByIdChecked();
+
+	//	optional, not owned, usually set by context `Prepare()`
+	FDcStats* Stats = nullptr;
 };
 
 
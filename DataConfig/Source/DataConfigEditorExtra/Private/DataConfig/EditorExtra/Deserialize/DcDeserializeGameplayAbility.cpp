@@ -33,32 +33,37 @@ namespace DcEditorExtra
 namespace GameplayAbilityDetails
 {
 
-static TOptional<FDcDeserializer> GameplayAbilityDeserializer;
-
-static void LazyInitializeDeserializer()
+static FDcDeserializer& GetGameplayAbilityDeserializer()
 {
 	using namespace DcEngineExtra;
 
-	if (GameplayAbilityDeserializer.IsSet())
-		return;
-
-	GameplayAbilityDeserializer.Emplace();
-	DcSetupJsonDeserializeHandlers(GameplayAbilityDeserializer.GetValue());
-
-	GameplayAbilityDeserializer->FieldClassDeserializerMap[FClassProperty::StaticClass()] = FDcDeserializeDelegate::CreateStatic(HandlerBPClassReferenceDeserialize);
-
-	GameplayAbilityDeserializer->AddStructHandler(
-		FGameplayAttribute::StaticStruct(),
-		FDcDeserializeDelegate::CreateStatic(HandlerGameplayAttributeDeserialize)
-	);
-	GameplayAbilityDeserializer->AddStructHandler(
-		FGameplayTag::StaticStruct(),
-		FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagDeserialize)
-	);
-	GameplayAbilityDeserializer->AddStructHandler(
-		FGameplayTagContainer::StaticStruct(),
-		FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagContainerDeserialize)
-	);
+	static FDcDeserializer GameplayAbilityDeserializer;
+	static bool bInitialized = []
+	{
+		GameplayAbilityDeserializer.Parent = &DcGetSharedJsonDeserializer();
+
+		GameplayAbilityDeserializer.AddDirectHandler(FClassProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerBPClassReferenceDeserialize));
+
+		GameplayAbilityDeserializer.AddStructHandler(
+			FGameplayAttribute::StaticStruct(),
+			FDcDeserializeDelegate::CreateStatic(HandlerGameplayAttributeDeserialize)
+		);
+		FDcGameplayTagCacheRef TagCache = MakeShared<FDcGameplayTagCache, ESPMode::ThreadSafe>();
+		GameplayAbilityDeserializer.AddStructHandler(
+			FGameplayTag::StaticStruct(),
+			FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagDeserializeCached, TagCache)
+		);
+		GameplayAbilityDeserializer.AddStructHandler(
+			FGameplayTagContainer::StaticStruct(),
+			FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagContainerDeserializeCached, TagCache)
+		);
+
+		GameplayAbilityDeserializer.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
+
+	return GameplayAbilityDeserializer;
 }
 
 } // namespace GameplayAbilityDetails
@@ -99,33 +104,30 @@ FDcResult DeserializeGameplayAbility(UGameplayAbility* Instance, FDcReader& Read
 {
 	using namespace GameplayAbilityDetails;
 
-	LazyInitializeDeserializer();
-
 	FDcPropertyWriter Writer(FDcPropertyDatum(UGameplayAbility::StaticClass(), Instance));
 
 	FDcDeserializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Deserializer = &GameplayAbilityDeserializer.GetValue();
+	Ctx.Deserializer = &GetGameplayAbilityDeserializer();
 	DC_TRY(Ctx.Prepare());
 
-	return GameplayAbilityDeserializer->Deserialize(Ctx);
+	return Ctx.Deserializer->Deserialize(Ctx);
 }
 
 FDcResult DeserializeGameplayEffect(UGameplayEffect* Instance, FDcReader& Reader)
 {
 	using namespace GameplayAbilityDetails;
-	LazyInitializeDeserializer();
 
 	FDcPropertyWriter Writer(FDcPropertyDatum(UGameplayEffect::StaticClass(), Instance));
 
 	FDcDeserializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Deserializer = &GameplayAbilityDeserializer.GetValue();
+	Ctx.Deserializer = &GetGameplayAbilityDeserializer();
 	DC_TRY(Ctx.Prepare());
 
-	return GameplayAbilityDeserializer->Deserialize(Ctx);
+	return Ctx.Deserializer->Deserialize(Ctx);
 }
 
 static FDcResult SelectJSONAndLoadIntoBlueprintCDO(FAssetData Asset, TFunctionRef<FDcResult(UBlueprint*, FDcReader& Reader)> DeserializeFunc)
@@ -302,6 +304,8 @@ DC_TEST("DataConfig.EditorExtra.GameplayAbility")
 	UTEST_OK("Editor Extra UGameplayAbility Deserialize", DcEditorExtra::DeserializeGameplayAbility(TmpAbility, Reader));
 
 	UTEST_TRUE("Editor Extra UGameplayAbility Deserialize", TmpAbility->GetReplicationPolicy() == EGameplayAbilityReplicationPolicy::ReplicateYes);
+	//	resolved by the class property handler layered on the shared deserializer
+	UTEST_NOT_NULL("Editor Extra UGameplayAbility Deserialize", TmpAbility->GetCostGameplayEffect());
 	UTEST_TRUE("Editor Extra UGameplayAbility Deserialize", TmpAbility->GetInstancingPolicy() == EGameplayAbilityInstancingPolicy::NonInstanced);
 
 	UTEST_TRUE("Editor Extra UGameplayAbility Deserialize", TmpAbility->AbilityTags.HasTagExact(
@@ -51,24 +51,14 @@
 namespace DcJsonBlueprintLibraryDetails
 {
 
-static TOptional<FDcSerializer> BPValueSerializer;
-static TOptional<FDcSerializer> BPObjectSerializer;
-
-static TOptional<FDcDeserializer> BPValueDeserializer;
-static TOptional<FDcDeserializer> BPObjectDeserializer;
-
-static void LazyInitializeSerializer(TOptional<FDcSerializer>& Serializer, bool bRoot)
+static void SetupSerializer(FDcSerializer& Serializer, bool bRoot)
 {
-	if (Serializer.IsSet())
-		return;
-
-	Serializer.Emplace();
-	DcSetupJsonSerializeHandlers(Serializer.GetValue());
-	DcSetupCoreTypesSerializeHandlers(Serializer.GetValue());
+	DcSetupJsonSerializeHandlers(Serializer);
+	DcSetupCoreTypesSerializeHandlers(Serializer);
 
 	if (bRoot)
 	{
-		Serializer->AddPredicatedHandler(
+		Serializer.AddPredicatedHandler(
 			FDcSerializePredicate::CreateStatic(DcSerializeUtils::PredicateIsRootProperty),
 			FDcSerializeDelegate::CreateStatic(DcCommonHandlers::HandlerClassToMapSerialize)
 		);
@@ -79,40 +69,40 @@ static void LazyInitializeSerializer(TOptional<FDcSerializer>& Serializer, bool
 		using namespace DcExtra;
 
 #if WITH_EDITORONLY_DATA
-		Serializer->AddPredicatedHandler(FDcSerializePredicate::CreateStatic(PredicateIsBase64Blob), FDcSerializeDelegate::CreateStatic(HandleBase64BlobSerialize));
+		Serializer.AddPredicatedHandler(FDcSerializePredicate::CreateStatic(PredicateIsBase64Blob), FDcSerializeDelegate::CreateStatic(HandleBase64BlobSerialize));
 #endif // WITH_EDITORONLY_DATA
 
-		Serializer->AddStructHandler(TBaseStructure<FDcAnyStruct>::Get(), FDcSerializeDelegate::CreateStatic(HandlerDcAnyStructSerialize));
+		Serializer.AddStructHandler(TBaseStructure<FDcAnyStruct>::Get(), FDcSerializeDelegate::CreateStatic(HandlerDcAnyStructSerialize));
 
 		using Inline64 = TDcInlineStructSerialize<FDcInlineStruct64>;
-		Serializer->AddStructHandler(Inline64::StaticStruct(), FDcSerializeDelegate::CreateStatic(Inline64::HandlerDcInlineStructSerialize));
+		Serializer.AddStructHandler(Inline64::StaticStruct(), FDcSerializeDelegate::CreateStatic(Inline64::HandlerDcInlineStructSerialize));
 
 		using Inline128 = TDcInlineStructSerialize<FDcInlineStruct128>;
-		Serializer->AddStructHandler(Inline128::StaticStruct(), FDcSerializeDelegate::CreateStatic(Inline128::HandlerDcInlineStructSerialize));
+		Serializer.AddStructHandler(Inline128::StaticStruct(), FDcSerializeDelegate::CreateStatic(Inline128::HandlerDcInlineStructSerialize));
 
 		using Inline256 = TDcInlineStructSerialize<FDcInlineStruct256>;
-		Serializer->AddStructHandler(Inline256::StaticStruct(), FDcSerializeDelegate::CreateStatic(Inline256::HandlerDcInlineStructSerialize));
+		Serializer.AddStructHandler(Inline256::StaticStruct(), FDcSerializeDelegate::CreateStatic(Inline256::HandlerDcInlineStructSerialize));
 
 		using Inline512 = TDcInlineStructSerialize<FDcInlineStruct512>;
-		Serializer->AddStructHandler(Inline512::StaticStruct(), FDcSerializeDelegate::CreateStatic(Inline512::HandlerDcInlineStructSerialize));
+		Serializer.AddStructHandler(Inline512::StaticStruct(), FDcSerializeDelegate::CreateStatic(Inline512::HandlerDcInlineStructSerialize));
 	}
 
 	//	EngineExtra
 	{
 		using namespace DcEngineExtra;
 
-		Serializer->FieldClassSerializerMap[FClassProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerBPClassReferenceSerialize);
-		Serializer->FieldClassSerializerMap[FObjectProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerBPObjectReferenceSerialize);
-		Serializer->FieldClassSerializerMap[FStructProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerBPStructSerialize);
+		Serializer.FieldClassSerializerMap[FClassProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerBPClassReferenceSerialize);
+		Serializer.FieldClassSerializerMap[FObjectProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerBPObjectReferenceSerialize);
+		Serializer.FieldClassSerializerMap[FStructProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerBPStructSerialize);
 
-		Serializer->PredicatedSerializers.FindByPredicate([](auto& Entry){
+		Serializer.PredicatedSerializers.FindByPredicate([](auto& Entry){
 			return Entry.Name == FName(TEXT("Enum"));
 		})->Handler = FDcSerializeDelegate::CreateStatic(HandlerBPEnumSerialize);
 
-		Serializer->AddDirectHandler(UUserDefinedStruct::StaticClass(), FDcSerializeDelegate::CreateStatic(HandlerBPStructSerialize));
+		Serializer.AddDirectHandler(UUserDefinedStruct::StaticClass(), FDcSerializeDelegate::CreateStatic(HandlerBPStructSerialize));
 
-		Serializer->AddStructHandler(TBaseStructure<FGameplayTag>::Get(), FDcSerializeDelegate::CreateStatic(HandlerGameplayTagSerialize));
-		Serializer->AddStructHandler(TBaseStructure<FGameplayTagContainer>::Get(), FDcSerializeDelegate::CreateStatic(HandlerGameplayTagContainerSerialize));
+		Serializer.AddStructHandler(TBaseStructure<FGameplayTag>::Get(), FDcSerializeDelegate::CreateStatic(HandlerGameplayTagSerialize));
+		Serializer.AddStructHandler(TBaseStructure<FGameplayTagContainer>::Get(), FDcSerializeDelegate::CreateStatic(HandlerGameplayTagContainerSerialize));
 	}
 
 #if ENGINE_MAJOR_VERSION == 5
@@ -120,24 +110,19 @@ static void LazyInitializeSerializer(TOptional<FDcSerializer>& Serializer, bool
 	{
 		using namespace DcExtra;
 
-		Serializer->AddStructHandler(TBaseStructure<FInstancedStruct>::Get(), FDcSerializeDelegate::CreateStatic(HandlerInstancedStructSerialize));
+		Serializer.AddStructHandler(TBaseStructure<FInstancedStruct>::Get(), FDcSerializeDelegate::CreateStatic(HandlerInstancedStructSerialize));
 	}
 #endif // ENGINE_MAJOR_VERSION == 5
-
 }
 
-static void LazyInitializeDeserializer(TOptional<FDcDeserializer>& Deserializer, bool bRoot)
+static void SetupDeserializer(FDcDeserializer& Deserializer, bool bRoot)
 {
-	if (Deserializer.IsSet())
-		return;
-
-	Deserializer.Emplace();
-	DcSetupJsonDeserializeHandlers(Deserializer.GetValue());
-	DcSetupCoreTypesDeserializeHandlers(Deserializer.GetValue());
+	DcSetupJsonDeserializeHandlers(Deserializer);
+	DcSetupCoreTypesDeserializeHandlers(Deserializer);
 
 	if (bRoot)
 	{
-		Deserializer->AddPredicatedHandler(
+		Deserializer.AddPredicatedHandler(
 			FDcDeserializePredicate::CreateStatic(DcDeserializeUtils::PredicateIsRootProperty),
 			FDcDeserializeDelegate::CreateStatic(DcCommonHandlers::HandlerMapToClassDeserialize)
 		);
@@ -148,39 +133,40 @@ static void LazyInitializeDeserializer(TOptional<FDcDeserializer>& Deserializer,
 		using namespace DcExtra;
 
 #if WITH_EDITORONLY_DATA
-		Deserializer->AddPredicatedHandler(FDcDeserializePredicate::CreateStatic(PredicateIsBase64Blob), FDcDeserializeDelegate::CreateStatic(HandleBase64BlobDeserialize));
+		Deserializer.AddPredicatedHandler(FDcDeserializePredicate::CreateStatic(PredicateIsBase64Blob), FDcDeserializeDelegate::CreateStatic(HandleBase64BlobDeserialize));
 #endif // WITH_EDITORONLY_DATA
 
-		Deserializer->AddStructHandler(TBaseStructure<FDcAnyStruct>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerDcAnyStructDeserialize));
+		Deserializer.AddStructHandler(TBaseStructure<FDcAnyStruct>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerDcAnyStructDeserialize));
 
 		using Inline64 = TDcInlineStructDeserialize<FDcInlineStruct64>;
-		Deserializer->AddStructHandler(Inline64::StaticStruct(), FDcDeserializeDelegate::CreateStatic(Inline64::HandlerDcInlineStructDeserialize));
+		Deserializer.AddStructHandler(Inline64::StaticStruct(), FDcDeserializeDelegate::CreateStatic(Inline64::HandlerDcInlineStructDeserialize));
 
 		using Inline128 = TDcInlineStructDeserialize<FDcInlineStruct128>;
-		Deserializer->AddStructHandler(Inline128::StaticStruct(), FDcDeserializeDelegate::CreateStatic(Inline128::HandlerDcInlineStructDeserialize));
+		Deserializer.AddStructHandler(Inline128::StaticStruct(), FDcDeserializeDelegate::CreateStatic(Inline128::HandlerDcInlineStructDeserialize));
 
 		using Inline256 = TDcInlineStructDeserialize<FDcInlineStruct256>;
-		Deserializer->AddStructHandler(Inline256::StaticStruct(), FDcDeserializeDelegate::CreateStatic(Inline256::HandlerDcInlineStructDeserialize));
+		Deserializer.AddStructHandler(Inline256::StaticStruct(), FDcDeserializeDelegate::CreateStatic(Inline256::HandlerDcInlineStructDeserialize));
 
 		using Inline512 = TDcInlineStructDeserialize<FDcInlineStruct512>;
-		Deserializer->AddStructHandler(Inline512::StaticStruct(), FDcDeserializeDelegate::CreateStatic(Inline512::HandlerDcInlineStructDeserialize));
+		Deserializer.AddStructHandler(Inline512::StaticStruct(), FDcDeserializeDelegate::CreateStatic(Inline512::HandlerDcInlineStructDeserialize));
 	}
 
 	//	EngineExtra
 	{
 		using namespace DcEngineExtra;
 
-		Deserializer->FieldClassDeserializerMap[FClassProperty::StaticClass()] = FDcDeserializeDelegate::CreateStatic(HandlerBPClassReferenceDeserialize);
-		Deserializer->FieldClassDeserializerMap[FObjectProperty::StaticClass()] = FDcDeserializeDelegate::CreateStatic(HandlerBPObjectReferenceDeserialize);
+		Deserializer.FieldClassDeserializerMap[FClassProperty::StaticClass()] = FDcDeserializeDelegate::CreateStatic(HandlerBPClassReferenceDeserialize);
+		Deserializer.FieldClassDeserializerMap[FObjectProperty::StaticClass()] = FDcDeserializeDelegate::CreateStatic(HandlerBPObjectReferenceDeserialize);
 
-		Deserializer->PredicatedDeserializers.FindByPredicate([](auto& Entry){
+		Deserializer.PredicatedDeserializers.FindByPredicate([](auto& Entry){
 			return Entry.Name == FName(TEXT("Enum"));
 		})->Handler = FDcDeserializeDelegate::CreateStatic(HandlerBPEnumDeserialize);
 
-		Deserializer->AddDirectHandler(UUserDefinedStruct::StaticClass(), FDcDeserializeDelegate::CreateStatic(DcCommonHandlers::HandlerMapToStructDeserialize));
+		Deserializer.AddDirectHandler(UUserDefinedStruct::StaticClass(), FDcDeserializeDelegate::CreateStatic(DcCommonHandlers::HandlerMapToStructDeserialize));
 
-		Deserializer->AddStructHandler(TBaseStructure<FGameplayTag>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagDeserialize));
-		Deserializer->AddStructHandler(TBaseStructure<FGameplayTagContainer>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagContainerDeserialize));
+		FDcGameplayTagCacheRef TagCache = MakeShared<FDcGameplayTagCache, ESPMode::ThreadSafe>();
+		Deserializer.AddStructHandler(TBaseStructure<FGameplayTag>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagDeserializeCached, TagCache));
+		Deserializer.AddStructHandler(TBaseStructure<FGameplayTagContainer>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagContainerDeserializeCached, TagCache));
 	}
 
 #if ENGINE_MAJOR_VERSION == 5
@@ -188,11 +174,45 @@ static void LazyInitializeDeserializer(TOptional<FDcDeserializer>& Deserializer,
 	{
 		using namespace DcExtra;
 
-		Deserializer->AddStructHandler(TBaseStructure<FInstancedStruct>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerInstancedStructDeserialize));
+		Deserializer.AddStructHandler(TBaseStructure<FInstancedStruct>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerInstancedStructDeserialize));
 	}
 #endif // ENGINE_MAJOR_VERSION == 5
 }
 
+//	built once and frozen, shared by all blueprint calls
+static FDcSerializer& GetSerializer(bool bRoot)
+{
+	static FDcSerializer ValueSerializer;
+	static FDcSerializer ObjectSerializer;
+	static bool bInitialized = []
+	{
+		SetupSerializer(ValueSerializer, false);
+		ValueSerializer.Freeze();
+		SetupSerializer(ObjectSerializer, true);
+		ObjectSerializer.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
+
+	return bRoot ? ObjectSerializer : ValueSerializer;
+}
+
+static FDcDeserializer& GetDeserializer(bool bRoot)
+{
+	static FDcDeserializer ValueDeserializer;
+	static FDcDeserializer ObjectDeserializer;
+	static bool bInitialized = []
+	{
+		SetupDeserializer(ValueDeserializer, false);
+		ValueDeserializer.Freeze();
+		SetupDeserializer(ObjectDeserializer, true);
+		ObjectDeserializer.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
+
+	return bRoot ? ObjectDeserializer : ValueDeserializer;
+}
 
 static bool _BlueprintLibPropertyPredicate(FProperty* Property)
 {
@@ -235,10 +255,8 @@ FDcPropertyConfig MakeBPPropertyConfig()
 	return Ret;
 }
 
-static FDcResult _Dump(bool bRoot, TOptional<FDcSerializer>& Serializer, FDcPropertyDatum Datum, FString& OutJsonString)
+static FDcResult _Dump(bool bRoot, FDcPropertyDatum Datum, FString& OutJsonString)
 {
-	LazyInitializeSerializer(Serializer, bRoot);
-
 	FDcPropertyReader Reader(Datum);
 	DC_TRY(Reader.SetConfig(MakeBPPropertyConfig()));
 
@@ -247,7 +265,7 @@ static FDcResult _Dump(bool bRoot, TOptional<FDcSerializer>& Serializer, FDcProp
 	FDcSerializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Serializer = &Serializer.GetValue();
+	Ctx.Serializer = &GetSerializer(bRoot);
 
 	DC_TRY(Ctx.Prepare());
 	DC_TRY(Ctx.Serializer->Serialize(Ctx));
@@ -256,10 +274,8 @@ static FDcResult _Dump(bool bRoot, TOptional<FDcSerializer>& Serializer, FDcProp
 	return DcOk();
 }
 
-static FDcResult _Load(bool bRoot, TOptional<FDcDeserializer>& Deserializer, FDcPropertyDatum Datum, const FString& InJsonString)
+static FDcResult _Load(bool bRoot, FDcPropertyDatum Datum, const FString& InJsonString)
 {
-	LazyInitializeDeserializer(Deserializer, bRoot);
-
 	FDcJsonReader Reader(InJsonString);
 
 	FDcPropertyWriter Writer(Datum);
@@ -268,7 +284,7 @@ static FDcResult _Load(bool bRoot, TOptional<FDcDeserializer>& Deserializer, FDc
 	FDcDeserializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Deserializer = &Deserializer.GetValue();
+	Ctx.Deserializer = &GetDeserializer(bRoot);
 
 	DC_TRY(Ctx.Prepare());
 	DC_TRY(Ctx.Deserializer->Deserialize(Ctx));
@@ -304,7 +320,7 @@ DEFINE_FUNCTION(UDcJsonBlueprintLibrary::execDumpValue)
 
 		P_NATIVE_BEGIN
 		bResult = _Dump(
-			false, BPValueSerializer,
+			false,
 			FDcPropertyDatum(ValueProperty, ValuePtr),
 			OutJsonString
 		).Ok();
@@ -341,7 +357,7 @@ DEFINE_FUNCTION(UDcJsonBlueprintLibrary::execDumpObject)
 
 		P_NATIVE_BEGIN
 		bResult = _Dump(
-			true, BPObjectSerializer,
+			true,
 			FDcPropertyDatum(Obj),
 			OutJsonString
 		).Ok();
@@ -381,7 +397,7 @@ DEFINE_FUNCTION(UDcJsonBlueprintLibrary::execLoadValue)
 
 		P_NATIVE_BEGIN
 		bResult = _Load(
-			false, BPValueDeserializer,
+			false,
 			FDcPropertyDatum(ValueProperty, ValuePtr),
 			InJsonString
 		).Ok();
@@ -419,7 +435,7 @@ DEFINE_FUNCTION(UDcJsonBlueprintLibrary::execLoadObject)
 
 		P_NATIVE_BEGIN
 		bResult = _Load(
-			true, BPObjectDeserializer,
+			true,
 			FDcPropertyDatum(Obj),
 			InJsonString
 		).Ok();
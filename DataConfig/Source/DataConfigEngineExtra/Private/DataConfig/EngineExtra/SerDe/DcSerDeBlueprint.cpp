@@ -3,6 +3,7 @@
 #include "DataConfig/Reader/DcReader.h"
 #include "DataConfig/Property/DcPropertyWriter.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
+#include "DataConfig/SerDe/DcSerDeEnumLookup.h"
 #include "DataConfig/Deserialize/DcDeserializer.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
@@ -81,6 +82,9 @@ static FDcResult TryReadObjectReferenceWithBP(FDcDeserializeContext& Ctx, FPrope
 		FString Value;
 		DC_TRY(Ctx.Reader->ReadString(&Value));
 
+		if (DcFindCachedObject(Ctx, PropertyClass, Value, OutObject))
+			return DcOk();
+
 		if (!Value.StartsWith(TEXT("'"))
 			&& Value.EndsWith(TEXT("'")))
 		{
@@ -104,6 +108,7 @@ static FDcResult TryReadObjectReferenceWithBP(FDcDeserializeContext& Ctx, FPrope
 				if (Loaded)
 				{
 					OutObject = Loaded;
+					DcAddCachedObject(Ctx, PropertyClass, Value, OutObject);
 					return DcOk();
 				}
 			}
@@ -114,10 +119,13 @@ static FDcResult TryReadObjectReferenceWithBP(FDcDeserializeContext& Ctx, FPrope
 		}
 		else
 		{
-			return DcSerDeUtils::TryStaticLocateObject(
+			DC_TRY(DcSerDeUtils::TryStaticLocateObject(
 				PropertyClass,
 				Value,
-				OutObject);
+				OutObject));
+
+			DcAddCachedObject(Ctx, PropertyClass, Value, OutObject);
+			return DcOk();
 		}
 	}
 	else if (Next == EDcDataEntry::MapRoot)
@@ -144,15 +152,25 @@ static FDcResult TryReadObjectReferenceWithBP(FDcDeserializeContext& Ctx, FPrope
 		DC_TRY(Ctx.Reader->ReadString(&LoadPath));
 		DC_TRY(Ctx.Reader->ReadMapEnd());
 
+		//	`$type` here can also name a Blueprint, the unwrapped class goes into the class cache
+		//	as object lookups on the same string resolve to the `UBlueprint` asset
 		UClass* LoadClass;
-		UObject* Obj;
-		DC_TRY(DcSerDeUtils::TryStaticLocateObject(UObject::StaticClass(), LoadClassName, Obj));
-		DC_TRY(_TryUnwrapClassObject(Obj, LoadClass));
+		if (!DcFindCachedClass(Ctx, LoadClassName, LoadClass))
+		{
+			UObject* Obj;
+			DC_TRY(DcSerDeUtils::TryStaticLocateObject(UObject::StaticClass(), LoadClassName, Obj));
+			DC_TRY(_TryUnwrapClassObject(Obj, LoadClass));
+			DcAddCachedClass(Ctx, LoadClassName, LoadClass);
+		}
 
 		DC_TRY(DcSerDeUtils::ExpectLhsChildOfRhs(LoadClass, PropertyClass));
 
 		UObject* Loaded;
-		DC_TRY(DcSerDeUtils::TryStaticLoadObject(LoadClass, nullptr, *LoadPath, Loaded));
+		if (!DcFindCachedObject(Ctx, LoadClass, LoadPath, Loaded))
+		{
+			DC_TRY(DcSerDeUtils::TryStaticLoadObject(LoadClass, nullptr, *LoadPath, Loaded));
+			DcAddCachedObject(Ctx, LoadClass, LoadPath, Loaded);
+		}
 
 		OutObject = Loaded;
 		return DcOk();
@@ -319,49 +337,27 @@ FDcResult HandlerBPEnumDeserialize(FDcDeserializeContext& Ctx)
 		return DcOk();
 	}
 
-	UUserDefinedEnum* BPEnum = Cast<UUserDefinedEnum>(Enum);
-	auto _FindBPEnumBranch = [BPEnum](const FString Str) -> FName
+	//	`UUserDefinedEnum` reads authored display names
+	bool bIsBPEnum = Enum->IsA<UUserDefinedEnum>();
+	FDcEnumLookupRef Lookup = DcSerDeUtils::FindOrBuildEnumLookup(Enum);
+	auto _FindIndex = [&Lookup, bIsBPEnum](const FString& Str)
 	{
-		check(BPEnum);
-		FText StrText = FText::FromString(Str);
-		for (auto& Pair : BPEnum->DisplayNameMap)
-		{
-			if (Pair.Value.EqualTo(StrText))
-				return Pair.Key;
-		}
-
-		return FName(NAME_None);
+		return bIsBPEnum
+			? Lookup->FindIndexByAuthoredName(Str)
+			: Lookup->FindIndexByName(Str);
 	};
 
-	bool bIsBitFlags;
-
-#if WITH_EDITORONLY_DATA
-#if WITH_METADATA
-	bIsBitFlags = Enum->HasMetaData(TEXT("Bitflags"));
-#else
-	//	Program target is missing `UEnum::HasMetaData`
-	bIsBitFlags = ((UField*)Enum)->HasMetaData(TEXT("Bitflags"));
-#endif // WITH_METADATA
-#else
-	bIsBitFlags = false;
-#endif // WITH_EDITORONLY_DATA
-
-	if (!bIsBitFlags)
+	if (!Lookup->bIsBitFlags)
 	{
 		FString Value;
 		DC_TRY(Ctx.Reader->ReadString(&Value));
 
-		FName ValueName{NoInit};
-		if (BPEnum)
-			ValueName = FName(BPEnum->GenerateFullEnumName(*_FindBPEnumBranch(Value).ToString()));
-		else
-			ValueName = FName(Enum->GenerateFullEnumName(*Value));
-
-		if (!Enum->IsValidEnumName(ValueName))
+		int Index = _FindIndex(Value);
+		if (Index == INDEX_NONE)
 			return DC_FAIL(DcDReadWrite, EnumNameNotFound) << Enum->GetFName() << Value;
 
 		FDcEnumData EnumData;
-		EnumData.Signed64 = Enum->GetValueByName(ValueName);
+		EnumData.Signed64 = Lookup->Values[Index];
 
 		DC_TRY(Ctx.Writer->WriteEnum(EnumData));
 		return DcOk();
@@ -382,16 +378,11 @@ FDcResult HandlerBPEnumDeserialize(FDcDeserializeContext& Ctx)
 			FString Value;
 			DC_TRY(Ctx.Reader->ReadString(&Value));
 
-			FName ValueName{NoInit};
-			if (BPEnum)
-				ValueName = FName(BPEnum->GenerateFullEnumName(*_FindBPEnumBranch(Value).ToString()));
-			else
-				ValueName = FName(Enum->GenerateFullEnumName(*Value));
-
-			if (!Enum->IsValidEnumName(ValueName))
+			int Index = _FindIndex(Value);
+			if (Index == INDEX_NONE)
 				return DC_FAIL(DcDReadWrite, EnumNameNotFound) << Enum->GetFName() << Value;
 
-			EnumData.Signed64 |= Enum->GetValueByName(ValueName);
+			EnumData.Signed64 |= Lookup->Values[Index];
 		}
 		DC_TRY(Ctx.Reader->ReadArrayEnd());
 		DC_TRY(Ctx.Writer->WriteEnum(EnumData));
@@ -448,52 +439,36 @@ FDcResult HandlerBPEnumSerialize(FDcSerializeContext& Ctx)
 	}
 
 
-	bool bIsBitFlags;
-#if WITH_EDITORONLY_DATA
-#if WITH_METADATA
-	bIsBitFlags = Enum->HasMetaData(TEXT("Bitflags"));
-#else
-	//	Program target is missing `UEnum::HasMetaData`
-	bIsBitFlags = ((UField*)Enum)->HasMetaData(TEXT("Bitflags"));
-#endif // WITH_METADATA
-#else
-	bIsBitFlags = false;
-#endif // WITH_EDITORONLY_DATA
-
-	UUserDefinedEnum* BPEnum = Cast<UUserDefinedEnum>(Enum);
-	if (!bIsBitFlags)
+	FDcEnumLookupRef Lookup = DcSerDeUtils::FindOrBuildEnumLookup(Enum);
+	if (!Lookup->bIsBitFlags)
 	{
-		int ValueIndex = Enum->GetIndexByValue(Value.Signed64);
+		int ValueIndex = Lookup->FindIndexByValue(Value.Signed64);
 		if (ValueIndex == INDEX_NONE)
 			return DC_FAIL(DcDReadWrite, EnumValueInvalid)
 				<< Enum->GetName() << Value.Signed64;
 
-		if (BPEnum)
-		{
-			int Index = BPEnum->GetIndexByValue(Value.Signed64);
-			DC_TRY(Ctx.Writer->WriteString(BPEnum->GetAuthoredNameStringByIndex(Index)));
-		}
+		//	`UUserDefinedEnum` writes authored display names
+		if (Enum->IsA<UUserDefinedEnum>())
+			DC_TRY(Ctx.Writer->WriteString(Lookup->AuthoredNames[ValueIndex]));
 		else
-		{
-			DC_TRY(Ctx.Writer->WriteString(Enum->GetNameStringByValue(Value.Signed64)));
-		}
+			DC_TRY(Ctx.Writer->WriteString(Lookup->Names[ValueIndex]));
 	}
 	else
 	{
 		DC_TRY(Ctx.Writer->WriteArrayRoot());
 
-		int Len = Enum->NumEnums();
+		int Len = Lookup->Num();
 		uint64 Data = Value.Unsigned64;
 		for (int Ix = 0; Ix < Len; Ix++)
 		{
-			int64 Cur = Enum->GetValueByIndex(Ix);
+			int64 Cur = Lookup->Values[Ix];
 			int CurPopCount = FPlatformMath::CountBits(Cur);
 			if (CurPopCount == 0)
 				continue;
 
 			if (FPlatformMath::CountBits(Data & Cur) == CurPopCount)
 			{
-				DC_TRY(Ctx.Writer->WriteString(Enum->GetNameStringByIndex(Ix)));
+				DC_TRY(Ctx.Writer->WriteString(Lookup->Names[Ix]));
 				Data ^= Cur;
 			}
 		}
@@ -854,6 +829,21 @@ DC_TEST("DataConfig.EngineExtra.BPClassInstance")
 		UTEST_EQUAL("Extra BPClassInstance SerDe", Writer.Sb.ToString(), DcAutomationUtils::DcReindentStringLiteral(Str));
 	}
 
+	{
+		//	BP enum display names match case sensitive
+		FDcJsonReader CaseReader(TEXT(R"({ "BPEnumField" : "baz" })"));
+		UTEST_DIAG("Extra BPClassInstance SerDe", DcAutomationUtils::DeserializeFrom(&CaseReader, DestDatum,
+		[](FDcDeserializeContext& Ctx) {
+			Ctx.Deserializer->AddDirectHandler(
+				UBlueprintGeneratedClass::StaticClass(),
+				FDcDeserializeDelegate::CreateStatic(DcCommonHandlers::HandlerMapToClassDeserialize)
+			);
+			Ctx.Deserializer->PredicatedDeserializers.FindByPredicate([](auto& Entry){
+				return Entry.Name == FName(TEXT("Enum"));
+			})->Handler = FDcDeserializeDelegate::CreateStatic(DcEngineExtra::HandlerBPEnumDeserialize);
+		}, DcAutomationUtils::EDefaultSetupType::SetupJSONHandlers), DcDReadWrite, EnumNameNotFound);
+	}
+
 	return true;
 }
 
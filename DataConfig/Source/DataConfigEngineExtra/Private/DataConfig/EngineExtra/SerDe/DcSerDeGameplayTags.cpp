@@ -13,11 +13,48 @@
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
 #include "DataConfig/Json/DcJsonWriter.h"
 #include "DataConfig/Serialize/DcSerializeUtils.h"
+#include "GameplayTagsModule.h"
 
 namespace DcEngineExtra {
 
-static FDcResult _StringToGameplayTag(FDcDeserializeContext& Ctx, const FString& Str, FGameplayTag* OutTagPtr)
+FDcGameplayTagCache::FDcGameplayTagCache()
 {
+	TagTreeChangedHandle = IGameplayTagsModule::OnGameplayTagTreeChanged.AddRaw(this, &FDcGameplayTagCache::Empty);
+}
+
+FDcGameplayTagCache::~FDcGameplayTagCache()
+{
+	IGameplayTagsModule::OnGameplayTagTreeChanged.Remove(TagTreeChangedHandle);
+}
+
+bool FDcGameplayTagCache::Find(const FString& Str, FGameplayTag& OutTag)
+{
+	FReadScopeLock ReadLock(Lock);
+	if (const FGameplayTag* TagPtr = Tags.Find(Str))
+	{
+		OutTag = *TagPtr;
+		return true;
+	}
+	return false;
+}
+
+void FDcGameplayTagCache::Add(const FString& Str, const FGameplayTag& Tag)
+{
+	FWriteScopeLock WriteLock(Lock);
+	Tags.Add(Str, Tag);
+}
+
+void FDcGameplayTagCache::Empty()
+{
+	FWriteScopeLock WriteLock(Lock);
+	Tags.Empty();
+}
+
+static FDcResult _StringToGameplayTag(FDcDeserializeContext& Ctx, const FString& Str, FGameplayTag* OutTagPtr, FDcGameplayTagCache* Cache)
+{
+	if (Cache && Cache->Find(Str, *OutTagPtr))
+		return DcOk();
+
 	FString FixedString;
 	FText Err;
 	if (!FGameplayTag::IsValidGameplayTagString(Str, &Err, &FixedString))
@@ -33,11 +70,14 @@ static FDcResult _StringToGameplayTag(FDcDeserializeContext& Ctx, const FString&
 		return DC_FAIL(DcDEngineExtra, InvalidGameplayTagString) << Str;
 	}
 
+	if (Cache)
+		Cache->Add(Str, Tag);
+
 	*OutTagPtr = Tag;
 	return DcOk();
 }
 
-FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx)
+static FDcResult _GameplayTagDeserialize(FDcDeserializeContext& Ctx, FDcGameplayTagCache* Cache)
 {
 	EDcDataEntry Next;
 	DC_TRY(Ctx.Reader->PeekRead(&Next));
@@ -67,7 +107,7 @@ FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx)
 	{
 		FString Str;
 		DC_TRY(Ctx.Reader->ReadString(&Str));
-		DC_TRY(_StringToGameplayTag(Ctx, Str, TagPtr));
+		DC_TRY(_StringToGameplayTag(Ctx, Str, TagPtr, Cache));
 
 		return DcOk();
 	}
@@ -78,7 +118,7 @@ FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx)
 	}
 }
 
-FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx)
+static FDcResult _GameplayTagContainerDeserialize(FDcDeserializeContext& Ctx, FDcGameplayTagCache* Cache)
 {
 	EDcDataEntry Next;
 	DC_TRY(Ctx.Reader->PeekRead(&Next));
@@ -110,7 +150,7 @@ FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx)
 		DC_TRY(Ctx.Reader->ReadString(&Str));
 
 		FGameplayTag Tag;
-		DC_TRY(_StringToGameplayTag(Ctx, Str, &Tag));
+		DC_TRY(_StringToGameplayTag(Ctx, Str, &Tag, Cache));
 
 		ContainerPtr->AddTag(Tag);
 	}
@@ -120,6 +160,26 @@ FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx)
 	return DcOk();
 }
 
+FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx)
+{
+	return _GameplayTagDeserialize(Ctx, nullptr);
+}
+
+FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx)
+{
+	return _GameplayTagContainerDeserialize(Ctx, nullptr);
+}
+
+FDcResult HandlerGameplayTagDeserializeCached(FDcDeserializeContext& Ctx, FDcGameplayTagCacheRef Cache)
+{
+	return _GameplayTagDeserialize(Ctx, &Cache.Get());
+}
+
+FDcResult HandlerGameplayTagContainerDeserializeCached(FDcDeserializeContext& Ctx, FDcGameplayTagCacheRef Cache)
+{
+	return _GameplayTagContainerDeserialize(Ctx, &Cache.Get());
+}
+
 FDcResult HandlerGameplayTagSerialize(FDcSerializeContext& Ctx)
 {
 	FDcPropertyDatum Datum;
@@ -286,5 +346,66 @@ DC_TEST("DataConfig.EngineExtra.GameplayTagContainer")
 	return true;
 }
 
+DC_TEST("DataConfig.EngineExtra.GameplayTagCached")
+{
+	using namespace DcEngineExtra;
+
+	FString Str = TEXT(R"(
+		{
+			"TagContainerField1" : ["DataConfig.Foo.Bar"],
+			"TagContainerField2" : [
+				"DataConfig.Foo.Bar",
+				"DataConfig.Foo.Bar.Baz",
+				"DataConfig.Foo.Bar"
+			]
+		}
+	)");
+
+	FDcGameplayTagCacheRef Cache = MakeShared<FDcGameplayTagCache, ESPMode::ThreadSafe>();
+	for (int Ix = 0; Ix < 2; Ix++)
+	{
+		FDcEngineExtraTestStructWithGameplayTag2 Dest;
+		FDcPropertyDatum DestDatum(&Dest);
+
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Editor Extra FGameplayTag Cached", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[&](FDcDeserializeContext& Ctx) {
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FGameplayTagContainer>::Get(),
+				FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagContainerDeserializeCached, Cache)
+			);
+		}));
 
+		UTEST_TRUE("Editor Extra FGameplayTag Cached", Dest.TagContainerField1.Num() == 1);
+		UTEST_TRUE("Editor Extra FGameplayTag Cached", Dest.TagContainerField2.Num() == 2);
+		UTEST_TRUE("Editor Extra FGameplayTag Cached", Dest.TagContainerField2.HasTagExact(
+			UGameplayTagsManager::Get().RequestGameplayTag(TEXT("DataConfig.Foo.Bar.Baz"))
+		));
+	}
+
+	UTEST_EQUAL("Editor Extra FGameplayTag Cached", Cache->Tags.Num(), 2);
+
+	//	invalid tags are not cached
+	FString StrBad = TEXT(R"(
+		{
+			"TagField1" : "DataConfig.Valid.But.Does.Not.Exist"
+		}
+	)");
+	FDcEngineExtraTestStructWithGameplayTag1 BadDest;
+	FDcJsonReader BadReader(StrBad);
+	UTEST_DIAG("Editor Extra FGameplayTag Cached", DcAutomationUtils::DeserializeFrom(&BadReader, FDcPropertyDatum(&BadDest),
+	[&](FDcDeserializeContext& Ctx) {
+		Ctx.Deserializer->AddStructHandler(
+			TBaseStructure<FGameplayTag>::Get(),
+			FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagDeserializeCached, Cache)
+		);
+	}), DcDEngineExtra, InvalidGameplayTagString);
+	UTEST_EQUAL("Editor Extra FGameplayTag Cached", Cache->Tags.Num(), 2);
+
+	//	tag tree changes drop cached tags
+	IGameplayTagsModule::OnGameplayTagTreeChanged.Broadcast();
+	UTEST_EQUAL("Editor Extra FGameplayTag Cached", Cache->Tags.Num(), 0);
+
+	return true;
+}
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "GameplayTags.h"
+#include "Misc/ScopeRWLock.h"
 #include "DataConfig/Deserialize/DcDeserializeTypes.h"
 #include "DataConfig/Serialize/DcSerializeTypes.h"
 #include "DcSerDeGameplayTags.generated.h"
@@ -9,9 +10,34 @@
 
 namespace DcEngineExtra {
 
+///	Source string to tag lookup. Bind it with the `Cached` handlers to skip tag string validation
+///	and `RequestGameplayTag` on strings seen before. Only valid tags get cached.
+///	Emptied on `IGameplayTagsModule::OnGameplayTagTreeChanged` so added or removed tags are picked up.
+struct DATACONFIGENGINEEXTRA_API FDcGameplayTagCache : public FNoncopyable
+{
+	FRWLock Lock;
+	TMap<FString, FGameplayTag> Tags;
+
+	FDcGameplayTagCache();
+	~FDcGameplayTagCache();
+
+	bool Find(const FString& Str, FGameplayTag& OutTag);
+	void Add(const FString& Str, const FGameplayTag& Tag);
+	void Empty();
+
+private:
+	FDelegateHandle TagTreeChangedHandle;
+};
+
+using FDcGameplayTagCacheRef = TSharedRef<FDcGameplayTagCache, ESPMode::ThreadSafe>;
+
 DATACONFIGENGINEEXTRA_API FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx);
 DATACONFIGENGINEEXTRA_API FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx);
 
+//	bind with `FDcDeserializeDelegate::CreateStatic(HandlerGameplayTagDeserializeCached, Cache)`
+DATACONFIGENGINEEXTRA_API FDcResult HandlerGameplayTagDeserializeCached(FDcDeserializeContext& Ctx, FDcGameplayTagCacheRef Cache);
+DATACONFIGENGINEEXTRA_API FDcResult HandlerGameplayTagContainerDeserializeCached(FDcDeserializeContext& Ctx, FDcGameplayTagCacheRef Cache);
+
 DATACONFIGENGINEEXTRA_API FDcResult HandlerGameplayTagSerialize(FDcSerializeContext& Ctx);
 DATACONFIGENGINEEXTRA_API FDcResult HandlerGameplayTagContainerSerialize(FDcSerializeContext& Ctx);
 
@@ -3,6 +3,7 @@
 #include "DataConfig/Automation/DcAutomationUtils.h"
 #include "DataConfig/Deserialize/DcDeserializeUtils.h"
 #include "DataConfig/Extra/Misc/DcBench.h"
+#include "DataConfig/Extra/Misc/DcBenchReport.h"
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/Json/DcJsonReader.h"
@@ -147,7 +148,7 @@ DC_TEST("DataConfigBenchmark.Canada")
 			return Result.Ok();
 		});
 
-		FString Output = DcFormatBenchStats(TEXT("Canada Json Deserialize"), JsonStr.Len(), Stat);
+		FString Output = DcFormatBenchStats(TEXT("Canada Json Deserialize"), JsonStr.Len(), Stat, FDcScopedBenchReport::Get());
 		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
 		if (!Stat.bAllOk)
 			return false;
@@ -166,7 +167,7 @@ DC_TEST("DataConfigBenchmark.Canada")
 			return Result.Ok();
 		});
 
-		FString Output = DcFormatBenchStats(TEXT("Canada Json Serialize"), JsonStr.Len(), Stat);
+		FString Output = DcFormatBenchStats(TEXT("Canada Json Serialize"), JsonStr.Len(), Stat, FDcScopedBenchReport::Get());
 		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
 		if (!Stat.bAllOk)
 			return false;
@@ -187,7 +188,7 @@ DC_TEST("DataConfigBenchmark.Canada")
 			return Result.Ok();
 		});
 
-		FString Output = DcFormatBenchStats(TEXT("Canada MsgPack Serialize"), Buffer.Num(), Stat);
+		FString Output = DcFormatBenchStats(TEXT("Canada MsgPack Deserialize"), Buffer.Num(), Stat, FDcScopedBenchReport::Get());
 		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
 		if (!Stat.bAllOk)
 			return false;
@@ -209,7 +210,7 @@ DC_TEST("DataConfigBenchmark.Canada")
 			return Result.Ok();
 		});
 
-		FString Output = DcFormatBenchStats(TEXT("Canada MsgPack Deserialize"), Buffer.Num(), Stat);
+		FString Output = DcFormatBenchStats(TEXT("Canada MsgPack Serialize"), Buffer.Num(), Stat, FDcScopedBenchReport::Get());
 		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
 		if (!Stat.bAllOk)
 			return false;
@@ -218,6 +219,37 @@ DC_TEST("DataConfigBenchmark.Canada")
 	return true;
 }
 
+DC_TEST("DataConfigBenchmark.CanadaScaling")
+{
+	using namespace DcBenchmarkDetails;
+	FString JsonStr;
+	verify(FFileHelper::LoadFileToString(JsonStr, *DcGetFixturePath(TEXT("LargeFixtures/canada.json"))));
+
+	int MaxThreadCount = DcBenchDefaultMaxThreadCount();
+
+	//	Json Deserialize
+	{
+		TArray<FDcBenchScalingStat> Stats = DcBenchScalingStats(MaxThreadCount, [&]
+		{
+			FDcCanadaRoot Data;
+			FDcJsonReader Reader(JsonStr);
+			FDcResult Result = DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+			[](FDcDeserializeContext& Ctx) {
+				Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcCanadaCoords>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerCanadaCoordsDeserialize));
+				Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcVector2D>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerVector2DDeserialize));
+			});
+			return Result.Ok();
+		});
+
+		FString Output = DcFormatBenchScalingStats(TEXT("Canada Json Deserialize Scaling"), JsonStr.Len(), Stats, FDcScopedBenchReport::Get());
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stats.Last().Stat.bAllOk)
+			return false;
+	}
+
+	return true;
+}
+
 namespace DcBenchmarkDetails
 {
 
@@ -377,7 +409,11 @@ DC_TEST("DataConfigBenchmark.Corpus")
 {
 	using namespace DcBenchmarkDetails;
 	FString JsonStr;
-	verify(FFileHelper::LoadFileToString(JsonStr, *DcGetFixturePath(TEXT("LargeFixtures/corpus.ndjson"))));
+	if (!FFileHelper::LoadFileToString(JsonStr, *DcGetFixturePath(TEXT("LargeFixtures/corpus.ndjson"))))
+	{
+		AddWarning(TEXT("LargeFixtures/corpus.ndjson not found, skipped"));
+		return true;
+	}
 	FDcCorpusRoot Root;
 	auto _LoadJson = [](FString JsonStr, FDcPropertyDatum Datum)
 	{
@@ -436,7 +472,7 @@ DC_TEST("DataConfigBenchmark.Corpus")
 			return Result.Ok();
 		});
 
-		FString Output = DcFormatBenchStats(TEXT("Corpus Json Deserialize"), JsonStr.Len(), Stat);
+		FString Output = DcFormatBenchStats(TEXT("Corpus Json Deserialize"), JsonStr.Len(), Stat, FDcScopedBenchReport::Get());
 		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
 		if (!Stat.bAllOk)
 			return false;
@@ -468,7 +504,7 @@ DC_TEST("DataConfigBenchmark.Corpus")
 			return Result.Ok();
 		});
 
-		FString Output = DcFormatBenchStats(TEXT("Corpus Json Serialize"), JsonStr.Len(), Stat);
+		FString Output = DcFormatBenchStats(TEXT("Corpus Json Serialize"), JsonStr.Len(), Stat, FDcScopedBenchReport::Get());
 		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
 		if (!Stat.bAllOk)
 			return false;
@@ -502,7 +538,7 @@ DC_TEST("DataConfigBenchmark.Corpus")
 			return Result.Ok();
 		});
 
-		FString Output = DcFormatBenchStats(TEXT("Corpus MsgPack Deserialize"), Buffer.Num(), Stat);
+		FString Output = DcFormatBenchStats(TEXT("Corpus MsgPack Deserialize"), Buffer.Num(), Stat, FDcScopedBenchReport::Get());
 		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
 		if (!Stat.bAllOk)
 			return false;
@@ -536,7 +572,7 @@ DC_TEST("DataConfigBenchmark.Corpus")
 			return Result.Ok();
 		});
 
-		FString Output = DcFormatBenchStats(TEXT("Corpus MsgPack Serialize"), Buffer.Num(), Stat);
+		FString Output = DcFormatBenchStats(TEXT("Corpus MsgPack Serialize"), Buffer.Num(), Stat, FDcScopedBenchReport::Get());
 		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
 		if (!Stat.bAllOk)
 			return false;
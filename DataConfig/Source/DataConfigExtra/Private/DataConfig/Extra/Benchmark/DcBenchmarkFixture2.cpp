@@ -0,0 +1,397 @@
+#include "DataConfig/Extra/Benchmark/DcBenchmarkFixture2.h"
+#include "DataConfig/Automation/DcAutomation.h"
+#include "DataConfig/Automation/DcAutomationUtils.h"
+#include "DataConfig/Extra/Misc/DcBench.h"
+#include "DataConfig/Extra/Misc/DcBenchReport.h"
+#include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/MsgPack/DcMsgPackReader.h"
+#include "DataConfig/MsgPack/DcMsgPackWriter.h"
+#include "Math/RandomStream.h"
+
+namespace DcBenchmarkDetails
+{
+
+///	Run a synthetic fixture through JSON, MsgPack, MsgPack `InMemory` and property pipe modes.
+///	`JsonStr` is serialized from `Root` if not provided.
+template<typename TRoot>
+static bool RunSyntheticSuite(const FString& Name, TRoot& Root, FString JsonStr = FString())
+{
+	FDcPropertyDatum RootDatum(&Root);
+
+	if (JsonStr.IsEmpty())
+	{
+		FDcJsonWriter Writer;
+		if (!DcAutomationUtils::SerializeInto(&Writer, RootDatum).Ok())
+			return false;
+		JsonStr = Writer.Sb.ToString();
+	}
+
+	FDcMsgPackWriter::BufferType Buffer;
+	{
+		FDcMsgPackWriter Writer;
+		if (!DcAutomationUtils::SerializeInto(&Writer, RootDatum,
+		[](FDcSerializeContext& Ctx) {
+			DcSetupMsgPackSerializeHandlers(*Ctx.Serializer, EDcMsgPackSerializeType::Default);
+		}, DcAutomationUtils::EDefaultSetupType::SetupNothing).Ok())
+			return false;
+		Buffer = Writer.GetMainBuffer();
+	}
+
+	FDcMsgPackWriter::BufferType InMemoryBuffer;
+	{
+		FDcMsgPackWriter Writer;
+		if (!DcAutomationUtils::SerializeInto(&Writer, RootDatum,
+		[](FDcSerializeContext& Ctx) {
+			verify(Ctx.Reader->SetConfig(FDcPropertyConfig::MakeNoExpandObject()).Ok());
+			DcSetupMsgPackSerializeHandlers(*Ctx.Serializer, EDcMsgPackSerializeType::InMemory);
+		}, DcAutomationUtils::EDefaultSetupType::SetupNothing).Ok())
+			return false;
+		InMemoryBuffer = Writer.GetMainBuffer();
+	}
+
+	auto _Report = [&Name](const TCHAR* Mode, double BytesCount, const FDcBenchStat& Stat)
+	{
+		FString Output = DcFormatBenchStats(FString::Printf(TEXT("%s %s"), *Name, Mode), BytesCount, Stat, FDcScopedBenchReport::Get());
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		return Stat.bAllOk;
+	};
+
+	//	Json Deserialize
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			TRoot Data;
+			FDcJsonReader Reader(JsonStr);
+			FDcResult Result = DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+			[](FDcDeserializeContext& Ctx) {
+				Ctx.Objects.Add(GetTransientPackage());
+			});
+			return Result.Ok();
+		});
+
+		if (!_Report(TEXT("Json Deserialize"), JsonStr.Len(), Stat))
+			return false;
+	}
+
+	//	Json Serialize
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			FDcJsonWriter Writer;
+			FDcResult Result = DcAutomationUtils::SerializeInto(&Writer, RootDatum);
+			return Result.Ok();
+		});
+
+		if (!_Report(TEXT("Json Serialize"), JsonStr.Len(), Stat))
+			return false;
+	}
+
+	//	MsgPack Deserialize
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			TRoot Data;
+			FDcMsgPackReader Reader(FDcBlobViewData::From(Buffer));
+			FDcResult Result = DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+			[](FDcDeserializeContext& Ctx) {
+				Ctx.Objects.Add(GetTransientPackage());
+				DcSetupMsgPackDeserializeHandlers(*Ctx.Deserializer, EDcMsgPackDeserializeType::Default);
+			}, DcAutomationUtils::EDefaultSetupType::SetupNothing);
+			return Result.Ok();
+		});
+
+		if (!_Report(TEXT("MsgPack Deserialize"), Buffer.Num(), Stat))
+			return false;
+	}
+
+	//	MsgPack Serialize
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			FDcMsgPackWriter Writer;
+			FDcResult Result = DcAutomationUtils::SerializeInto(&Writer, RootDatum,
+			[](FDcSerializeContext& Ctx) {
+				DcSetupMsgPackSerializeHandlers(*Ctx.Serializer, EDcMsgPackSerializeType::Default);
+			}, DcAutomationUtils::EDefaultSetupType::SetupNothing);
+			return Result.Ok();
+		});
+
+		if (!_Report(TEXT("MsgPack Serialize"), Buffer.Num(), Stat))
+			return false;
+	}
+
+	//	MsgPack InMemory Deserialize
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			TRoot Data;
+			FDcMsgPackReader Reader(FDcBlobViewData::From(InMemoryBuffer));
+			FDcResult Result = DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+			[](FDcDeserializeContext& Ctx) {
+				verify(Ctx.Writer->SetConfig(FDcPropertyConfig::MakeNoExpandObject()).Ok());
+				Ctx.Objects.Add(GetTransientPackage());
+				DcSetupMsgPackDeserializeHandlers(*Ctx.Deserializer, EDcMsgPackDeserializeType::InMemory);
+			}, DcAutomationUtils::EDefaultSetupType::SetupNothing);
+			return Result.Ok();
+		});
+
+		if (!_Report(TEXT("MsgPack InMemory Deserialize"), InMemoryBuffer.Num(), Stat))
+			return false;
+	}
+
+	//	MsgPack InMemory Serialize
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			FDcMsgPackWriter Writer;
+			FDcResult Result = DcAutomationUtils::SerializeInto(&Writer, RootDatum,
+			[](FDcSerializeContext& Ctx) {
+				verify(Ctx.Reader->SetConfig(FDcPropertyConfig::MakeNoExpandObject()).Ok());
+				DcSetupMsgPackSerializeHandlers(*Ctx.Serializer, EDcMsgPackSerializeType::InMemory);
+			}, DcAutomationUtils::EDefaultSetupType::SetupNothing);
+			return Result.Ok();
+		});
+
+		if (!_Report(TEXT("MsgPack InMemory Serialize"), InMemoryBuffer.Num(), Stat))
+			return false;
+	}
+
+	//	Property Pipe, objects are copied as references
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			TRoot Data;
+			FDcPropertyWriter Writer(FDcPropertyDatum(&Data));
+			verify(Writer.SetConfig(FDcPropertyConfig::MakeNoExpandObject()).Ok());
+			FDcResult Result = DcAutomationUtils::SerializeInto(&Writer, RootDatum,
+			[](FDcSerializeContext& Ctx) {
+				verify(Ctx.Reader->SetConfig(FDcPropertyConfig::MakeNoExpandObject()).Ok());
+				DcSetupPropertyPipeSerializeHandlers(*Ctx.Serializer);
+			}, DcAutomationUtils::EDefaultSetupType::SetupNothing);
+			return Result.Ok();
+		});
+
+		//	use JSON size as a reference for bandwidth
+		if (!_Report(TEXT("Property Pipe"), JsonStr.Len(), Stat))
+			return false;
+	}
+
+	return true;
+}
+
+static void FillNest(FDcBenchNest12& Leaf, FRandomStream& Rand)
+{
+	Leaf.Id = Rand.RandRange(0, 1 << 20);
+	Leaf.Tag = FString::Printf(TEXT("Leaf_%d"), Leaf.Id);
+	Leaf.Weight = Rand.FRandRange(-1.f, 1.f);
+}
+
+template<typename TNest>
+static void FillNest(TNest& Nest, FRandomStream& Rand)
+{
+	Nest.Id = Rand.RandRange(0, 1 << 20);
+	Nest.Tag = FString::Printf(TEXT("Node_%d"), Nest.Id);
+
+	int ValueCount = Rand.RandRange(0, 4);
+	for (int Ix = 0; Ix < ValueCount; Ix++)
+		Nest.Values.Add(Rand.RandRange(-1000, 1000));
+
+	FillNest(Nest.Child, Rand);
+}
+
+static void FillWideRow(FDcBenchWideRow& Row, FRandomStream& Rand)
+{
+	for (TFieldIterator<FProperty> It(FDcBenchWideRow::StaticStruct()); It; ++It)
+	{
+		void* Ptr = It->ContainerPtrToValuePtr<void>(&Row);
+		if (FIntProperty* IntProperty = CastField<FIntProperty>(*It))
+			IntProperty->SetPropertyValue(Ptr, Rand.RandRange(-100000, 100000));
+		else if (FFloatProperty* FloatProperty = CastField<FFloatProperty>(*It))
+			FloatProperty->SetPropertyValue(Ptr, Rand.FRandRange(-1000.f, 1000.f));
+		else if (FStrProperty* StrProperty = CastField<FStrProperty>(*It))
+			StrProperty->SetPropertyValue(Ptr, FString::Printf(TEXT("%s_%d"), *It->GetName(), Rand.RandRange(0, 9999)));
+		else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(*It))
+			BoolProperty->SetPropertyValue(Ptr, Rand.RandRange(0, 1) == 1);
+	}
+}
+
+//	write rows with keys in a different shuffled order per row, which defeats any field order guessing
+static FDcResult WriteShuffledWideJson(FDcBenchWideRoot& Root, FRandomStream& Rand, FString& OutStr)
+{
+	TArray<FProperty*> Fields;
+	for (TFieldIterator<FProperty> It(FDcBenchWideRow::StaticStruct()); It; ++It)
+		Fields.Add(*It);
+
+	FDcJsonWriter Writer;
+	DC_TRY(Writer.WriteMapRoot());
+	DC_TRY(Writer.WriteString(TEXT("Rows")));
+	DC_TRY(Writer.WriteArrayRoot());
+
+	for (FDcBenchWideRow& Row : Root.Rows)
+	{
+		for (int Ix = Fields.Num() - 1; Ix > 0; Ix--)
+			Fields.Swap(Ix, Rand.RandRange(0, Ix));
+
+		DC_TRY(Writer.WriteMapRoot());
+		for (FProperty* Field : Fields)
+		{
+			DC_TRY(Writer.WriteString(Field->GetName()));
+
+			void* Ptr = Field->ContainerPtrToValuePtr<void>(&Row);
+			if (FIntProperty* IntProperty = CastField<FIntProperty>(Field))
+				DC_TRY(Writer.WriteInt32(IntProperty->GetPropertyValue(Ptr)));
+			else if (FFloatProperty* FloatProperty = CastField<FFloatProperty>(Field))
+				DC_TRY(Writer.WriteFloat(FloatProperty->GetPropertyValue(Ptr)));
+			else if (FStrProperty* StrProperty = CastField<FStrProperty>(Field))
+				DC_TRY(Writer.WriteString(StrProperty->GetPropertyValue(Ptr)));
+			else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Field))
+				DC_TRY(Writer.WriteBool(BoolProperty->GetPropertyValue(Ptr)));
+			else
+				checkNoEntry();
+		}
+		DC_TRY(Writer.WriteMapEnd());
+	}
+
+	DC_TRY(Writer.WriteArrayEnd());
+	DC_TRY(Writer.WriteMapEnd());
+
+	OutStr = Writer.Sb.ToString();
+	return DcOk();
+}
+
+static FString MakeEscapeHeavyString(FRandomStream& Rand, int FragmentCount)
+{
+	static const TCHAR* Fragments[] = {
+		TEXT("plain ascii text "),
+		TEXT("\"quoted\" "),
+		TEXT("back\\slash\\path "),
+		TEXT("tab\tand\nnewline\r\n"),
+		TEXT("caf\u00e9 na\u00efve r\u00e9sum\u00e9 "),
+		TEXT("\u65e5\u672c\u8a9e\u306e\u6587\u7ae0 "),
+		TEXT("\u0645\u0631\u062d\u0628\u0627 "),
+		TEXT("\u041f\u0440\u0438\u0432\u0435\u0442 "),
+		TEXT("emoji \U0001F600\U0001F680 "),
+		TEXT("slash / and <html> & entities "),
+	};
+
+	FString Ret;
+	for (int Ix = 0; Ix < FragmentCount; Ix++)
+		Ret += Fragments[Rand.RandRange(0, (int32)UE_ARRAY_COUNT(Fragments) - 1)];
+	return Ret;
+}
+
+} // namespace DcBenchmarkDetails
+
+DC_TEST("DataConfigBenchmark.Synthetic.DeepNesting")
+{
+	using namespace DcBenchmarkDetails;
+	FRandomStream Rand(1001);
+
+	FDcBenchDeepRoot Root;
+	Root.Items.SetNum(400);
+	for (FDcBenchNest0& Item : Root.Items)
+		FillNest(Item, Rand);
+
+	return RunSyntheticSuite(TEXT("Synthetic DeepNesting"), Root);
+}
+
+DC_TEST("DataConfigBenchmark.Synthetic.WideStruct")
+{
+	using namespace DcBenchmarkDetails;
+	FRandomStream Rand(1002);
+
+	FDcBenchWideRoot Root;
+	Root.Rows.SetNum(100);
+	for (FDcBenchWideRow& Row : Root.Rows)
+		FillWideRow(Row, Rand);
+
+	FString JsonStr;
+	UTEST_OK("Synthetic WideStruct", WriteShuffledWideJson(Root, Rand, JsonStr));
+
+	return RunSyntheticSuite(TEXT("Synthetic WideStruct"), Root, JsonStr);
+}
+
+DC_TEST("DataConfigBenchmark.Synthetic.StringHeavy")
+{
+	using namespace DcBenchmarkDetails;
+	FRandomStream Rand(1003);
+
+	FDcBenchStringRoot Root;
+	Root.Docs.SetNum(500);
+	for (FDcBenchStringDoc& Doc : Root.Docs)
+	{
+		Doc.Title = MakeEscapeHeavyString(Rand, 2);
+		Doc.Body = MakeEscapeHeavyString(Rand, 40);
+
+		int TagCount = Rand.RandRange(1, 8);
+		for (int Ix = 0; Ix < TagCount; Ix++)
+			Doc.Tags.Add(MakeEscapeHeavyString(Rand, 1));
+
+		int AttrCount = Rand.RandRange(1, 6);
+		for (int Ix = 0; Ix < AttrCount; Ix++)
+			Doc.Attributes.Add(FString::Printf(TEXT("attr\u00e9_%d"), Ix), MakeEscapeHeavyString(Rand, 3));
+	}
+
+	return RunSyntheticSuite(TEXT("Synthetic StringHeavy"), Root);
+}
+
+DC_TEST("DataConfigBenchmark.Synthetic.NameMap")
+{
+	using namespace DcBenchmarkDetails;
+	FRandomStream Rand(1004);
+
+	constexpr int EntryCount = 2000;
+	auto _MakeName = [](int Ix) { return FName(*FString::Printf(TEXT("BenchKey_%d"), Ix)); };
+
+	FDcBenchNameMapRoot Root;
+	for (int Ix = 0; Ix < EntryCount; Ix++)
+	{
+		FName Key = _MakeName(Ix);
+
+		FDcBenchNameMapValue& Value = Root.Entries.Add(Key);
+		Value.Id = Key;
+		Value.Count = Rand.RandRange(0, 1000);
+		Value.Weight = Rand.FRand();
+
+		int LinkCount = Rand.RandRange(0, 4);
+		for (int LinkIx = 0; LinkIx < LinkCount; LinkIx++)
+			Value.Links.Add(_MakeName(Rand.RandRange(0, EntryCount - 1)));
+
+		Root.Counters.Add(Key, Rand.RandRange(0, 1 << 16));
+		Root.Aliases.Add(Key, _MakeName(Rand.RandRange(0, EntryCount - 1)));
+	}
+
+	return RunSyntheticSuite(TEXT("Synthetic NameMap"), Root);
+}
+
+DC_TEST("DataConfigBenchmark.Synthetic.InstancedSubObjects")
+{
+	using namespace DcBenchmarkDetails;
+	FRandomStream Rand(1005);
+
+	FDcBenchInstancedRoot Root;
+	for (int Ix = 0; Ix < 200; Ix++)
+	{
+		UDcBaseShape* Shape;
+		if (Rand.RandRange(0, 1) == 0)
+		{
+			UDcShapeBox* Box = NewObject<UDcShapeBox>();
+			Box->Height = Rand.FRandRange(0.f, 100.f);
+			Box->Width = Rand.FRandRange(0.f, 100.f);
+			Shape = Box;
+		}
+		else
+		{
+			UDcShapeSquare* Square = NewObject<UDcShapeSquare>();
+			Square->Radius = Rand.FRandRange(0.f, 100.f);
+			Shape = Square;
+		}
+
+		Shape->ShapeName = FName(*FString::Printf(TEXT("Shape_%d"), Ix));
+		Root.Shapes.Add(Shape);
+	}
+
+	return RunSyntheticSuite(TEXT("Synthetic InstancedSubObjects"), Root);
+}
+
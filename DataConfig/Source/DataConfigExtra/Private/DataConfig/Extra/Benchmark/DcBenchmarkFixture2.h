@@ -0,0 +1,434 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/Extra/Types/DcExtraTestFixtures.h"
+#include "DcBenchmarkFixture2.generated.h"
+
+///	Synthetic benchmark fixtures, see `DcBenchmarkFixture2.cpp` for the generators.
+///	Struct recursion via arrays isn't supported by UHT, so deep nesting is spelled out by levels.
+
+USTRUCT()
+struct FDcBenchNest12
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() float Weight;
+};
+
+USTRUCT()
+struct FDcBenchNest11
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest12 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest10
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest11 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest9
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest10 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest8
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest9 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest7
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest8 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest6
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest7 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest5
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest6 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest4
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest5 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest3
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest4 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest2
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest3 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest1
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest2 Child;
+};
+
+USTRUCT()
+struct FDcBenchNest0
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id;
+	UPROPERTY() FString Tag;
+	UPROPERTY() TArray<int32> Values;
+	UPROPERTY() FDcBenchNest1 Child;
+};
+
+USTRUCT()
+struct FDcBenchDeepRoot
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<FDcBenchNest0> Items;
+};
+
+///	212 fields, serialized in shuffled key order
+USTRUCT()
+struct FDcBenchWideRow
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Int000;
+	UPROPERTY() float Real000;
+	UPROPERTY() FString Str000;
+	UPROPERTY() bool bFlag000;
+	UPROPERTY() int32 Int001;
+	UPROPERTY() float Real001;
+	UPROPERTY() FString Str001;
+	UPROPERTY() bool bFlag001;
+	UPROPERTY() int32 Int002;
+	UPROPERTY() float Real002;
+	UPROPERTY() FString Str002;
+	UPROPERTY() bool bFlag002;
+	UPROPERTY() int32 Int003;
+	UPROPERTY() float Real003;
+	UPROPERTY() FString Str003;
+	UPROPERTY() bool bFlag003;
+	UPROPERTY() int32 Int004;
+	UPROPERTY() float Real004;
+	UPROPERTY() FString Str004;
+	UPROPERTY() bool bFlag004;
+	UPROPERTY() int32 Int005;
+	UPROPERTY() float Real005;
+	UPROPERTY() FString Str005;
+	UPROPERTY() bool bFlag005;
+	UPROPERTY() int32 Int006;
+	UPROPERTY() float Real006;
+	UPROPERTY() FString Str006;
+	UPROPERTY() bool bFlag006;
+	UPROPERTY() int32 Int007;
+	UPROPERTY() float Real007;
+	UPROPERTY() FString Str007;
+	UPROPERTY() bool bFlag007;
+	UPROPERTY() int32 Int008;
+	UPROPERTY() float Real008;
+	UPROPERTY() FString Str008;
+	UPROPERTY() bool bFlag008;
+	UPROPERTY() int32 Int009;
+	UPROPERTY() float Real009;
+	UPROPERTY() FString Str009;
+	UPROPERTY() bool bFlag009;
+	UPROPERTY() int32 Int010;
+	UPROPERTY() float Real010;
+	UPROPERTY() FString Str010;
+	UPROPERTY() bool bFlag010;
+	UPROPERTY() int32 Int011;
+	UPROPERTY() float Real011;
+	UPROPERTY() FString Str011;
+	UPROPERTY() bool bFlag011;
+	UPROPERTY() int32 Int012;
+	UPROPERTY() float Real012;
+	UPROPERTY() FString Str012;
+	UPROPERTY() bool bFlag012;
+	UPROPERTY() int32 Int013;
+	UPROPERTY() float Real013;
+	UPROPERTY() FString Str013;
+	UPROPERTY() bool bFlag013;
+	UPROPERTY() int32 Int014;
+	UPROPERTY() float Real014;
+	UPROPERTY() FString Str014;
+	UPROPERTY() bool bFlag014;
+	UPROPERTY() int32 Int015;
+	UPROPERTY() float Real015;
+	UPROPERTY() FString Str015;
+	UPROPERTY() bool bFlag015;
+	UPROPERTY() int32 Int016;
+	UPROPERTY() float Real016;
+	UPROPERTY() FString Str016;
+	UPROPERTY() bool bFlag016;
+	UPROPERTY() int32 Int017;
+	UPROPERTY() float Real017;
+	UPROPERTY() FString Str017;
+	UPROPERTY() bool bFlag017;
+	UPROPERTY() int32 Int018;
+	UPROPERTY() float Real018;
+	UPROPERTY() FString Str018;
+	UPROPERTY() bool bFlag018;
+	UPROPERTY() int32 Int019;
+	UPROPERTY() float Real019;
+	UPROPERTY() FString Str019;
+	UPROPERTY() bool bFlag019;
+	UPROPERTY() int32 Int020;
+	UPROPERTY() float Real020;
+	UPROPERTY() FString Str020;
+	UPROPERTY() bool bFlag020;
+	UPROPERTY() int32 Int021;
+	UPROPERTY() float Real021;
+	UPROPERTY() FString Str021;
+	UPROPERTY() bool bFlag021;
+	UPROPERTY() int32 Int022;
+	UPROPERTY() float Real022;
+	UPROPERTY() FString Str022;
+	UPROPERTY() bool bFlag022;
+	UPROPERTY() int32 Int023;
+	UPROPERTY() float Real023;
+	UPROPERTY() FString Str023;
+	UPROPERTY() bool bFlag023;
+	UPROPERTY() int32 Int024;
+	UPROPERTY() float Real024;
+	UPROPERTY() FString Str024;
+	UPROPERTY() bool bFlag024;
+	UPROPERTY() int32 Int025;
+	UPROPERTY() float Real025;
+	UPROPERTY() FString Str025;
+	UPROPERTY() bool bFlag025;
+	UPROPERTY() int32 Int026;
+	UPROPERTY() float Real026;
+	UPROPERTY() FString Str026;
+	UPROPERTY() bool bFlag026;
+	UPROPERTY() int32 Int027;
+	UPROPERTY() float Real027;
+	UPROPERTY() FString Str027;
+	UPROPERTY() bool bFlag027;
+	UPROPERTY() int32 Int028;
+	UPROPERTY() float Real028;
+	UPROPERTY() FString Str028;
+	UPROPERTY() bool bFlag028;
+	UPROPERTY() int32 Int029;
+	UPROPERTY() float Real029;
+	UPROPERTY() FString Str029;
+	UPROPERTY() bool bFlag029;
+	UPROPERTY() int32 Int030;
+	UPROPERTY() float Real030;
+	UPROPERTY() FString Str030;
+	UPROPERTY() bool bFlag030;
+	UPROPERTY() int32 Int031;
+	UPROPERTY() float Real031;
+	UPROPERTY() FString Str031;
+	UPROPERTY() bool bFlag031;
+	UPROPERTY() int32 Int032;
+	UPROPERTY() float Real032;
+	UPROPERTY() FString Str032;
+	UPROPERTY() bool bFlag032;
+	UPROPERTY() int32 Int033;
+	UPROPERTY() float Real033;
+	UPROPERTY() FString Str033;
+	UPROPERTY() bool bFlag033;
+	UPROPERTY() int32 Int034;
+	UPROPERTY() float Real034;
+	UPROPERTY() FString Str034;
+	UPROPERTY() bool bFlag034;
+	UPROPERTY() int32 Int035;
+	UPROPERTY() float Real035;
+	UPROPERTY() FString Str035;
+	UPROPERTY() bool bFlag035;
+	UPROPERTY() int32 Int036;
+	UPROPERTY() float Real036;
+	UPROPERTY() FString Str036;
+	UPROPERTY() bool bFlag036;
+	UPROPERTY() int32 Int037;
+	UPROPERTY() float Real037;
+	UPROPERTY() FString Str037;
+	UPROPERTY() bool bFlag037;
+	UPROPERTY() int32 Int038;
+	UPROPERTY() float Real038;
+	UPROPERTY() FString Str038;
+	UPROPERTY() bool bFlag038;
+	UPROPERTY() int32 Int039;
+	UPROPERTY() float Real039;
+	UPROPERTY() FString Str039;
+	UPROPERTY() bool bFlag039;
+	UPROPERTY() int32 Int040;
+	UPROPERTY() float Real040;
+	UPROPERTY() FString Str040;
+	UPROPERTY() bool bFlag040;
+	UPROPERTY() int32 Int041;
+	UPROPERTY() float Real041;
+	UPROPERTY() FString Str041;
+	UPROPERTY() bool bFlag041;
+	UPROPERTY() int32 Int042;
+	UPROPERTY() float Real042;
+	UPROPERTY() FString Str042;
+	UPROPERTY() bool bFlag042;
+	UPROPERTY() int32 Int043;
+	UPROPERTY() float Real043;
+	UPROPERTY() FString Str043;
+	UPROPERTY() bool bFlag043;
+	UPROPERTY() int32 Int044;
+	UPROPERTY() float Real044;
+	UPROPERTY() FString Str044;
+	UPROPERTY() bool bFlag044;
+	UPROPERTY() int32 Int045;
+	UPROPERTY() float Real045;
+	UPROPERTY() FString Str045;
+	UPROPERTY() bool bFlag045;
+	UPROPERTY() int32 Int046;
+	UPROPERTY() float Real046;
+	UPROPERTY() FString Str046;
+	UPROPERTY() bool bFlag046;
+	UPROPERTY() int32 Int047;
+	UPROPERTY() float Real047;
+	UPROPERTY() FString Str047;
+	UPROPERTY() bool bFlag047;
+	UPROPERTY() int32 Int048;
+	UPROPERTY() float Real048;
+	UPROPERTY() FString Str048;
+	UPROPERTY() bool bFlag048;
+	UPROPERTY() int32 Int049;
+	UPROPERTY() float Real049;
+	UPROPERTY() FString Str049;
+	UPROPERTY() bool bFlag049;
+	UPROPERTY() int32 Int050;
+	UPROPERTY() float Real050;
+	UPROPERTY() FString Str050;
+	UPROPERTY() bool bFlag050;
+	UPROPERTY() int32 Int051;
+	UPROPERTY() float Real051;
+	UPROPERTY() FString Str051;
+	UPROPERTY() bool bFlag051;
+	UPROPERTY() int32 Int052;
+	UPROPERTY() float Real052;
+	UPROPERTY() FString Str052;
+	UPROPERTY() bool bFlag052;
+};
+
+USTRUCT()
+struct FDcBenchWideRoot
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<FDcBenchWideRow> Rows;
+};
+
+USTRUCT()
+struct FDcBenchStringDoc
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FString Title;
+	UPROPERTY() FString Body;
+	UPROPERTY() TArray<FString> Tags;
+	UPROPERTY() TMap<FString, FString> Attributes;
+};
+
+USTRUCT()
+struct FDcBenchStringRoot
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<FDcBenchStringDoc> Docs;
+};
+
+USTRUCT()
+struct FDcBenchNameMapValue
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FName Id;
+	UPROPERTY() int32 Count;
+	UPROPERTY() float Weight;
+	UPROPERTY() TArray<FName> Links;
+};
+
+USTRUCT()
+struct FDcBenchNameMapRoot
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TMap<FName, FDcBenchNameMapValue> Entries;
+	UPROPERTY() TMap<FName, int32> Counters;
+	UPROPERTY() TMap<FName, FName> Aliases;
+};
+
+USTRUCT()
+struct FDcBenchInstancedRoot
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<UDcBaseShape*> Shapes;
+};
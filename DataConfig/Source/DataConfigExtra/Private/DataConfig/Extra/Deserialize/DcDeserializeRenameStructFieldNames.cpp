@@ -7,13 +7,19 @@
 #include "DataConfig/Json/DcJsonReader.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
 #include "DataConfig/Deserialize/DcDeserializeUtils.h"
+#include "DataConfig/SerDe/DcSerDeNameCache.h"
 
 namespace DcExtra
 {
 
 struct FRenameStructRootDeserialize : public TSharedFromThis<FRenameStructRootDeserialize>
 {
-	FDcExtraRenamer Renamer;
+	//	renamer runs once per distinct field name
+	FDcNameToNameCache& RenameCache;
+
+	FRenameStructRootDeserialize(FDcNameToNameCache& InRenameCache)
+		: RenameCache(InRenameCache)
+	{}
 
 	EDcDeserializePredicateResult PredicateIsStructRoot(FDcDeserializeContext& Ctx)
 	{
@@ -44,8 +50,12 @@ struct FRenameStructRootDeserialize : public TSharedFromThis<FRenameStructRootDe
 
 			FName FieldName;
 			DC_TRY(Ctx.Reader->ReadName(&FieldName));
-			FName Renamed = Renamer.Execute(FieldName);
-			DC_TRY(Ctx.Writer->WriteName(Renamed));
+			const FName& Renamed = RenameCache.Get(FieldName);
+
+			bool bSkipped;
+			DC_TRY(DcDeserializeUtils::WriteFieldNameOrSkip(Ctx, Ctx.Reader, Renamed, &bSkipped));
+			if (bSkipped)
+				continue;
 
 			DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
 		}
@@ -66,13 +76,18 @@ struct FRenameStructRootDeserialize : public TSharedFromThis<FRenameStructRootDe
 
 
 FDcResult DeserializeStructRenaming(FDcPropertyDatum From, FDcPropertyDatum To, FDcExtraRenamer Renamer)
+{
+	FDcNameToNameCache RenameCache([Renamer](const FName& Name) { return Renamer.Execute(Name); });
+	return DeserializeStructRenaming(From, To, RenameCache);
+}
+
+FDcResult DeserializeStructRenaming(FDcPropertyDatum From, FDcPropertyDatum To, FDcNameToNameCache& RenameCache)
 {
 	FDcDeserializer Deserializer;
 
 	DcSetupPropertyPipeDeserializeHandlers(Deserializer);
 
-	TSharedRef<FRenameStructRootDeserialize> RenameStruct = MakeShared<FRenameStructRootDeserialize>();
-	RenameStruct->Renamer = Renamer;
+	TSharedRef<FRenameStructRootDeserialize> RenameStruct = MakeShared<FRenameStructRootDeserialize>(RenameCache);
 	Deserializer.AddPredicatedHandler(
 		RenameStruct->MakeDeserializePredicate(),
 		RenameStruct->MakeDeserializeDelegate()
@@ -128,7 +143,9 @@ DC_TEST("DataConfig.Extra.Deserialize.StructFieldRename")
 	FDcTestExtraRenameTo2 To;
 	FDcPropertyDatum ToDatum(&To);
 
-	UTEST_OK("Extra Struct Field Rename", DcExtra::DeserializeStructRenaming(FromDatum, ToDatum, FDcExtraRenamer::CreateLambda([](const FName& FromName){
+	int RenameCalls = 0;
+	UTEST_OK("Extra Struct Field Rename", DcExtra::DeserializeStructRenaming(FromDatum, ToDatum, FDcExtraRenamer::CreateLambda([&RenameCalls](const FName& FromName){
+		RenameCalls++;
 		FString FromStr = FromName.ToString();
 		if (FromStr.StartsWith(TEXT("From")))
 			return FName(TEXT("To") + FromStr.Mid(4));
@@ -136,6 +153,9 @@ DC_TEST("DataConfig.Extra.Deserialize.StructFieldRename")
 			return FromName;
 	})));
 
+	//	set elements share field names
+	UTEST_EQUAL("Extra Struct Field Rename", RenameCalls, 4);
+
 
 	FDcTestExtraRenameTo2 Expect;
 	FDcPropertyDatum ExpectDatum(&Expect);
@@ -165,6 +185,25 @@ DC_TEST("DataConfig.Extra.Deserialize.StructFieldRename")
 
 	UTEST_OK("Extra Struct Field Rename", DcAutomationUtils::TestReadDatumEqual(ToDatum, ExpectDatum));
 
+	//	caller owned cache is shared across calls
+	RenameCalls = 0;
+	FDcNameToNameCache RenameCache([&RenameCalls](const FName& FromName) {
+		RenameCalls++;
+		FString FromStr = FromName.ToString();
+		return FromStr.StartsWith(TEXT("From"))
+			? FName(TEXT("To") + FromStr.Mid(4))
+			: FromName;
+	});
+	for (int Ix = 0; Ix < 2; Ix++)
+	{
+		FDcTestExtraRenameTo2 CachedTo;
+		FDcPropertyDatum CachedToDatum(&CachedTo);
+		UTEST_OK("Extra Struct Field Rename", DcExtra::DeserializeStructRenaming(FromDatum, CachedToDatum, RenameCache));
+		UTEST_OK("Extra Struct Field Rename", DcAutomationUtils::TestReadDatumEqual(CachedToDatum, ExpectDatum));
+	}
+	UTEST_EQUAL("Extra Struct Field Rename", RenameCalls, 4);
+	UTEST_EQUAL("Extra Struct Field Rename", RenameCache.Num(), 4);
+
 	return true;
 }
 
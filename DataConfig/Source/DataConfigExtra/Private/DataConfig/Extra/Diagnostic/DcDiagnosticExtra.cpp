@@ -11,16 +11,35 @@ static FDcDiagnosticDetail _ExtraDetails[] = {
 	//	Sqlite
 	{ SqliteLastError, TEXT("Sqlite last error: '{0}'"), },
 	{ SqliteBusy, TEXT("Sqlite busy"), },
+	{ SqliteUnsupportedProperty, TEXT("Sqlite unsupported property: '{0}' '{1}'"), },
+	{ SqliteInvalidBatchSize, TEXT("Sqlite batch size must be positive, Actual '{0}'"), },
 
 	//	InlineStruct
 	{ InlineStructTooBig, TEXT("Inline struct too big: BufSize '{0}', Struct '{1}' Size '{2}'"), },
 	{ InlineStructNotSet, TEXT("Inline struct not set"), },
 
+	//	LazyStruct
+	{ LazyStructNotSet, TEXT("Lazy struct not set or has no source to resolve"), },
+
 	//	Nested
 	{ NestedMissingMetaData, TEXT("Nested missing metadata: '{0}'"), },
 	{ NestedGrid2DHeightMismatch, TEXT("Nested Grid2D height mismatch, Expect '{0}'"), },
 	{ NestedGrid2DWidthMismatch, TEXT("Nested Grid2D width mismatch, Expect '{0}'"), },
 	{ NestedGrid2DLenMismatch, TEXT("Nested Grid2D total length mismatch, Expect '{0}', Actual: '{1}'"), },
+
+	//	PropertyDiff
+	{ DiffTypeMismatch, TEXT("Diff datum type mismatch, Lhs '{0}', Rhs '{1}'"), },
+	{ PatchTypeMismatch, TEXT("Patch type mismatch at path '{0}', Expect '{1}', Actual '{2}'"), },
+
+	//	PropertyPath
+	{ PathInvalidSegment, TEXT("Property path invalid segment: '{0}'"), },
+	{ PathIndexOutOfBound, TEXT("Property path index out of bound, Index '{0}', Num '{1}'"), },
+	{ PathMapKeyNotFound, TEXT("Property path map key not found: '{0}'"), },
+	{ PathNullObject, TEXT("Property path hits null object at '{0}'"), },
+	{ PathRootMismatch, TEXT("Property path root mismatch, Compiled '{0}', Actual '{1}'"), },
+
+	//	Preload
+	{ PreloadPackageFailed, TEXT("Preload package failed: '{0}'"), },
 };
 
  FDcDiagnosticGroup Details = {
@@ -1,5 +1,12 @@
 #include "DataConfig/Extra/Misc/DcBench.h"
+#include "DataConfig/Extra/Misc/DcBenchReport.h"
 #include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Async/Async.h"
 
 FDcBenchRunResult DcBenchRun(int Iterations, TFunctionRef<bool()> Body)
 {
@@ -23,8 +30,200 @@ FDcBenchRunResult DcBenchRun(int Iterations, TFunctionRef<bool()> Body)
 constexpr static int BENCH_ITER_WARM_UP = 5;
 constexpr static int BENCH_ITER_RUN = 30;
 
+namespace DcBenchDetails
+{
+
+static bool bCountAllocations = false;
+
+//	count allocations made on a single thread, by swapping `GMalloc` during a scope
+//	everything else is forwarded as is so the inner allocator behaves the same
+struct FMallocCountProxy : public FMalloc
+{
+	FMalloc* Inner;
+	uint32 ThreadId;
+	int64 Count;
+
+	FMallocCountProxy(FMalloc* InInner)
+		: Inner(InInner)
+		, ThreadId(FPlatformTLS::GetCurrentThreadId())
+		, Count(0)
+	{}
+
+	FORCEINLINE void Tick()
+	{
+		if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+			++Count;
+	}
+
+	void* Malloc(SIZE_T InCount, uint32 Alignment) override
+	{
+		Tick();
+		return Inner->Malloc(InCount, Alignment);
+	}
+
+	void* TryMalloc(SIZE_T InCount, uint32 Alignment) override
+	{
+		Tick();
+		return Inner->TryMalloc(InCount, Alignment);
+	}
+
+	void* Realloc(void* Original, SIZE_T InCount, uint32 Alignment) override
+	{
+		if (InCount != 0)
+			Tick();
+		return Inner->Realloc(Original, InCount, Alignment);
+	}
+
+	void* TryRealloc(void* Original, SIZE_T InCount, uint32 Alignment) override
+	{
+		if (InCount != 0)
+			Tick();
+		return Inner->TryRealloc(Original, InCount, Alignment);
+	}
+
+	void Free(void* Original) override
+	{
+		Inner->Free(Original);
+	}
+
+	bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+	{
+		return Inner->GetAllocationSize(Original, SizeOut);
+	}
+
+	SIZE_T QuantizeSize(SIZE_T InCount, uint32 Alignment) override
+	{
+		return Inner->QuantizeSize(InCount, Alignment);
+	}
+
+	bool IsInternallyThreadSafe() const override
+	{
+		return Inner->IsInternallyThreadSafe();
+	}
+
+	void Trim(bool bTrimThreadCaches) override
+	{
+		Inner->Trim(bTrimThreadCaches);
+	}
+
+	void SetupTLSCachesOnCurrentThread() override
+	{
+		Inner->SetupTLSCachesOnCurrentThread();
+	}
+
+	void ClearAndDisableTLSCachesOnCurrentThread() override
+	{
+		Inner->ClearAndDisableTLSCachesOnCurrentThread();
+	}
+
+#if !UE_VERSION_OLDER_THAN(5, 2, 0)
+	void MarkTLSCachesAsUsedOnCurrentThread() override
+	{
+		Inner->MarkTLSCachesAsUsedOnCurrentThread();
+	}
+
+	void MarkTLSCachesAsUnusedOnCurrentThread() override
+	{
+		Inner->MarkTLSCachesAsUnusedOnCurrentThread();
+	}
+#endif // !UE_VERSION_OLDER_THAN(5, 2, 0)
+
+	void InitializeStatsMetadata() override
+	{
+		Inner->InitializeStatsMetadata();
+	}
+
+	void UpdateStats() override
+	{
+		Inner->UpdateStats();
+	}
+
+	void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+	{
+		Inner->GetAllocatorStats(OutStats);
+	}
+
+	void DumpAllocatorStats(FOutputDevice& Ar) override
+	{
+		Inner->DumpAllocatorStats(Ar);
+	}
+
+	bool ValidateHeap() override
+	{
+		return Inner->ValidateHeap();
+	}
+
+	const TCHAR* GetDescriptiveName() override
+	{
+		return Inner->GetDescriptiveName();
+	}
+};
+
+static int64 CountAllocations(TFunctionRef<bool()> Body, bool& bOutOk)
+{
+	//	swapping `GMalloc` races with any other thread allocating, it's only done when opted in
+	if (!bCountAllocations)
+	{
+		bOutOk = Body();
+		return INDEX_NONE;
+	}
+
+	//	proxy needs to outlive the scope as other threads might still be inside it
+	static FMallocCountProxy* Proxy = nullptr;
+	if (Proxy == nullptr)
+		Proxy = new FMallocCountProxy(GMalloc);
+
+	Proxy->Inner = GMalloc;
+	Proxy->ThreadId = FPlatformTLS::GetCurrentThreadId();
+	Proxy->Count = 0;
+
+	GMalloc = Proxy;
+	bOutOk = Body();
+	GMalloc = Proxy->Inner;
+
+	return Proxy->Count;
+}
+
+static float PercentileMs(const TArray<int64>& SortedIntervals, float Percentile)
+{
+	int Ix = FMath::CeilToInt(SortedIntervals.Num() * Percentile) - 1;
+	Ix = FMath::Clamp(Ix, 0, SortedIntervals.Num() - 1);
+	return FPlatformTime::ToMilliseconds64(SortedIntervals[Ix]);
+}
+
+static void IntervalsToStat(TArray<int64>& Intervals, FDcBenchStat& Stat)
+{
+	Intervals.Sort();
+	int Num = Intervals.Num();
+
+	int64 Total = 0;
+	for (int Ix = 0; Ix < Num; Ix++)
+		Total += Intervals[Ix];
+
+	Stat.MeanMs = FPlatformTime::ToMilliseconds64(Total / Num);
+	Stat.MedianMs = FPlatformTime::ToMilliseconds64(Intervals[Num / 2]);
+	Stat.P90Ms = PercentileMs(Intervals, 0.9f);
+	Stat.P99Ms = PercentileMs(Intervals, 0.99f);
+
+	double DevAcc = 0;
+	for (int Ix = 0; Ix < Num; Ix++)
+		DevAcc += FMath::Square(FPlatformTime::ToMilliseconds64(Intervals[Ix]) - Stat.MeanMs);
+
+	Stat.Deviation = FMath::Sqrt((float)(DevAcc / Num));
+}
+
+static void AppendIntervals(const FDcBenchRunResult& Run, TArray<int64>& OutIntervals)
+{
+	for (int Ix = 0; Ix < Run.Ticks.Num() - 1; Ix++)
+		OutIntervals.Add((int64)(Run.Ticks[Ix + 1] - Run.Ticks[Ix]));
+}
+
+} // namespace DcBenchDetails
+
 FDcBenchStat DcBenchStats(TFunctionRef<bool()> Body)
 {
+	using namespace DcBenchDetails;
+
 	FDcBenchStat Stat {0};
 	FDcBenchRunResult Warm = DcBenchRun(BENCH_ITER_WARM_UP, Body);
 	if (!Warm.bAllOk)
@@ -38,30 +237,20 @@ FDcBenchStat DcBenchStats(TFunctionRef<bool()> Body)
 	if (Stat.bAllOk)
 	{
 		TArray<int64> Intervals;
-		Intervals.AddUninitialized(BENCH_ITER_RUN);
-		for (int Ix = 0; Ix < BENCH_ITER_RUN; Ix++)
-			Intervals[Ix] = (int64)(Run.Ticks[Ix + 1] - Run.Ticks[Ix]);
-
-		Intervals.Sort();
-
-		int64 Total = 0;
-		for (int Ix = 0; Ix < BENCH_ITER_RUN; Ix++)
-			Total += Intervals[Ix];
+		Intervals.Reserve(BENCH_ITER_RUN);
+		AppendIntervals(Run, Intervals);
+		IntervalsToStat(Intervals, Stat);
 
-		Stat.MeanMs = FPlatformTime::ToMilliseconds(Total / BENCH_ITER_RUN);
-		Stat.MedianMs = FPlatformTime::ToMilliseconds(Intervals[BENCH_ITER_RUN / 2]);
-
-		double DevAcc = 0;
-		for (int Ix = 0; Ix < BENCH_ITER_RUN; Ix++)
-			DevAcc += FMath::Square(FPlatformTime::ToMilliseconds64(Intervals[Ix]) - Stat.MeanMs);
-
-		Stat.Deviation = FMath::Sqrt((float)(DevAcc / BENCH_ITER_RUN));
+		Stat.AllocsPerIter = CountAllocations(Body, Stat.bAllOk);
 	}
 	return Stat;
 }
 
-FString DcFormatBenchStats(FString Prefix, double BytesCount, FDcBenchStat Stat)
+FString DcFormatBenchStats(FString Prefix, double BytesCount, FDcBenchStat Stat, FDcBenchReport* Report)
 {
+	if (Report)
+		DcBenchRecordStats(*Report, Prefix, BytesCount, Stat);
+
 	if (Stat.bAllOk)
 	{
 		float MegaByte = ((float)BytesCount / (1024 * 1024));
@@ -69,13 +258,16 @@ FString DcFormatBenchStats(FString Prefix, double BytesCount, FDcBenchStat Stat)
 		float MegaBytesPerSecond = MegaByte / Seconds;
 
 		return FString::Printf(
-			TEXT("%s: [%s] Bandwidth: %.3f(MB/s), Mean: %.3f(ms), Median:%.3f(ms), Deviation:%.3f"),
+			TEXT("%s: [%s] Bandwidth: %.3f(MB/s), Mean: %.3f(ms), Median:%.3f(ms), Deviation:%.3f, P90:%.3f(ms), P99:%.3f(ms), Allocs:%lld"),
 			*Prefix,
 			*DcBuildConfigurationString(),
 			MegaBytesPerSecond,
 			Stat.MeanMs,
 			Stat.MedianMs,
-			Stat.Deviation
+			Stat.Deviation,
+			Stat.P90Ms,
+			Stat.P99Ms,
+			Stat.AllocsPerIter
 		);
 	}
 	else
@@ -88,6 +280,157 @@ FString DcFormatBenchStats(FString Prefix, double BytesCount, FDcBenchStat Stat)
 	}
 }
 
+TArray<FDcBenchScalingStat> DcBenchScalingStats(int MaxThreadCount, TFunctionRef<bool()> Body)
+{
+	using namespace DcBenchDetails;
+
+	TArray<FDcBenchScalingStat> Ret;
+
+	//	warm up on calling thread, this also gets lazy initialized statics out of the way
+	FDcBenchRunResult Warm = DcBenchRun(BENCH_ITER_WARM_UP, Body);
+	if (!Warm.bAllOk)
+	{
+		FDcBenchScalingStat& Scaling = Ret.Emplace_GetRef();
+		Scaling.ThreadCount = 1;
+		Scaling.WallMs = 0;
+		Scaling.IterationCount = 0;
+		Scaling.Stat = FDcBenchStat {0};
+		Scaling.Stat.bAllOk = false;
+		return Ret;
+	}
+
+	bool bAllocOk;
+	int64 AllocsPerIter = CountAllocations(Body, bAllocOk);
+
+	for (int ThreadCount = 1; ThreadCount <= MaxThreadCount; ThreadCount++)
+	{
+		TArray<FDcBenchRunResult> Runs;
+		Runs.SetNum(ThreadCount);
+
+		TAtomic<int> ReadyCount(0);
+		TAtomic<bool> bGo(false);
+
+		TArray<TFuture<void>> Futures;
+		for (int Ix = 1; Ix < ThreadCount; Ix++)
+		{
+			Futures.Emplace(Async(EAsyncExecution::Thread, [&, Ix]
+			{
+				++ReadyCount;
+				while (!bGo)
+					FPlatformProcess::Yield();
+
+				Runs[Ix] = DcBenchRun(BENCH_ITER_RUN, Body);
+			}));
+		}
+
+		while (ReadyCount != ThreadCount - 1)
+			FPlatformProcess::Yield();
+
+		uint64 Begin = FPlatformTime::Cycles64();
+		bGo = true;
+
+		//	calling thread is worker 0
+		Runs[0] = DcBenchRun(BENCH_ITER_RUN, Body);
+		for (TFuture<void>& Future : Futures)
+			Future.Wait();
+
+		uint64 End = FPlatformTime::Cycles64();
+
+		FDcBenchScalingStat& Scaling = Ret.Emplace_GetRef();
+		Scaling.ThreadCount = ThreadCount;
+		Scaling.WallMs = FPlatformTime::ToMilliseconds64(End - Begin);
+		Scaling.IterationCount = 0;
+		Scaling.Stat = FDcBenchStat {0};
+		Scaling.Stat.bAllOk = bAllocOk;
+		Scaling.Stat.AllocsPerIter = AllocsPerIter;
+
+		TArray<int64> Intervals;
+		Intervals.Reserve(BENCH_ITER_RUN * ThreadCount);
+		for (FDcBenchRunResult& Run : Runs)
+		{
+			Scaling.Stat.bAllOk &= Run.bAllOk;
+			Scaling.IterationCount += Run.Ticks.Num() - 1;
+			AppendIntervals(Run, Intervals);
+		}
+
+		if (!Scaling.Stat.bAllOk)
+			break;
+
+		IntervalsToStat(Intervals, Scaling.Stat);
+	}
+
+	return Ret;
+}
+
+FString DcFormatBenchScalingStats(FString Prefix, double BytesCount, const TArray<FDcBenchScalingStat>& Stats, FDcBenchReport* Report)
+{
+	if (Report)
+	{
+		for (const FDcBenchScalingStat& Scaling : Stats)
+			DcBenchRecordScalingStats(*Report, Prefix, BytesCount, Scaling);
+	}
+
+	if (Stats.Num() == 0
+		|| !Stats[0].Stat.bAllOk)
+	{
+		return FString::Printf(
+			TEXT("%s: [%s] runtime error, no benchmark stats"),
+			*Prefix,
+			*DcBuildConfigurationString()
+		);
+	}
+
+	float MegaByte = ((float)BytesCount / (1024 * 1024));
+	auto _Throughput = [&](const FDcBenchScalingStat& Scaling)
+	{
+		float Seconds = (Scaling.WallMs * 0.001f);
+		return MegaByte * Scaling.IterationCount / Seconds;
+	};
+
+	float BaseThroughput = _Throughput(Stats[0]);
+
+	TStringBuilder<1024> Sb;
+	Sb << FString::Printf(TEXT("%s: [%s] Allocs:%lld"),
+		*Prefix,
+		*DcBuildConfigurationString(),
+		Stats[0].Stat.AllocsPerIter
+	);
+
+	for (const FDcBenchScalingStat& Scaling : Stats)
+	{
+		if (!Scaling.Stat.bAllOk)
+		{
+			Sb << FString::Printf(TEXT("\n  Threads:%d runtime error"), Scaling.ThreadCount);
+			break;
+		}
+
+		float Throughput = _Throughput(Scaling);
+		float Efficiency = Throughput / (BaseThroughput * Scaling.ThreadCount);
+
+		Sb << FString::Printf(
+			TEXT("\n  Threads:%d Bandwidth: %.3f(MB/s), Efficiency: %.1f%%, Mean: %.3f(ms), P90:%.3f(ms), P99:%.3f(ms)"),
+			Scaling.ThreadCount,
+			Throughput,
+			Efficiency * 100.f,
+			Scaling.Stat.MeanMs,
+			Scaling.Stat.P90Ms,
+			Scaling.Stat.P99Ms
+		);
+	}
+
+	return Sb.ToString();
+}
+
+void DcBenchSetCountAllocations(bool bEnabled)
+{
+	DcBenchDetails::bCountAllocations = bEnabled;
+}
+
+int DcBenchDefaultMaxThreadCount()
+{
+	return FMath::Clamp(FPlatformMisc::NumberOfCores(), 1, 8);
+}
+
 FString DcBuildConfigurationString()
 {
 #if UE_BUILD_SHIPPING
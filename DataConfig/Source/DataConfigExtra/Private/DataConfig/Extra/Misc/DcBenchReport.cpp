@@ -0,0 +1,233 @@
+#include "DataConfig/Extra/Misc/DcBenchReport.h"
+#include "DataConfig/Extra/Misc/DcBench.h"
+#include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/Deserialize/DcDeserializerSetup.h"
+#include "DataConfig/Serialize/DcSerializer.h"
+#include "DataConfig/Serialize/DcSerializerSetup.h"
+#include "DataConfig/Property/DcPropertyReader.h"
+#include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/Automation/DcAutomation.h"
+
+namespace DcBenchReportDetails
+{
+
+static FDcBenchReport* ActiveReport = nullptr;
+
+static FString CsvEscape(const FString& Str)
+{
+	return TEXT("\"") + Str.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+}
+
+static const FDcBenchRecord* FindRecord(const FDcBenchReport& Report, const FDcBenchRecord& Match)
+{
+	return Report.Records.FindByPredicate([&](const FDcBenchRecord& Record)
+	{
+		return Record.Fixture == Match.Fixture
+			&& Record.BuildConfiguration == Match.BuildConfiguration
+			&& Record.ThreadCount == Match.ThreadCount;
+	});
+}
+
+static FDcBenchRecord& AddRecord(FDcBenchReport& Report, const FString& Fixture, double BytesCount, const FDcBenchStat& Stat, int32 ThreadCount)
+{
+	FDcBenchRecord& Record = Report.Records.Emplace_GetRef();
+	Record.Fixture = Fixture;
+	Record.BuildConfiguration = DcBuildConfigurationString();
+	Record.ThreadCount = ThreadCount;
+	Record.BytesCount = BytesCount;
+	Record.bAllOk = Stat.bAllOk;
+	if (!Stat.bAllOk)
+		return Record;
+
+	Record.MeanMs = Stat.MeanMs;
+	Record.MedianMs = Stat.MedianMs;
+	Record.Deviation = Stat.Deviation;
+	Record.P90Ms = Stat.P90Ms;
+	Record.P99Ms = Stat.P99Ms;
+	Record.AllocsPerIter = Stat.AllocsPerIter;
+	return Record;
+}
+
+static float BandwidthMBs(double TotalBytes, double Ms)
+{
+	return Ms > 0
+		? (float)(TotalBytes / (1024 * 1024) / (Ms * 0.001))
+		: 0;
+}
+
+} // namespace DcBenchReportDetails
+
+void DcBenchRecordStats(FDcBenchReport& Report, const FString& Fixture, double BytesCount, const FDcBenchStat& Stat)
+{
+	using namespace DcBenchReportDetails;
+	FDcBenchRecord& Record = AddRecord(Report, Fixture, BytesCount, Stat, 1);
+	if (Record.bAllOk)
+		Record.BandwidthMBs = BandwidthMBs(BytesCount, Stat.MeanMs);
+}
+
+void DcBenchRecordScalingStats(FDcBenchReport& Report, const FString& Fixture, double BytesCount, const FDcBenchScalingStat& Scaling)
+{
+	using namespace DcBenchReportDetails;
+	FDcBenchRecord& Record = AddRecord(Report, Fixture, BytesCount, Scaling.Stat, Scaling.ThreadCount);
+	if (Record.bAllOk)
+		Record.BandwidthMBs = BandwidthMBs(BytesCount * Scaling.IterationCount, Scaling.WallMs);
+}
+
+FDcScopedBenchReport::FDcScopedBenchReport(FDcBenchReport& InReport)
+	: Previous(DcBenchReportDetails::ActiveReport)
+{
+	DcBenchReportDetails::ActiveReport = &InReport;
+}
+
+FDcScopedBenchReport::~FDcScopedBenchReport()
+{
+	DcBenchReportDetails::ActiveReport = Previous;
+}
+
+FDcBenchReport* FDcScopedBenchReport::Get()
+{
+	return DcBenchReportDetails::ActiveReport;
+}
+
+FDcResult DcBenchReportToJson(const FDcBenchReport& Report, FString& OutStr)
+{
+	using namespace DcBenchReportDetails;
+
+	FDcJsonWriter Writer;
+	FDcPropertyReader Reader(FDcPropertyDatum(TBaseStructure<FDcBenchReport>::Get(), (void*)&Report));
+
+	FDcSerializeContext Ctx;
+	Ctx.Reader = &Reader;
+	Ctx.Writer = &Writer;
+	Ctx.Serializer = &DcGetSharedJsonSerializer();
+	DC_TRY(Ctx.Prepare());
+	DC_TRY(Ctx.Serializer->Serialize(Ctx));
+
+	OutStr = Writer.Sb.ToString();
+	return DcOk();
+}
+
+FDcResult DcBenchReportFromJson(const FString& Str, FDcBenchReport& OutReport)
+{
+	using namespace DcBenchReportDetails;
+
+	FDcJsonReader Reader(Str);
+	FDcPropertyWriter Writer(FDcPropertyDatum(TBaseStructure<FDcBenchReport>::Get(), &OutReport));
+
+	FDcDeserializeContext Ctx;
+	Ctx.Reader = &Reader;
+	Ctx.Writer = &Writer;
+	Ctx.Deserializer = &DcGetSharedJsonDeserializer();
+	DC_TRY(Ctx.Prepare());
+	DC_TRY(Ctx.Deserializer->Deserialize(Ctx));
+
+	return DcOk();
+}
+
+FString DcBenchReportToCsv(const FDcBenchReport& Report)
+{
+	using namespace DcBenchReportDetails;
+
+	TStringBuilder<1024> Sb;
+	Sb << TEXT("Fixture,BuildConfiguration,ThreadCount,BytesCount,BandwidthMBs,MeanMs,MedianMs,Deviation,P90Ms,P99Ms,AllocsPerIter,bAllOk\n");
+	for (const FDcBenchRecord& Record : Report.Records)
+	{
+		Sb << FString::Printf(TEXT("%s,%s,%d,%.0f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%lld,%s\n"),
+			*CsvEscape(Record.Fixture),
+			*CsvEscape(Record.BuildConfiguration),
+			Record.ThreadCount,
+			Record.BytesCount,
+			Record.BandwidthMBs,
+			Record.MeanMs,
+			Record.MedianMs,
+			Record.Deviation,
+			Record.P90Ms,
+			Record.P99Ms,
+			Record.AllocsPerIter,
+			Record.bAllOk ? TEXT("true") : TEXT("false")
+		);
+	}
+
+	return Sb.ToString();
+}
+
+void DcBenchCompareReports(const FDcBenchReport& Baseline, const FDcBenchReport& Current, float Threshold, TArray<FDcBenchRegression>& OutRegressions)
+{
+	using namespace DcBenchReportDetails;
+
+	for (const FDcBenchRecord& Record : Current.Records)
+	{
+		const FDcBenchRecord* BaselineRecord = FindRecord(Baseline, Record);
+		if (BaselineRecord == nullptr
+			|| !BaselineRecord->bAllOk)
+			continue;
+
+		if (!Record.bAllOk
+			|| Record.MedianMs > BaselineRecord->MedianMs * (1.f + Threshold))
+		{
+			FDcBenchRegression& Regression = OutRegressions.Emplace_GetRef();
+			Regression.Fixture = Record.Fixture;
+			Regression.ThreadCount = Record.ThreadCount;
+			Regression.BaselineMs = BaselineRecord->MedianMs;
+			Regression.CurrentMs = Record.bAllOk ? Record.MedianMs : -1.f;
+		}
+	}
+}
+
+DC_TEST("DataConfig.Extra.Bench.Report")
+{
+	FDcBenchReport Baseline;
+	{
+		FDcBenchRecord& Record = Baseline.Records.Emplace_GetRef();
+		Record.Fixture = TEXT("Foo");
+		Record.BuildConfiguration = DcBuildConfigurationString();
+		Record.MedianMs = 10.f;
+		Record.bAllOk = true;
+
+		FDcBenchRecord& Record2 = Baseline.Records.Add_GetRef(Record);
+		Record2.Fixture = TEXT("Bar, \"Quoted\"");
+	}
+
+	FString JsonStr;
+	UTEST_OK("Bench Report", DcBenchReportToJson(Baseline, JsonStr));
+
+	FDcBenchReport Current;
+	UTEST_OK("Bench Report", DcBenchReportFromJson(JsonStr, Current));
+	UTEST_EQUAL("Bench Report", Current.Records.Num(), 2);
+	UTEST_EQUAL("Bench Report", Current.Records[1].Fixture, Baseline.Records[1].Fixture);
+
+	UTEST_TRUE("Bench Report", DcBenchReportToCsv(Current).Contains(TEXT("\"Bar, \"\"Quoted\"\"\"")));
+
+	Current.Records[0].MedianMs = 10.5f;
+	Current.Records[1].MedianMs = 12.f;
+
+	TArray<FDcBenchRegression> Regressions;
+	DcBenchCompareReports(Baseline, Current, 0.1f, Regressions);
+	UTEST_EQUAL("Bench Report", Regressions.Num(), 1);
+	UTEST_EQUAL("Bench Report", Regressions[0].Fixture, Current.Records[1].Fixture);
+
+	{
+		//	scaling bandwidth is total bytes over wall time, not per iteration mean
+		FDcBenchScalingStat Scaling;
+		Scaling.ThreadCount = 4;
+		Scaling.WallMs = 1000.f;
+		Scaling.IterationCount = 120;
+		Scaling.Stat = FDcBenchStat {0};
+		Scaling.Stat.MeanMs = 50.f;
+		Scaling.Stat.bAllOk = true;
+
+		FDcBenchReport Report;
+		DcFormatBenchScalingStats(TEXT("Scaling"), 1024 * 1024, {Scaling}, &Report);
+		UTEST_EQUAL("Bench Report", Report.Records.Num(), 1);
+		UTEST_EQUAL("Bench Report", Report.Records[0].ThreadCount, 4);
+		UTEST_TRUE("Bench Report", FMath::IsNearlyEqual(Report.Records[0].BandwidthMBs, 120.f));
+
+		DcFormatBenchStats(TEXT("NotRecorded"), 1024 * 1024, Scaling.Stat);
+		UTEST_EQUAL("Bench Report", Report.Records.Num(), 1);
+	}
+
+	return true;
+}
+
@@ -22,80 +22,90 @@ namespace DcExtra
 namespace NDJSONDetails
 {
 
-static TOptional<FDcDeserializer> Deserializer;
-static void LazyInitializeDeserializer()
+static FDcDeserializer& GetDeserializer()
 {
-	if (Deserializer.IsSet())
-		return;
-
-	Deserializer.Emplace();
-	DcSetupJsonDeserializeHandlers(Deserializer.GetValue());
-
-	Deserializer->AddPredicatedHandler(
-		FDcDeserializePredicate::CreateStatic(DcDeserializeUtils::PredicateIsRootProperty),
-		FDcDeserializeDelegate::CreateLambda([](FDcDeserializeContext& Ctx) -> FDcResult
-		{
-			if (!Ctx.TopProperty().IsA<FArrayProperty>())
-				return DC_FAIL(DcDReadWrite, PropertyMismatch)
-					<< TEXT("Array") << Ctx.TopProperty().GetFName() << Ctx.TopProperty().GetClassName();
-
-			DC_TRY(Ctx.Writer->WriteArrayRoot());
-			EDcDataEntry CurPeek;
-			while (true)
+	static FDcDeserializer Deserializer;
+	static bool bInitialized = []
+	{
+		Deserializer.Parent = &DcGetSharedJsonDeserializer();
+
+		Deserializer.AddPredicatedHandler(
+			FDcDeserializePredicate::CreateStatic(DcDeserializeUtils::PredicateIsRootProperty),
+			FDcDeserializeDelegate::CreateLambda([](FDcDeserializeContext& Ctx) -> FDcResult
 			{
-				DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
-				//  read until EOF as we're processing ndjson
-				if (CurPeek == EDcDataEntry::Ended)
-					break;
-
-				DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
-			}
-
-			DC_TRY(Ctx.Writer->WriteArrayEnd());
-			return DcOk();
-		})
-	);
+				if (!Ctx.TopProperty().IsA<FArrayProperty>())
+					return DC_FAIL(DcDReadWrite, PropertyMismatch)
+						<< TEXT("Array") << Ctx.TopProperty().GetFName() << Ctx.TopProperty().GetClassName();
+
+				DC_TRY(Ctx.Writer->WriteArrayRoot());
+				EDcDataEntry CurPeek;
+				while (true)
+				{
+					DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
+					//  read until EOF as we're processing ndjson
+					if (CurPeek == EDcDataEntry::Ended)
+						break;
+
+					DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
+				}
+
+				DC_TRY(Ctx.Writer->WriteArrayEnd());
+				return DcOk();
+			})
+		);
+
+		Deserializer.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
+
+	return Deserializer;
 }
 
 
-static TOptional<FDcSerializer> Serializer;
-static void LazyInitializeSerializer()
+static FDcSerializer& GetSerializer()
 {
-	if (Serializer.IsSet())
-		return;
+	static FDcSerializer Serializer;
+	static bool bInitialized = []
+	{
+		Serializer.Parent = &DcGetSharedJsonSerializer();
 
-	Serializer.Emplace();
-	DcSetupJsonSerializeHandlers(Serializer.GetValue());
+		Serializer.AddPredicatedHandler(
+			FDcSerializePredicate::CreateStatic(DcSerializeUtils::PredicateIsRootProperty),
+			FDcSerializeDelegate::CreateLambda([](FDcSerializeContext& Ctx) -> FDcResult{
+				if (!Ctx.TopProperty().IsA<FArrayProperty>())
+					return DC_FAIL(DcDReadWrite, PropertyMismatch)
+						<< TEXT("Array") << Ctx.TopProperty().GetFName() << Ctx.TopProperty().GetClassName();
 
-	Serializer->AddPredicatedHandler(
-		FDcSerializePredicate::CreateStatic(DcSerializeUtils::PredicateIsRootProperty),
-		FDcSerializeDelegate::CreateLambda([](FDcSerializeContext& Ctx) -> FDcResult{
-			if (!Ctx.TopProperty().IsA<FArrayProperty>())
-				return DC_FAIL(DcDReadWrite, PropertyMismatch)
-					<< TEXT("Array") << Ctx.TopProperty().GetFName() << Ctx.TopProperty().GetClassName();
+				FDcJsonWriter* JsonWriter = Ctx.Writer->CastByIdChecked<FDcJsonWriter>();
 
-			FDcJsonWriter* JsonWriter = Ctx.Writer->CastByIdChecked<FDcJsonWriter>();
+				DC_TRY(Ctx.Reader->ReadArrayRoot());
 
-			DC_TRY(Ctx.Reader->ReadArrayRoot());
+				EDcDataEntry CurPeek;
+				while (true)
+				{
+					DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
+					if (CurPeek == EDcDataEntry::ArrayEnd)
+						break;
 
-			EDcDataEntry CurPeek;
-			while (true)
-			{
-				DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
-				if (CurPeek == EDcDataEntry::ArrayEnd)
-					break;
+					DC_TRY(DcSerializeUtils::RecursiveSerialize(Ctx));
+
+					JsonWriter->CancelWriteComma();
+					JsonWriter->Sb << TCHAR('\n');
+				}
 
-				DC_TRY(DcSerializeUtils::RecursiveSerialize(Ctx));
+				DC_TRY(Ctx.Reader->ReadArrayEnd());
 
-				JsonWriter->CancelWriteComma();
-				JsonWriter->Sb << TCHAR('\n');
-			}
+				return DcOk();
+			})
+		);
 
-			DC_TRY(Ctx.Reader->ReadArrayEnd());
+		Serializer.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
 
-			return DcOk();
-		})
-	);
+	return Serializer;
 }
 
 } // namespace NDJSONDetails
@@ -107,15 +117,13 @@ FDcResult LoadNDJSON(const TCHAR* Str, FDcPropertyDatum Datum)
 	FDcJsonReader Reader(Str);
 	FDcPropertyWriter Writer(Datum);
 
-	LazyInitializeDeserializer();
-
 	FDcDeserializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Deserializer = &Deserializer.GetValue();
+	Ctx.Deserializer = &GetDeserializer();
 	Ctx.Properties.Add(Datum.Property);
 	DC_TRY(Ctx.Prepare());
-	DC_TRY(Deserializer->Deserialize(Ctx));
+	DC_TRY(Ctx.Deserializer->Deserialize(Ctx));
 
 	return DcOk();
 }
@@ -132,14 +140,12 @@ FDcResult SaveNDJSON(FDcPropertyDatum Datum, FString& OutStr)
 	FDcJsonWriter Writer(Config);
 	FDcPropertyReader Reader(Datum);
 
-	LazyInitializeSerializer();
-
 	FDcSerializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Serializer = &Serializer.GetValue();
+	Ctx.Serializer = &GetSerializer();
 	DC_TRY(Ctx.Prepare());
-	DC_TRY(Serializer->Serialize(Ctx));
+	DC_TRY(Ctx.Serializer->Serialize(Ctx));
 
 	OutStr = Writer.Sb.ToString();
 	return DcOk();
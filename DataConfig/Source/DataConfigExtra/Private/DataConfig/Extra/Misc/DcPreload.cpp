@@ -0,0 +1,224 @@
+#include "DataConfig/Extra/Misc/DcPreload.h"
+#include "DataConfig/Extra/Diagnostic/DcDiagnosticExtra.h"
+#include "DataConfig/Reader/DcReader.h"
+#include "DataConfig/Writer/DcNoopWriter.h"
+#include "DataConfig/Misc/DcPipeVisitor.h"
+#include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/Automation/DcAutomation.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace DcPreloadDetails
+{
+
+static bool TryParseObjectPath(const FString& Str, FString& OutObjectPath, FString& OutPackageName)
+{
+	//	Class'/Path/To/Package.Object' or '/Path/To/Package.Object'
+	int32 QuoteIx;
+	if (Str.Len() > 2
+		&& Str.EndsWith(TEXT("'"))
+		&& Str.FindChar(TCHAR('\''), QuoteIx)
+		&& QuoteIx < Str.Len() - 1)
+		OutObjectPath = Str.Mid(QuoteIx + 1, Str.Len() - QuoteIx - 2);
+	else
+		OutObjectPath = Str;
+
+	if (!OutObjectPath.StartsWith(TEXT("/")))
+		return false;
+
+	OutPackageName = FPackageName::ObjectPathToPackageName(OutObjectPath);
+	if (FPackageName::IsScriptPackage(OutPackageName))
+		return false;
+
+	return FPackageName::IsValidLongPackageName(OutPackageName);
+}
+
+static TArray<FString> GatherUnloadedPackages(const FDcPreloadReferences& References)
+{
+	TArray<FString> Ret;
+	for (const FName& PackageName : References.PackageNames)
+	{
+		FString PackageStr = PackageName.ToString();
+		if (FindPackage(nullptr, *PackageStr) == nullptr)
+			Ret.Add(MoveTemp(PackageStr));
+	}
+	return Ret;
+}
+
+} // namespace DcPreloadDetails
+
+void FDcPreloadReferences::AddObjectPath(FName TypeName, const FString& ObjectPath)
+{
+	ObjectPathsByType.FindOrAdd(TypeName).Add(ObjectPath);
+	PackageNames.Add(FName(FPackageName::ObjectPathToPackageName(ObjectPath)));
+}
+
+FDcResult DcScanObjectReferences(FDcReader* Reader, FDcPreloadReferences& OutReferences)
+{
+	using namespace DcPreloadDetails;
+
+	//	`$type` is expected to be right before `$path`, same as `TryReadObjectReference`
+	enum class EMetaState : uint8
+	{
+		None,
+		ExpectType,
+		ExpectPathKey,
+		ExpectPath,
+	};
+
+	EMetaState MetaState = EMetaState::None;
+	FName PendingType;
+
+	FDcNoopWriter Writer;
+	FDcPipeVisitor PipeVisitor(Reader, &Writer);
+	PipeVisitor.PeekVisit.BindLambda([&](FDcPipeVisitor* Visitor, EDcDataEntry Next, EPipeVisitControl& OutControl)
+	{
+		if (Next != EDcDataEntry::String)
+		{
+			MetaState = EMetaState::None;
+			OutControl = EPipeVisitControl::Pass;
+			return DcOk();
+		}
+
+		OutControl = EPipeVisitControl::SkipContinue;
+		FString Str;
+		DC_TRY(Visitor->Reader->ReadString(&Str));
+
+		if (MetaState == EMetaState::ExpectType)
+		{
+			PendingType = FName(Str);
+			MetaState = EMetaState::ExpectPathKey;
+			return DcOk();
+		}
+		else if (MetaState == EMetaState::ExpectPathKey
+			&& Str == TEXT("$path"))
+		{
+			MetaState = EMetaState::ExpectPath;
+			return DcOk();
+		}
+
+		FName TypeName = MetaState == EMetaState::ExpectPath ? PendingType : NAME_None;
+		MetaState = Str == TEXT("$type") ? EMetaState::ExpectType : EMetaState::None;
+
+		FString ObjectPath;
+		FString PackageName;
+		if (TryParseObjectPath(Str, ObjectPath, PackageName))
+			OutReferences.AddObjectPath(TypeName, ObjectPath);
+
+		return DcOk();
+	});
+
+	return PipeVisitor.PipeVisit();
+}
+
+void DcPreloadPackagesAsync(const FDcPreloadReferences& References, TFunction<void(bool)> OnCompleted)
+{
+	using namespace DcPreloadDetails;
+
+	TArray<FString> Packages = GatherUnloadedPackages(References);
+	if (Packages.Num() == 0)
+	{
+		OnCompleted(true);
+		return;
+	}
+
+	struct FBatch
+	{
+		int32 Pending;
+		bool bAllOk;
+		TFunction<void(bool)> OnCompleted;
+	};
+
+	//	count is set before issuing so a load completing early doesn't fire `OnCompleted` too soon
+	TSharedRef<FBatch> Batch = MakeShared<FBatch>();
+	Batch->Pending = Packages.Num();
+	Batch->bAllOk = true;
+	Batch->OnCompleted = MoveTemp(OnCompleted);
+
+	for (const FString& PackageName : Packages)
+	{
+		LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateLambda(
+			[Batch](const FName&, UPackage* Package, EAsyncLoadingResult::Type Result)
+			{
+				if (Result != EAsyncLoadingResult::Succeeded
+					|| Package == nullptr)
+					Batch->bAllOk = false;
+
+				if (--Batch->Pending == 0)
+					Batch->OnCompleted(Batch->bAllOk);
+			}));
+	}
+}
+
+FDcResult DcPreloadPackages(const FDcPreloadReferences& References)
+{
+	using namespace DcPreloadDetails;
+
+	TArray<FString> Packages = GatherUnloadedPackages(References);
+
+	TArray<int32> RequestIds;
+	RequestIds.Reserve(Packages.Num());
+	for (const FString& PackageName : Packages)
+		RequestIds.Add(LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate()));
+
+	//	all requests are already queued, flushing them one by one still loads the batch together
+	for (int32 RequestId : RequestIds)
+		FlushAsyncLoading(RequestId);
+
+	for (const FString& PackageName : Packages)
+	{
+		if (FindPackage(nullptr, *PackageName) == nullptr)
+			return DC_FAIL(DcDExtra, PreloadPackageFailed) << PackageName;
+	}
+
+	return DcOk();
+}
+
+DC_TEST("DataConfig.Extra.Preload.Scan")
+{
+	FString Str = TEXT(R"(
+
+		{
+			"ObjField1" : "Texture2D'/Game/Textures/T_Alpha.T_Alpha'",
+			"ObjField2" : "/Game/Textures/T_Alpha",
+			"ObjField3" :
+			{
+				"$type" : "Texture2D",
+				"$path" : "/Game/Textures/T_Beta"
+			},
+			"ObjField4" : "'/Script/DataConfigTests'",
+			"Name" : "NotAPath",
+			"Arr" : ["/Game/Data/DA_Gamma.DA_Gamma", 123, null],
+		}
+
+	)");
+
+	FDcPreloadReferences References;
+	{
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Extra Preload", DcScanObjectReferences(&Reader, References));
+	}
+
+	UTEST_EQUAL("Extra Preload", References.PackageNames.Num(), 3);
+	UTEST_TRUE("Extra Preload", References.PackageNames.Contains(TEXT("/Game/Textures/T_Alpha")));
+	UTEST_TRUE("Extra Preload", References.PackageNames.Contains(TEXT("/Game/Textures/T_Beta")));
+	UTEST_TRUE("Extra Preload", References.PackageNames.Contains(TEXT("/Game/Data/DA_Gamma")));
+
+	UTEST_TRUE("Extra Preload", References.ObjectPathsByType.Contains(TEXT("Texture2D")));
+	UTEST_TRUE("Extra Preload", References.ObjectPathsByType[TEXT("Texture2D")].Contains(TEXT("/Game/Textures/T_Beta")));
+	UTEST_EQUAL("Extra Preload", References.ObjectPathsByType[NAME_None].Num(), 3);
+
+	//	native only references needs no loading
+	FDcPreloadReferences NativeReferences;
+	{
+		FString NativeStr = TEXT(R"( ["/Script/DataConfigTests", "'/Script/Engine'"] )");
+		FDcJsonReader Reader(NativeStr);
+		UTEST_OK("Extra Preload", DcScanObjectReferences(&Reader, NativeReferences));
+	}
+	UTEST_EQUAL("Extra Preload", NativeReferences.PackageNames.Num(), 0);
+	UTEST_OK("Extra Preload", DcPreloadPackages(NativeReferences));
+
+	return true;
+}
+
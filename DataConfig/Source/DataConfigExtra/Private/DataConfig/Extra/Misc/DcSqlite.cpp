@@ -2,13 +2,16 @@
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
+#include "DataConfig/Extra/SerDe/DcSerDeColor.h"
 #include "DataConfig/Extra/Diagnostic/DcDiagnosticExtra.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Deserialize/Handlers/Common/DcCommonDeserializers.h"
 #include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/Property/DcPropertyReader.h"
 
 #include "SQLiteDatabase.h"
 #include "Misc/ScopeExit.h"
+#include "Misc/StringBuilder.h"
 
 namespace DcExtra
 {
@@ -16,23 +19,27 @@ namespace DcExtra
 namespace SqliteDetails
 {
 
-static TOptional<FDcDeserializer> Deserializer;
-static void LazyInitializeDeserializer()
+static FDcDeserializer& GetDeserializer()
 {
-	if (Deserializer.IsSet())
-		return;
+	static FDcDeserializer Deserializer;
+	static bool bInitialized = []
+	{
+		using namespace DcCommonHandlers;
+		AddNumericPipeDirectHandlers(Deserializer);
 
-	Deserializer.Emplace();
+		Deserializer.AddDirectHandler(FNameProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeNameDeserialize));
+		Deserializer.AddDirectHandler(FStrProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeStringDeserialize));
+		Deserializer.AddDirectHandler(FTextProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeTextDeserialize));
 
-	using namespace DcCommonHandlers;
-	AddNumericPipeDirectHandlers(*Deserializer);
+		Deserializer.AddDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize));
+		Deserializer.AddDirectHandler(FStructProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
 
-	Deserializer->AddDirectHandler(FNameProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeNameDeserialize));
-	Deserializer->AddDirectHandler(FStrProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeStringDeserialize));
-	Deserializer->AddDirectHandler(FTextProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeTextDeserialize));
+		Deserializer.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
 
-	Deserializer->AddDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize));
-	Deserializer->AddDirectHandler(FStructProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
+	return Deserializer;
 }
 
 static EDcDataEntry SqliteColumnTypeToDataEntry(ESQLiteColumnType ColType)
@@ -41,8 +48,8 @@ static EDcDataEntry SqliteColumnTypeToDataEntry(ESQLiteColumnType ColType)
 	{
 	case ESQLiteColumnType::Null: return EDcDataEntry::None;
 	case ESQLiteColumnType::String: return EDcDataEntry::String;
-	case ESQLiteColumnType::Integer: return EDcDataEntry::Int32;
-	case ESQLiteColumnType::Float: return EDcDataEntry::Float;
+	case ESQLiteColumnType::Integer: return EDcDataEntry::Int64;
+	case ESQLiteColumnType::Float: return EDcDataEntry::Double;
 	case ESQLiteColumnType::Blob: return EDcDataEntry::Blob;
 	}
 	return EDcDataEntry::Ended;
@@ -279,6 +286,274 @@ struct FSqliteReader : FDcReader
 	FName GetId() override { return ClassId(); }
 };
 
+struct FColumnBinding
+{
+	enum class EKind : uint8
+	{
+		Integer,
+		Float,
+		String,
+		Name,
+		Text,
+	};
+
+	FProperty* Property;
+	EKind Kind;
+};
+
+//	columns are bound to row struct fields once per query, any column that can't be written
+//	directly sends the whole query through the deserializer, which also reports the errors
+static bool TryBindColumns(FSQLitePreparedStatement& Stmt, UScriptStruct* Struct, TArray<FColumnBinding>& OutBindings)
+{
+	for (const FString& Name : Stmt.GetColumnNames())
+	{
+		if (Name.Len() >= NAME_SIZE)
+			return false;
+
+		FProperty* Property = DcPropertyUtils::FindEffectivePropertyByName(Struct, FName(*Name));
+		if (Property == nullptr
+			|| Property->ArrayDim > 1)
+			return false;
+
+		FColumnBinding::EKind Kind;
+		if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			if (NumericProperty->IsEnum())
+				return false;
+
+			Kind = NumericProperty->IsFloatingPoint()
+				? FColumnBinding::EKind::Float
+				: FColumnBinding::EKind::Integer;
+		}
+		else if (Property->IsA<FStrProperty>())
+			Kind = FColumnBinding::EKind::String;
+		else if (Property->IsA<FNameProperty>())
+			Kind = FColumnBinding::EKind::Name;
+		else if (Property->IsA<FTextProperty>())
+			Kind = FColumnBinding::EKind::Text;
+		else
+			return false;
+
+		OutBindings.Add({Property, Kind});
+	}
+
+	return OutBindings.Num() > 0;
+}
+
+static FDcResult WriteColumn(FSQLiteDatabase* Db, FSQLitePreparedStatement& Stmt, int32 ColIx, const FColumnBinding& Binding, void* RowPtr)
+{
+	ESQLiteColumnType ColType;
+	if (!Stmt.GetColumnTypeByIndex(ColIx, ColType))
+		return DC_FAIL(DcDExtra, SqliteLastError) << Db->GetLastError();
+
+	//	null keeps the struct default
+	if (ColType == ESQLiteColumnType::Null)
+		return DcOk();
+
+	if (ColType == ESQLiteColumnType::Blob)
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch)
+			<< DcPropertyUtils::PropertyToDataEntry(Binding.Property) << EDcDataEntry::Blob;
+
+	void* ValuePtr = Binding.Property->ContainerPtrToValuePtr<void>(RowPtr);
+	bool bOk;
+	switch (Binding.Kind)
+	{
+		case FColumnBinding::EKind::Integer:
+		{
+			int64 Value;
+			bOk = Stmt.GetColumnValueByIndex(ColIx, Value);
+			((FNumericProperty*)Binding.Property)->SetIntPropertyValue(ValuePtr, Value);
+			break;
+		}
+		case FColumnBinding::EKind::Float:
+		{
+			double Value;
+			bOk = Stmt.GetColumnValueByIndex(ColIx, Value);
+			((FNumericProperty*)Binding.Property)->SetFloatingPointPropertyValue(ValuePtr, Value);
+			break;
+		}
+		case FColumnBinding::EKind::String:
+		{
+			bOk = Stmt.GetColumnValueByIndex(ColIx, *(FString*)ValuePtr);
+			break;
+		}
+		case FColumnBinding::EKind::Name:
+		{
+			FString Str;
+			bOk = Stmt.GetColumnValueByIndex(ColIx, Str);
+			if (Str.Len() >= NAME_SIZE)
+				return DC_FAIL(DcDReadWrite, FNameOverSize);
+
+			*(FName*)ValuePtr = FName(Str);
+			break;
+		}
+		case FColumnBinding::EKind::Text:
+		{
+			FString Str;
+			bOk = Stmt.GetColumnValueByIndex(ColIx, Str);
+			*(FText*)ValuePtr = FText::FromString(MoveTemp(Str));
+			break;
+		}
+		default:
+			return DcNoEntry();
+	}
+
+	if (!bOk)
+		return DC_FAIL(DcDExtra, SqliteLastError) << Db->GetLastError();
+
+	return DcOk();
+}
+
+static FDcResult ImportRows(FSQLiteDatabase* Db, FSQLitePreparedStatement& Stmt, const TArray<FColumnBinding>& Bindings, FArrayProperty* ArrayProperty, void* ArrayPtr)
+{
+	FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayPtr);
+	while (true)
+	{
+		ESQLitePreparedStatementStepResult Ret = Stmt.Step();
+		if (Ret == ESQLitePreparedStatementStepResult::Done)
+			return DcOk();
+		else if (Ret == ESQLitePreparedStatementStepResult::Busy)
+			return DC_FAIL(DcDExtra, SqliteBusy);
+		else if (Ret != ESQLitePreparedStatementStepResult::Row)
+			return DC_FAIL(DcDExtra, SqliteLastError) << Db->GetLastError();
+
+		void* RowPtr = ArrayHelper.GetRawPtr(ArrayHelper.AddValue());
+		for (int32 ColIx = 0; ColIx < Bindings.Num(); ColIx++)
+			DC_TRY(WriteColumn(Db, Stmt, ColIx, Bindings[ColIx], RowPtr));
+	}
+}
+
+static const TCHAR* PropertyToSqliteType(FProperty* Property)
+{
+	if (Property->ArrayDim > 1)
+		return nullptr;
+
+	if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		if (NumericProperty->IsEnum())
+			return nullptr;
+
+		return NumericProperty->IsFloatingPoint() ? TEXT("REAL") : TEXT("INTEGER");
+	}
+	else if (Property->IsA<FBoolProperty>())
+		return TEXT("INTEGER");
+	else if (Property->IsA<FStrProperty>()
+		|| Property->IsA<FNameProperty>()
+		|| Property->IsA<FTextProperty>())
+		return TEXT("TEXT");
+
+	return nullptr;
+}
+
+static FDcResult ExecuteSql(FSQLiteDatabase* Db, const TCHAR* Sql)
+{
+	if (!Db->Execute(Sql))
+		return DC_FAIL(DcDExtra, SqliteLastError) << Db->GetLastError();
+
+	return DcOk();
+}
+
+static FDcResult QueryPragmaInt(FSQLiteDatabase* Db, const TCHAR* Sql, int64& OutValue)
+{
+	FSQLitePreparedStatement Stmt = Db->PrepareStatement(Sql);
+	if (!Stmt.IsValid()
+		|| Stmt.Step() != ESQLitePreparedStatementStepResult::Row
+		|| !Stmt.GetColumnValueByIndex(0, OutValue))
+		return DC_FAIL(DcDExtra, SqliteLastError) << Db->GetLastError();
+
+	return DcOk();
+}
+
+//	quoted identifier, embedded `"` are doubled
+static void AppendQuotedIdentifier(FStringBuilderBase& Sb, const FString& Name)
+{
+	Sb << TEXT('"') << Name.Replace(TEXT("\""), TEXT("\"\"")) << TEXT('"');
+}
+
+//	savepoints nest inside caller's transaction, the outermost one behaves as `BEGIN/COMMIT`
+static const TCHAR* const SaveSavepoint = TEXT("SAVEPOINT DcSaveStructArray");
+static const TCHAR* const SaveRelease = TEXT("RELEASE DcSaveStructArray");
+static const TCHAR* const SaveRollback = TEXT("ROLLBACK TO DcSaveStructArray");
+
+template<typename TValue>
+static FDcResult BindValue(FSQLiteDatabase* Db, FSQLitePreparedStatement& Stmt, int32 ColIx, const TValue& Value)
+{
+	//	binding index is 1 based
+	if (!Stmt.SetBindingValueByIndex(ColIx + 1, Value))
+		return DC_FAIL(DcDExtra, SqliteLastError) << Db->GetLastError();
+
+	return DcOk();
+}
+
+static FDcResult BindField(FSQLiteDatabase* Db, FSQLitePreparedStatement& Stmt, int32 ColIx, FDcPropertyReader& Reader)
+{
+	EDcDataEntry Next;
+	DC_TRY(Reader.PeekRead(&Next));
+	switch (Next)
+	{
+		case EDcDataEntry::Bool: { bool Value; DC_TRY(Reader.ReadBool(&Value)); return BindValue(Db, Stmt, ColIx, (int64)Value); }
+		case EDcDataEntry::Int8: { int8 Value; DC_TRY(Reader.ReadInt8(&Value)); return BindValue(Db, Stmt, ColIx, (int64)Value); }
+		case EDcDataEntry::Int16: { int16 Value; DC_TRY(Reader.ReadInt16(&Value)); return BindValue(Db, Stmt, ColIx, (int64)Value); }
+		case EDcDataEntry::Int32: { int32 Value; DC_TRY(Reader.ReadInt32(&Value)); return BindValue(Db, Stmt, ColIx, (int64)Value); }
+		case EDcDataEntry::Int64: { int64 Value; DC_TRY(Reader.ReadInt64(&Value)); return BindValue(Db, Stmt, ColIx, Value); }
+		case EDcDataEntry::UInt8: { uint8 Value; DC_TRY(Reader.ReadUInt8(&Value)); return BindValue(Db, Stmt, ColIx, (int64)Value); }
+		case EDcDataEntry::UInt16: { uint16 Value; DC_TRY(Reader.ReadUInt16(&Value)); return BindValue(Db, Stmt, ColIx, (int64)Value); }
+		case EDcDataEntry::UInt32: { uint32 Value; DC_TRY(Reader.ReadUInt32(&Value)); return BindValue(Db, Stmt, ColIx, (int64)Value); }
+		//	sqlite integers are signed 64 bit, large values wrap around like a C cast
+		case EDcDataEntry::UInt64: { uint64 Value; DC_TRY(Reader.ReadUInt64(&Value)); return BindValue(Db, Stmt, ColIx, (int64)Value); }
+		case EDcDataEntry::Float: { float Value; DC_TRY(Reader.ReadFloat(&Value)); return BindValue(Db, Stmt, ColIx, (double)Value); }
+		case EDcDataEntry::Double: { double Value; DC_TRY(Reader.ReadDouble(&Value)); return BindValue(Db, Stmt, ColIx, Value); }
+		case EDcDataEntry::String: { FString Value; DC_TRY(Reader.ReadString(&Value)); return BindValue(Db, Stmt, ColIx, Value); }
+		case EDcDataEntry::Name: { FName Value; DC_TRY(Reader.ReadName(&Value)); return BindValue(Db, Stmt, ColIx, Value.ToString()); }
+		case EDcDataEntry::Text: { FText Value; DC_TRY(Reader.ReadText(&Value)); return BindValue(Db, Stmt, ColIx, Value.ToString()); }
+		default:
+			return DC_FAIL(DcDReadWrite, DataTypeMismatch2) << EDcDataEntry::String << EDcDataEntry::Double << Next;
+	}
+}
+
+static FDcResult InsertRows(FSQLiteDatabase* Db, FSQLitePreparedStatement& Stmt, FDcPropertyDatum Datum, int32 BatchSize)
+{
+	FDcPropertyReader Reader(Datum);
+	DC_TRY(Reader.ReadArrayRoot());
+
+	int32 RowIx = 0;
+	while (true)
+	{
+		EDcDataEntry Next;
+		DC_TRY(Reader.PeekRead(&Next));
+		if (Next == EDcDataEntry::ArrayEnd)
+			break;
+
+		if (RowIx > 0 && RowIx % BatchSize == 0)
+		{
+			DC_TRY(ExecuteSql(Db, SaveRelease));
+			DC_TRY(ExecuteSql(Db, SaveSavepoint));
+		}
+
+		DC_TRY(Reader.ReadStructRoot());
+		int32 ColIx = 0;
+		while (true)
+		{
+			DC_TRY(Reader.PeekRead(&Next));
+			if (Next == EDcDataEntry::StructEnd)
+				break;
+
+			DC_TRY(Reader.ReadName(nullptr));
+			DC_TRY(BindField(Db, Stmt, ColIx++, Reader));
+		}
+		DC_TRY(Reader.ReadStructEnd());
+
+		if (!Stmt.Execute())
+			return DC_FAIL(DcDExtra, SqliteLastError) << Db->GetLastError();
+
+		Stmt.Reset();
+		++RowIx;
+	}
+
+	DC_TRY(Reader.ReadArrayEnd());
+	return DcOk();
+}
+
 } // namespace SqliteDetails
 
 
@@ -286,12 +561,22 @@ FDcResult LoadStructArrayFromSQLite(FSQLiteDatabase* Db, const TCHAR* Query, FDc
 {
 	using namespace SqliteDetails;
 
+	//	rows are only stepped by the import, `Execute()` would run the query once more
 	FSQLitePreparedStatement Stmt = Db->PrepareStatement(Query, ESQLitePreparedStatementFlags::None);
-	if (!Stmt.Execute())
+	if (!Stmt.IsValid())
 		return DC_FAIL(DcDExtra, SqliteLastError)
 			<< Db->GetLastError();
 
-	LazyInitializeDeserializer();
+	//	array of plain scalar structs are written directly by column ordinal
+	if (FArrayProperty* ArrayProperty = DcPropertyUtils::CastFieldVariant<FArrayProperty>(Datum.Property))
+	{
+		if (FStructProperty* StructProperty = CastField<FStructProperty>(ArrayProperty->Inner))
+		{
+			TArray<FColumnBinding> Bindings;
+			if (TryBindColumns(Stmt, StructProperty->Struct, Bindings))
+				return ImportRows(Db, Stmt, Bindings, ArrayProperty, Datum.DataPtr);
+		}
+	}
 
 	FSqliteReader Reader(Db, &Stmt);
 	FDcPropertyWriter Writer(Datum);
@@ -299,14 +584,97 @@ FDcResult LoadStructArrayFromSQLite(FSQLiteDatabase* Db, const TCHAR* Query, FDc
 	FDcDeserializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Deserializer = &Deserializer.GetValue();
+	Ctx.Deserializer = &GetDeserializer();
 	Ctx.Properties.Add(Datum.Property);
 	DC_TRY(Ctx.Prepare());
-	DC_TRY(Deserializer->Deserialize(Ctx));
+	DC_TRY(Ctx.Deserializer->Deserialize(Ctx));
 
 	return DcOk();
 }
 
+FDcResult SaveStructArrayToSQLite(FSQLiteDatabase* Db, const TCHAR* Table, FDcPropertyDatum Datum, const FDcSqliteSaveOptions& Options)
+{
+	using namespace SqliteDetails;
+	if (Options.BatchSize <= 0)
+		return DC_FAIL(DcDExtra, SqliteInvalidBatchSize) << Options.BatchSize;
+
+	FArrayProperty* ArrayProperty = DcPropertyUtils::CastFieldVariant<FArrayProperty>(Datum.Property);
+	FStructProperty* StructProperty = ArrayProperty ? CastField<FStructProperty>(ArrayProperty->Inner) : nullptr;
+	if (StructProperty == nullptr)
+		return DC_FAIL(DcDReadWrite, PropertyMismatch)
+			<< TEXT("ArrayProperty") << Datum.Property.GetFName() << DcPropertyUtils::GetFormatPropertyTypeName(Datum.Property);
+
+	//	schema is derived from the row struct, one column per effective property
+	TStringBuilder<256> ColumnsSb;
+	TStringBuilder<256> ValuesSb;
+	TStringBuilder<256> SchemaSb;
+	int32 ColNum = 0;
+	for (FProperty* Property = DcPropertyUtils::FirstEffectiveProperty(StructProperty->Struct->PropertyLink);
+		Property;
+		Property = DcPropertyUtils::NextEffectiveProperty(Property))
+	{
+		const TCHAR* SqlType = PropertyToSqliteType(Property);
+		if (SqlType == nullptr)
+			return DC_FAIL(DcDExtra, SqliteUnsupportedProperty)
+				<< Property->GetFName() << DcPropertyUtils::GetFormatPropertyTypeName(Property);
+
+		if (ColNum > 0)
+		{
+			ColumnsSb << TEXT(", ");
+			ValuesSb << TEXT(", ");
+			SchemaSb << TEXT(", ");
+		}
+
+		++ColNum;
+		AppendQuotedIdentifier(ColumnsSb, Property->GetName());
+		ValuesSb.Appendf(TEXT("?%d"), ColNum);
+		AppendQuotedIdentifier(SchemaSb, Property->GetName());
+		SchemaSb << TEXT(' ') << SqlType;
+	}
+
+	TStringBuilder<64> TableSb;
+	AppendQuotedIdentifier(TableSb, Table);
+
+	if (Options.bJournalWAL)
+		DC_TRY(ExecuteSql(Db, TEXT("PRAGMA journal_mode=WAL")));
+
+	//	`synchronous` is per connection, restore caller's level on all paths
+	int64 PrevSynchronous = INDEX_NONE;
+	if (Options.bSynchronousOff)
+	{
+		DC_TRY(QueryPragmaInt(Db, TEXT("PRAGMA synchronous"), PrevSynchronous));
+		DC_TRY(ExecuteSql(Db, TEXT("PRAGMA synchronous=OFF")));
+	}
+	ON_SCOPE_EXIT
+	{
+		if (PrevSynchronous != INDEX_NONE)
+			Db->Execute(*FString::Printf(TEXT("PRAGMA synchronous=%lld"), PrevSynchronous));
+	};
+
+	if (Options.bCreateTable)
+		DC_TRY(ExecuteSql(Db, *FString::Printf(TEXT("CREATE TABLE IF NOT EXISTS %s (%s)"), TableSb.ToString(), SchemaSb.ToString())));
+
+	//	one statement for all rows, rebound and reset per row
+	FSQLitePreparedStatement Stmt = Db->PrepareStatement(
+		*FString::Printf(TEXT("INSERT INTO %s (%s) VALUES (%s)"), TableSb.ToString(), ColumnsSb.ToString(), ValuesSb.ToString()),
+		ESQLitePreparedStatementFlags::Persistent);
+	if (!Stmt.IsValid())
+		return DC_FAIL(DcDExtra, SqliteLastError)
+			<< Db->GetLastError();
+
+	//	inserts are released every `BatchSize` rows as each outermost transaction is a disk sync
+	DC_TRY(ExecuteSql(Db, SaveSavepoint));
+	FDcResult Ret = InsertRows(Db, Stmt, Datum, Options.BatchSize);
+	if (!Ret.Ok())
+	{
+		Db->Execute(SaveRollback);
+		Db->Execute(SaveRelease);
+		return Ret;
+	}
+
+	return ExecuteSql(Db, SaveRelease);
+}
+
 } // namespace DcExtra
 
 DC_TEST("DataConfig.Extra.Sqlite")
@@ -369,3 +737,155 @@ DC_TEST("DataConfig.Extra.Sqlite")
 
 	return true;
 }
+
+DC_TEST("DataConfig.Extra.Sqlite.Bulk")
+{
+	using namespace DcExtra;
+
+	bool bSuccess = true;
+	FSQLiteDatabase TestDb;
+	bSuccess &= TestDb.Open(TEXT(":memory:"), ESQLiteDatabaseOpenMode::ReadWriteCreate);
+	ON_SCOPE_EXIT { TestDb.Close(); };
+
+	FString Statement = TEXT("CREATE TABLE items (id INTEGER NOT NULL, weight REAL, name TEXT, note TEXT, stock INTEGER, extra TEXT)");
+	bSuccess &= TestDb.Execute(*Statement);
+	Statement = TEXT("INSERT INTO items VALUES (1099511627776, 0.1, 'Sword', 'Sharp', 3, 'X')");
+	bSuccess &= TestDb.Execute(*Statement);
+	Statement = TEXT("INSERT INTO items VALUES (2, 1.0000000001, 'Shield', 'Round', NULL, 'Y')");
+	bSuccess &= TestDb.Execute(*Statement);
+	UTEST_TRUE("Extra Sqlite Bulk", bSuccess);
+
+	{
+		//	64 bit integer and double survive
+		TArray<FDcExtraTestSqliteItem> Arr;
+		UTEST_OK("Extra Sqlite Bulk", DcExtra::LoadStructArrayFromSQLite(
+			&TestDb,
+			TEXT("SELECT id, weight, name, note, stock FROM items ORDER BY id DESC"),
+			Arr
+			));
+
+		UTEST_EQUAL("Extra Sqlite Bulk", Arr.Num(), 2);
+		UTEST_EQUAL("Extra Sqlite Bulk", Arr[0].Id, (int64)1099511627776);
+		UTEST_EQUAL("Extra Sqlite Bulk", Arr[0].Weight, 0.1);
+		UTEST_TRUE("Extra Sqlite Bulk", Arr[0].Name == FName(TEXT("Sword")));
+		UTEST_EQUAL("Extra Sqlite Bulk", Arr[0].Note.ToString(), FString(TEXT("Sharp")));
+		UTEST_EQUAL("Extra Sqlite Bulk", Arr[0].Stock, 3);
+
+		UTEST_EQUAL("Extra Sqlite Bulk", Arr[1].Id, (int64)2);
+		UTEST_EQUAL("Extra Sqlite Bulk", Arr[1].Weight, 1.0000000001);
+		UTEST_EQUAL("Extra Sqlite Bulk", Arr[1].Stock, 7);
+	}
+
+	{
+		//	unknown column goes through the deserializer and fails there
+		TArray<FDcExtraTestSqliteItem> Arr;
+		UTEST_DIAG("Extra Sqlite Bulk", DcExtra::LoadStructArrayFromSQLite(
+			&TestDb,
+			TEXT("SELECT * FROM items"),
+			Arr
+			), DcDReadWrite, CantFindPropertyByName);
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Extra.Sqlite.Save")
+{
+	using namespace DcExtra;
+
+	FSQLiteDatabase TestDb;
+	UTEST_TRUE("Extra Sqlite Save", TestDb.Open(TEXT(":memory:"), ESQLiteDatabaseOpenMode::ReadWriteCreate));
+	ON_SCOPE_EXIT { TestDb.Close(); };
+
+	TArray<FDcExtraTestSqliteItem> Source;
+	for (int Ix = 0; Ix < 25; Ix++)
+	{
+		FDcExtraTestSqliteItem& Item = Source.AddDefaulted_GetRef();
+		Item.Id = (int64)Ix << 40;
+		Item.Weight = Ix + 0.25;
+		Item.Name = FName(TEXT("Item"), Ix);
+		Item.Note = FText::FromString(FString::Printf(TEXT("Note %d"), Ix));
+		Item.Stock = -Ix;
+	}
+
+	FDcSqliteSaveOptions Options;
+	Options.BatchSize = 10;
+	Options.bJournalWAL = true;
+	Options.bSynchronousOff = true;
+	int64 Synchronous;
+	UTEST_OK("Extra Sqlite Save", SqliteDetails::QueryPragmaInt(&TestDb, TEXT("PRAGMA synchronous"), Synchronous));
+	UTEST_TRUE("Extra Sqlite Save", Synchronous != 0);
+	UTEST_OK("Extra Sqlite Save", DcExtra::SaveStructArrayToSQLite(&TestDb, TEXT("items"), Source, Options));
+
+	int64 SynchronousAfter;
+	UTEST_OK("Extra Sqlite Save", SqliteDetails::QueryPragmaInt(&TestDb, TEXT("PRAGMA synchronous"), SynchronousAfter));
+	UTEST_EQUAL("Extra Sqlite Save", SynchronousAfter, Synchronous);
+
+	{
+		//	restored on failure too
+		FDcSqliteSaveOptions MissingOptions = Options;
+		MissingOptions.bCreateTable = false;
+		UTEST_DIAG("Extra Sqlite Save", DcExtra::SaveStructArrayToSQLite(&TestDb, TEXT("missing_items"), Source, MissingOptions), DcDExtra, SqliteLastError);
+		UTEST_OK("Extra Sqlite Save", SqliteDetails::QueryPragmaInt(&TestDb, TEXT("PRAGMA synchronous"), SynchronousAfter));
+		UTEST_EQUAL("Extra Sqlite Save", SynchronousAfter, Synchronous);
+	}
+
+	//	appends to existing table
+	Options.bCreateTable = false;
+	UTEST_OK("Extra Sqlite Save", DcExtra::SaveStructArrayToSQLite(&TestDb, TEXT("items"), Source, Options));
+
+	TArray<FDcExtraTestSqliteItem> Arr;
+	UTEST_OK("Extra Sqlite Save", DcExtra::LoadStructArrayFromSQLite(
+		&TestDb,
+		TEXT("SELECT * FROM items ORDER BY rowid LIMIT 25"),
+		Arr
+		));
+
+	UTEST_EQUAL("Extra Sqlite Save", Arr.Num(), Source.Num());
+	for (int Ix = 0; Ix < Arr.Num(); Ix++)
+	{
+		UTEST_EQUAL("Extra Sqlite Save", Arr[Ix].Id, Source[Ix].Id);
+		UTEST_EQUAL("Extra Sqlite Save", Arr[Ix].Weight, Source[Ix].Weight);
+		UTEST_TRUE("Extra Sqlite Save", Arr[Ix].Name == Source[Ix].Name);
+		UTEST_EQUAL("Extra Sqlite Save", Arr[Ix].Note.ToString(), Source[Ix].Note.ToString());
+		UTEST_EQUAL("Extra Sqlite Save", Arr[Ix].Stock, Source[Ix].Stock);
+	}
+
+	{
+		TArray<FDcExtraTestSqliteItem> Count;
+		UTEST_OK("Extra Sqlite Save", DcExtra::LoadStructArrayFromSQLite(&TestDb, TEXT("SELECT Id FROM items"), Count));
+		UTEST_EQUAL("Extra Sqlite Save", Count.Num(), 50);
+	}
+
+	{
+		//	struct fields aren't mapped to columns
+		TArray<FDcExtraTestStructWithColor1> Colors;
+		Colors.AddDefaulted();
+		UTEST_DIAG("Extra Sqlite Save", DcExtra::SaveStructArrayToSQLite(&TestDb, TEXT("colors"), Colors), DcDExtra, SqliteUnsupportedProperty);
+	}
+
+	{
+		FDcSqliteSaveOptions BadOptions;
+		BadOptions.BatchSize = 0;
+		UTEST_DIAG("Extra Sqlite Save", DcExtra::SaveStructArrayToSQLite(&TestDb, TEXT("items"), Source, BadOptions), DcDExtra, SqliteInvalidBatchSize);
+	}
+
+	{
+		//	table name is quoted, inside caller's transaction
+		FDcSqliteSaveOptions TxOptions;
+		TxOptions.BatchSize = 10;
+		UTEST_TRUE("Extra Sqlite Save", TestDb.Execute(TEXT("BEGIN")));
+		UTEST_OK("Extra Sqlite Save", DcExtra::SaveStructArrayToSQLite(&TestDb, TEXT("odd \"items"), Source, TxOptions));
+		UTEST_TRUE("Extra Sqlite Save", TestDb.Execute(TEXT("ROLLBACK")));
+
+		//	rolled back along with the caller, table is gone
+		TArray<FDcExtraTestSqliteItem> Count;
+		UTEST_DIAG("Extra Sqlite Save", DcExtra::LoadStructArrayFromSQLite(&TestDb, TEXT("SELECT Id FROM \"odd \"\"items\""), Count), DcDExtra, SqliteLastError);
+
+		UTEST_OK("Extra Sqlite Save", DcExtra::SaveStructArrayToSQLite(&TestDb, TEXT("odd \"items"), Source, TxOptions));
+		UTEST_OK("Extra Sqlite Save", DcExtra::LoadStructArrayFromSQLite(&TestDb, TEXT("SELECT Id FROM \"odd \"\"items\""), Count));
+		UTEST_EQUAL("Extra Sqlite Save", Count.Num(), Source.Num());
+	}
+
+	return true;
+}
@@ -56,11 +56,12 @@ FDcResult DcHandlerDeserializeAnyStruct(
 		DC_TRY(FuncLocateStruct(Ctx, Str, LoadStruct));
 		check(LoadStruct);
 
-		void* DataPtr = (uint8*)FMemory::Malloc(LoadStruct->GetStructureSize());
-		LoadStruct->InitializeStruct(DataPtr);
-		FDcAnyStruct TmpAny{DataPtr, LoadStruct};
-
-		*AnyStructPtr = MoveTemp(TmpAny);
+		//	sole owner of the same struct type is reset in place, otherwise it's a new allocation
+		if (AnyStructPtr->StructClass == LoadStruct
+			&& AnyStructPtr->GetSharedReferenceCount() == 1)
+			LoadStruct->ClearScriptStruct(AnyStructPtr->DataPtr);
+		else
+			*AnyStructPtr = FDcAnyStruct::Allocate(LoadStruct);
 
 		DC_TRY(Ctx.Writer->PushTopStructPropertyState({LoadStruct, (void*)AnyStructPtr->DataPtr}, Ctx.TopProperty().GetFName()));
 
@@ -191,6 +192,37 @@ DC_TEST("DataConfig.Extra.AnyStructRefCounts")
 	return true;
 }
 
+DC_TEST("DataConfig.Extra.AnyStructAllocate")
+{
+	{
+		FDcAnyStruct Any1 = FDcAnyStruct::Allocate<FDcExtraTestSimpleStruct1>();
+		UTEST_TRUE("Extra AnyStruct allocate", Any1.StructClass == FDcExtraTestSimpleStruct1::StaticStruct());
+		UTEST_EQUAL("Extra AnyStruct allocate", Any1.GetChecked<FDcExtraTestSimpleStruct1>()->IntFieldWithDefault, 253);
+		UTEST_TRUE("Extra AnyStruct allocate", IsAligned(Any1.DataPtr, FDcExtraTestSimpleStruct1::StaticStruct()->GetMinAlignment()));
+
+		FDcAnyStruct Any2 = Any1;
+		UTEST_EQUAL("Extra AnyStruct allocate", Any1.GetSharedReferenceCount(), 2);
+	}
+
+	{
+		uint32 DestructCalledCount = 0;
+		{
+			FDcAnyStruct Any1 = FDcAnyStruct::Allocate<FDcExtraTestDestructDelegateContainer>();
+			Any1.GetChecked<FDcExtraTestDestructDelegateContainer>()->DestructAction.BindLambda([&DestructCalledCount]{
+				DestructCalledCount++;
+			});
+
+			FDcAnyStruct Any2{ Any1 };
+			FDcAnyStruct Any3 = MoveTemp(Any1);
+			FDcAnyStruct Any4 = _IdentityByValue(Any2);
+		}
+
+		UTEST_EQUAL("Extra AnyStruct allocate", DestructCalledCount, 1);
+	}
+
+	return true;
+}
+
 #if WITH_EDITORONLY_DATA
 DC_TEST("DataConfig.Extra.SerDe.AnyStruct")
 {
@@ -238,6 +270,29 @@ DC_TEST("DataConfig.Extra.SerDe.AnyStruct")
 		UTEST_TRUE("Extra FAnyStruct SerDe", !Dest.AnyStructField3.IsValid());
 	}
 
+	{
+		//	sole owner of the same type is deserialized in place
+		void* PrevDataPtr = Dest.AnyStructField1.DataPtr;
+		Dest.AnyStructField1.GetChecked<FDcExtraTestSimpleStruct1>()->IntFieldWithDefault = 0;
+
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Extra FAnyStruct SerDe", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[](FDcDeserializeContext& Ctx) {
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FDcAnyStruct>::Get(),
+				FDcDeserializeDelegate::CreateStatic(HandlerDcAnyStructDeserialize)
+			);
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FColor>::Get(),
+				FDcDeserializeDelegate::CreateStatic(HandlerColorDeserialize)
+			);
+		}));
+
+		UTEST_TRUE("Extra FAnyStruct SerDe", Dest.AnyStructField1.DataPtr == PrevDataPtr);
+		UTEST_TRUE("Extra FAnyStruct SerDe", Dest.AnyStructField1.GetChecked<FDcExtraTestSimpleStruct1>()->NameField == TEXT("Foo"));
+		UTEST_TRUE("Extra FAnyStruct SerDe", Dest.AnyStructField1.GetChecked<FDcExtraTestSimpleStruct1>()->IntFieldWithDefault == 253);
+	}
+
 	{
 		FDcJsonWriter Writer;
 		UTEST_OK("Extra FAnyStruct SerDe", DcAutomationUtils::SerializeInto(&Writer, DestDatum,
@@ -0,0 +1,487 @@
+#include "DataConfig/Extra/SerDe/DcSerDeLazyStruct.h"
+#include "DataConfig/DcTypes.h"
+#include "DataConfig/DcEnv.h"
+#include "DataConfig/Reader/DcReader.h"
+#include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Deserialize/DcDeserializeTypes.h"
+#include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/Deserialize/DcDeserializerSetup.h"
+#include "DataConfig/SerDe/DcSerDeUtils.h"
+#include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
+#include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
+#include "DataConfig/Reader/DcPutbackReader.h"
+#include "DataConfig/Automation/DcAutomation.h"
+#include "DataConfig/Automation/DcAutomationUtils.h"
+#include "DataConfig/Deserialize/DcDeserializeUtils.h"
+#include "DataConfig/Misc/DcPipeVisitor.h"
+#include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/MsgPack/DcMsgPackReader.h"
+#include "DataConfig/MsgPack/DcMsgPackWriter.h"
+
+#include "DataConfig/Extra/Types/DcExtraTestFixtures.h"
+#include "DataConfig/Extra/Diagnostic/DcDiagnosticExtra.h"
+#include "DataConfig/Extra/SerDe/DcSerDeColor.h"
+#include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/Serialize/DcSerializeUtils.h"
+#include "DataConfig/Writer/DcPutbackWriter.h"
+
+namespace DcSerDeLazyStructDetails
+{
+
+using ESourceType = FDcLazyStruct::ESourceType;
+
+struct FSpanCapture
+{
+	ESourceType Type = ESourceType::None;
+	int32 Begin = 0;
+	int32 End = 0;
+	int32 Line = 1;
+	FString DiagFilePath;
+};
+
+template<typename CharType>
+static void BeginJsonCapture(TDcJsonReader<CharType>* Reader, ESourceType Type, FSpanCapture& OutSpan)
+{
+	//	token is the open curly after peeking
+	OutSpan.Type = Type;
+	OutSpan.Begin = Reader->Token.Ref.Begin;
+	OutSpan.Line = Reader->Loc.Line;
+	OutSpan.DiagFilePath = Reader->DiagFilePath;
+}
+
+template<typename CharType>
+static void MarkJsonEnd(TDcJsonReader<CharType>* Reader, FSpanCapture& OutSpan)
+{
+	//	token is the close curly after peeking `MapEnd`, `ReadMapEnd` would move on to the next `,`
+	OutSpan.End = Reader->Token.Ref.Begin + Reader->Token.Ref.Num;
+}
+
+template<typename CharType>
+static void EndJsonCapture(TDcJsonReader<CharType>* Reader, const FSpanCapture& Span, TArray<uint8>& OutSource)
+{
+	OutSource.Append((const uint8*)(Reader->Buf.Buffer + Span.Begin), (Span.End - Span.Begin) * sizeof(CharType));
+}
+
+static void BeginCapture(FDcReader* Reader, FSpanCapture& OutSpan)
+{
+	if (FDcWideJsonReader* WideJson = Reader->CastById<FDcWideJsonReader>())
+		BeginJsonCapture(WideJson, ESourceType::WideJson, OutSpan);
+	else if (FDcAnsiJsonReader* AnsiJson = Reader->CastById<FDcAnsiJsonReader>())
+		BeginJsonCapture(AnsiJson, ESourceType::AnsiJson, OutSpan);
+	else if (FDcMsgPackReader* MsgPack = Reader->CastById<FDcMsgPackReader>())
+	{
+		OutSpan.Type = ESourceType::MsgPack;
+		OutSpan.Begin = MsgPack->State.Index;
+	}
+}
+
+static void MarkCaptureEnd(FDcReader* Reader, FSpanCapture& OutSpan)
+{
+	switch (OutSpan.Type)
+	{
+		case ESourceType::WideJson:
+			MarkJsonEnd(Reader->CastByIdChecked<FDcWideJsonReader>(), OutSpan);
+			break;
+		case ESourceType::AnsiJson:
+			MarkJsonEnd(Reader->CastByIdChecked<FDcAnsiJsonReader>(), OutSpan);
+			break;
+		default:
+			break;
+	}
+}
+
+static void EndCapture(FDcReader* Reader, const FSpanCapture& Span, FDcLazyStruct& Out)
+{
+	Out.SourceType = Span.Type;
+	Out.SourceLine = Span.Line;
+	Out.DiagFilePath = Span.DiagFilePath;
+
+	switch (Span.Type)
+	{
+		case ESourceType::WideJson:
+			EndJsonCapture(Reader->CastByIdChecked<FDcWideJsonReader>(), Span, Out.Source);
+			break;
+		case ESourceType::AnsiJson:
+			EndJsonCapture(Reader->CastByIdChecked<FDcAnsiJsonReader>(), Span, Out.Source);
+			break;
+		case ESourceType::MsgPack:
+		{
+			FDcMsgPackReader* MsgPack = Reader->CastByIdChecked<FDcMsgPackReader>();
+			Out.Source.Append(MsgPack->View.DataPtr + Span.Begin, MsgPack->State.Index - Span.Begin);
+			break;
+		}
+		default:
+			checkNoEntry();
+	}
+}
+
+static FDcResult PipeValue(FDcReader* Reader, FDcWriter* Writer)
+{
+	FDcPipeVisitor PipeVisitor(Reader, Writer);
+	PipeVisitor.PeekVisit.BindLambda([](FDcPipeVisitor* Visitor, EDcDataEntry Next, EPipeVisitControl& OutControl)
+	{
+		if (Next == EDcDataEntry::Ended)
+			OutControl = EPipeVisitControl::BreakVisit;
+		return DcOk();
+	});
+
+	return PipeVisitor.PipeVisit();
+}
+
+static FDcResult PipeSource(const FDcLazyStruct& Lazy, FDcWriter* Writer)
+{
+	switch (Lazy.SourceType)
+	{
+		case ESourceType::WideJson:
+		{
+			FDcWideJsonReader Reader((const WIDECHAR*)Lazy.Source.GetData(), Lazy.Source.Num() / sizeof(WIDECHAR));
+			return PipeValue(&Reader, Writer);
+		}
+		case ESourceType::AnsiJson:
+		{
+			FDcAnsiJsonReader Reader((const ANSICHAR*)Lazy.Source.GetData(), Lazy.Source.Num() / sizeof(ANSICHAR));
+			return PipeValue(&Reader, Writer);
+		}
+		case ESourceType::MsgPack:
+		{
+			FDcMsgPackReader Reader(FDcBlobViewData::From(Lazy.Source));
+			return PipeValue(&Reader, Writer);
+		}
+		default:
+			return DcNoEntry();
+	}
+}
+
+} // namespace DcSerDeLazyStructDetails
+
+namespace DcExtra
+{
+
+FDcResult DcHandlerDeserializeLazyStruct(
+	FDcDeserializeContext& Ctx,
+	TFunctionRef<FDcResult(FDcDeserializeContext&, const FString&, UScriptStruct*&)> FuncLocateStruct
+) {
+	using namespace DcSerDeLazyStructDetails;
+
+	EDcDataEntry Next;
+	DC_TRY(Ctx.Reader->PeekRead(&Next));
+
+	FDcPropertyDatum Datum;
+	DC_TRY(Ctx.Writer->WriteDataEntry(FStructProperty::StaticClass(), Datum));
+	FDcLazyStruct* LazyStructPtr = (FDcLazyStruct*)Datum.DataPtr;
+
+	if (Next == EDcDataEntry::None)
+	{
+		DC_TRY(Ctx.Reader->ReadNone());
+		LazyStructPtr->Reset();
+
+		return DcOk();
+	}
+	else if (Next == EDcDataEntry::MapRoot)
+	{
+		FSpanCapture Span;
+		BeginCapture(Ctx.Reader, Span);
+
+		DC_TRY(Ctx.Reader->ReadMapRoot());
+		FString Str;
+		DC_TRY(Ctx.Reader->ReadString(&Str));
+		if (Str != TEXT("$type"))
+			return DC_FAIL(DcDSerDe, ExpectMetaType);
+
+		DC_TRY(Ctx.Reader->ReadString(&Str));
+		UScriptStruct* LoadStruct = nullptr;
+		DC_TRY(FuncLocateStruct(Ctx, Str, LoadStruct));
+		check(LoadStruct);
+
+		LazyStructPtr->Reset();
+		LazyStructPtr->StructClass = LoadStruct;
+
+		if (Span.Type == ESourceType::None)
+		{
+			//	source can't be retained from this reader, deserialize eagerly
+			LazyStructPtr->Resolved = FDcAnyStruct::Allocate(LoadStruct);
+
+			DC_TRY(Ctx.Writer->PushTopStructPropertyState({LoadStruct, LazyStructPtr->Resolved.DataPtr}, Ctx.TopProperty().GetFName()));
+
+			FDcPutbackReader PutbackReader(Ctx.Reader);
+			PutbackReader.Putback(EDcDataEntry::MapRoot);
+			TDcStoreThenReset<FDcReader*> RestoreReader(Ctx.Reader, &PutbackReader);
+
+			DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
+			return DcOk();
+		}
+
+		//	fields are only skipped over, as it's done by `bIgnoreUnknownFields`
+		while (true)
+		{
+			DC_TRY(Ctx.Reader->PeekRead(&Next));
+			if (Next == EDcDataEntry::MapEnd)
+				break;
+
+			DC_TRY(Ctx.Reader->SkipValue());
+			DC_TRY(Ctx.Reader->SkipValue());
+		}
+		MarkCaptureEnd(Ctx.Reader, Span);
+		DC_TRY(Ctx.Reader->ReadMapEnd());
+
+		EndCapture(Ctx.Reader, Span, *LazyStructPtr);
+		return DcOk();
+	}
+	else
+	{
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch2)
+			<< EDcDataEntry::MapRoot << EDcDataEntry::None << Next;
+	}
+}
+
+FDcResult DcHandlerSerializeLazyStruct(FDcSerializeContext& Ctx, TFunctionRef<FString(UScriptStruct* InStruct)> FuncWriteStructType)
+{
+	FDcPropertyDatum Datum;
+	DC_TRY(Ctx.Reader->ReadDataEntry(FStructProperty::StaticClass(), Datum));
+
+	FDcLazyStruct* LazyStructPtr = (FDcLazyStruct*)Datum.DataPtr;
+
+	if (LazyStructPtr->IsResolved())
+	{
+		FDcAnyStruct& Resolved = LazyStructPtr->Resolved;
+		DC_TRY(Ctx.Writer->WriteMapRoot());
+		DC_TRY(Ctx.Writer->WriteString(TEXT("$type")));
+		DC_TRY(Ctx.Writer->WriteString(FuncWriteStructType(Resolved.StructClass)));
+
+		DC_TRY(Ctx.Reader->PushTopStructPropertyState(
+			{Resolved.StructClass, Resolved.DataPtr},
+			Ctx.TopProperty().GetFName())
+		);
+
+		FDcPutbackWriter PutbackWriter{Ctx.Writer};
+		PutbackWriter.Putback(EDcDataEntry::MapRoot);
+		TDcStoreThenReset<FDcWriter*> RestoreWriter(Ctx.Writer, &PutbackWriter);
+
+		DC_TRY(DcSerializeUtils::RecursiveSerialize(Ctx));
+	}
+	else if (LazyStructPtr->HasSource())
+	{
+		DC_TRY(DcSerDeLazyStructDetails::PipeSource(*LazyStructPtr, Ctx.Writer));
+	}
+	else
+	{
+		DC_TRY(Ctx.Writer->WriteNone());
+	}
+
+	return DcOk();
+}
+
+FDcResult HandlerDcLazyStructDeserialize(FDcDeserializeContext& Ctx)
+{
+	return DcHandlerDeserializeLazyStruct(Ctx, [](FDcDeserializeContext& Ctx, const FString& Str, UScriptStruct*& OutStruct)
+	{
+		DC_TRY(DcSerDeUtils::TryLocateObject(Str, OutStruct));
+		check(OutStruct != nullptr);
+		return DcOk();
+	});
+}
+
+FDcResult HandlerDcLazyStructSerialize(FDcSerializeContext& Ctx)
+{
+	return DcHandlerSerializeLazyStruct(Ctx, [](UScriptStruct* Struct)
+	{
+		return DcSerDeUtils::FormatObjectName(Struct);
+	});
+}
+
+} // namespace DcExtra
+
+#if WITH_EDITORONLY_DATA
+DC_TEST("DataConfig.Extra.SerDe.LazyStruct")
+{
+	DcAutomationUtils::AmendMetaData(FDcExtraTestSimpleStruct1::StaticStruct(), TEXT("IntFieldWithDefault"), TEXT("DcSkip"), TEXT(""));
+
+	using namespace DcExtra;
+	FDcExtraTestWithLazyStruct1 Dest;
+	FDcPropertyDatum DestDatum(&Dest);
+
+	FString Str = TEXT(R"(
+
+		{
+			"LazyStructField1" : {
+				"$type" : "DcExtraTestSimpleStruct1",
+				"NameField" : "Foo"
+			},
+			"LazyStructField2" : {
+				"$type" : "DcExtraTestStructWithColor1",
+				"ColorField1" : "#0000FFFF",
+				"ColorField2" : "#FF0000FF"
+			},
+			"LazyStructField3" : null
+		}
+
+	)");
+
+	FDcDeserializer Deserializer;
+	DcSetupJsonDeserializeHandlers(Deserializer);
+	Deserializer.AddStructHandler(
+		TBaseStructure<FColor>::Get(),
+		FDcDeserializeDelegate::CreateStatic(HandlerColorDeserialize)
+	);
+
+	{
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Extra FDcLazyStruct SerDe", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[](FDcDeserializeContext& Ctx) {
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FDcLazyStruct>::Get(),
+				FDcDeserializeDelegate::CreateStatic(HandlerDcLazyStructDeserialize)
+			);
+		}));
+
+		UTEST_TRUE("Extra FDcLazyStruct SerDe", Dest.LazyStructField1.StructClass == FDcExtraTestSimpleStruct1::StaticStruct());
+		UTEST_TRUE("Extra FDcLazyStruct SerDe", Dest.LazyStructField1.HasSource());
+		UTEST_FALSE("Extra FDcLazyStruct SerDe", Dest.LazyStructField1.IsResolved());
+		UTEST_TRUE("Extra FDcLazyStruct SerDe", Dest.LazyStructField2.StructClass == FDcExtraTestStructWithColor1::StaticStruct());
+		UTEST_FALSE("Extra FDcLazyStruct SerDe", Dest.LazyStructField2.IsResolved());
+		UTEST_FALSE("Extra FDcLazyStruct SerDe", Dest.LazyStructField3.IsValid());
+
+		FDcExtraTestSimpleStruct1* Simple1;
+		UTEST_OK("Extra FDcLazyStruct SerDe", Dest.LazyStructField1.Get(&Deserializer, Simple1));
+		UTEST_TRUE("Extra FDcLazyStruct SerDe", Simple1->NameField == TEXT("Foo"));
+		UTEST_TRUE("Extra FDcLazyStruct SerDe", Simple1->IntFieldWithDefault == 253);
+		UTEST_TRUE("Extra FDcLazyStruct SerDe", Dest.LazyStructField1.IsResolved());
+		UTEST_FALSE("Extra FDcLazyStruct SerDe", Dest.LazyStructField1.HasSource());
+
+		UTEST_DIAG("Extra FDcLazyStruct SerDe", Dest.LazyStructField3.Resolve(&Deserializer), DcDExtra, LazyStructNotSet);
+	}
+
+	{
+		//	resolved field is serialized from struct, unresolved field is piped from source
+		FDcJsonWriter Writer;
+		UTEST_OK("Extra FDcLazyStruct SerDe", DcAutomationUtils::SerializeInto(&Writer, DestDatum,
+		[](FDcSerializeContext& Ctx) {
+			Ctx.Serializer->AddStructHandler(
+				TBaseStructure<FDcLazyStruct>::Get(),
+				FDcSerializeDelegate::CreateStatic(HandlerDcLazyStructSerialize)
+			);
+		}));
+		Writer.Sb << TCHAR('\n');
+		UTEST_EQUAL("Extra FDcLazyStruct SerDe", Writer.Sb.ToString(), DcAutomationUtils::DcReindentStringLiteral(Str));
+	}
+
+	{
+		FDcExtraTestStructWithColor1* Color1;
+		UTEST_OK("Extra FDcLazyStruct SerDe", Dest.LazyStructField2.Get(&Deserializer, Color1));
+		UTEST_TRUE("Extra FDcLazyStruct SerDe", Color1->ColorField1 == FColor::Blue);
+		UTEST_TRUE("Extra FDcLazyStruct SerDe", Color1->ColorField2 == FColor::Red);
+	}
+
+	return true;
+}
+#endif // WITH_EDITORONLY_DATA
+
+DC_TEST("DataConfig.Extra.SerDe.LazyStructSpan")
+{
+	using namespace DcExtra;
+	FDcExtraTestWithLazyStruct1 Dest;
+	FDcPropertyDatum DestDatum(&Dest);
+
+	//	lazy object followed by sibling fields, captured source stops at its close curly
+	FString Str = TEXT(R"(
+
+		{
+			"LazyStructField1" : null,
+			"LazyStructField2" : {
+				"$type" : "DcExtraTestSimpleStruct1",
+				"NameField" : "Foo"
+			},
+			"LazyStructField3" : null
+		}
+
+	)");
+
+	{
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Extra FDcLazyStruct Span", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[](FDcDeserializeContext& Ctx) {
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FDcLazyStruct>::Get(),
+				FDcDeserializeDelegate::CreateStatic(HandlerDcLazyStructDeserialize)
+			);
+		}));
+	}
+
+	UTEST_TRUE("Extra FDcLazyStruct Span", Dest.LazyStructField2.HasSource());
+	UTEST_FALSE("Extra FDcLazyStruct Span", Dest.LazyStructField2.IsResolved());
+	const TArray<uint8>& Source = Dest.LazyStructField2.Source;
+	UTEST_TRUE("Extra FDcLazyStruct Span", Source.Num() >= (int)sizeof(TCHAR));
+	UTEST_TRUE("Extra FDcLazyStruct Span", ((const TCHAR*)Source.GetData())[Source.Num() / sizeof(TCHAR) - 1] == TCHAR('}'));
+
+	{
+		FDcJsonWriter Writer;
+		UTEST_OK("Extra FDcLazyStruct Span", DcAutomationUtils::SerializeInto(&Writer, DestDatum,
+		[](FDcSerializeContext& Ctx) {
+			Ctx.Serializer->AddStructHandler(
+				TBaseStructure<FDcLazyStruct>::Get(),
+				FDcSerializeDelegate::CreateStatic(HandlerDcLazyStructSerialize)
+			);
+		}));
+		Writer.Sb << TCHAR('\n');
+		UTEST_EQUAL("Extra FDcLazyStruct Span", Writer.Sb.ToString(), DcAutomationUtils::DcReindentStringLiteral(Str));
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Extra.SerDe.LazyStructMsgPack")
+{
+	using namespace DcExtra;
+
+	FDcMsgPackWriter Writer;
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteMapRoot());
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteString(TEXT("LazyStructField1")));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteMapRoot());
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteString(TEXT("$type")));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteString(TEXT("DcExtraTestSimpleStruct1")));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteString(TEXT("NameField")));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteString(TEXT("Bar")));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteString(TEXT("Unknown")));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteInt32(123));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteMapEnd());
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteString(TEXT("LazyStructField2")));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteNone());
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteString(TEXT("LazyStructField3")));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteNone());
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Writer.WriteMapEnd());
+
+	FDcExtraTestWithLazyStruct1 Dest;
+	{
+		FDcMsgPackReader Reader(FDcBlobViewData::From(Writer.GetMainBuffer()));
+		UTEST_OK("Extra FDcLazyStruct MsgPack", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest),
+		[](FDcDeserializeContext& Ctx) {
+			DcSetupMsgPackDeserializeHandlers(*Ctx.Deserializer);
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FDcLazyStruct>::Get(),
+				FDcDeserializeDelegate::CreateStatic(HandlerDcLazyStructDeserialize)
+			);
+		}, DcAutomationUtils::EDefaultSetupType::SetupNothing));
+	}
+
+	UTEST_TRUE("Extra FDcLazyStruct MsgPack", Dest.LazyStructField1.SourceType == FDcLazyStruct::ESourceType::MsgPack);
+	UTEST_FALSE("Extra FDcLazyStruct MsgPack", Dest.LazyStructField2.IsValid());
+
+	FDcDeserializer Deserializer;
+	DcSetupMsgPackDeserializeHandlers(Deserializer);
+
+	//	errors are deferred to resolving
+	FDcLazyStruct Copied = Dest.LazyStructField1;
+	UTEST_DIAG("Extra FDcLazyStruct MsgPack", Copied.Resolve(&Deserializer), DcDReadWrite, CantFindPropertyByName);
+	UTEST_FALSE("Extra FDcLazyStruct MsgPack", Copied.IsResolved());
+
+	FDcExtraTestSimpleStruct1* Simple1;
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Dest.LazyStructField1.Resolve(&Deserializer, [](FDcDeserializeContext& Ctx)
+	{
+		Ctx.bIgnoreUnknownFields = true;
+	}));
+	UTEST_OK("Extra FDcLazyStruct MsgPack", Dest.LazyStructField1.Get(&Deserializer, Simple1));
+	UTEST_TRUE("Extra FDcLazyStruct MsgPack", Simple1->NameField == TEXT("Bar"));
+
+	return true;
+}
+
@@ -38,7 +38,11 @@ FDcResult HandlerRootObjectDeserialize(FDcDeserializeContext& Ctx)
 
 		FName FieldName;
 		DC_TRY(Ctx.Reader->ReadName(&FieldName));
-		DC_TRY(Ctx.Writer->WriteName(FieldName));
+
+		bool bSkipped;
+		DC_TRY(DcDeserializeUtils::WriteFieldNameOrSkip(Ctx, Ctx.Reader, FieldName, &bSkipped));
+		if (bSkipped)
+			continue;
 
 		DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
 	}
@@ -15,6 +15,43 @@ void FDcAnyStruct::AnyStructReferenceController::DestroyObject()
 	FMemory::Free(DataPtr);
 }
 
+FDcAnyStruct::AnyStructInlineReferenceController* FDcAnyStruct::AnyStructInlineReferenceController::Create(UScriptStruct* InStructClass)
+{
+	check(InStructClass);
+	int32 Alignment = FMath::Max(InStructClass->GetMinAlignment(), (int32)alignof(AnyStructInlineReferenceController));
+	int32 HeaderSize = Align((int32)sizeof(AnyStructInlineReferenceController), Alignment);
+
+	void* Mem = FMemory::Malloc(HeaderSize + InStructClass->GetStructureSize(), Alignment);
+	AnyStructInlineReferenceController* Controller = new (Mem) AnyStructInlineReferenceController();
+	Controller->DataPtr = (uint8*)Mem + HeaderSize;
+	Controller->StructClass = InStructClass;
+
+	InStructClass->InitializeStruct(Controller->DataPtr);
+	return Controller;
+}
+
+void FDcAnyStruct::AnyStructInlineReferenceController::DestroyObject()
+{
+	//	memory is released with the controller
+	StructClass->DestroyStruct(DataPtr);
+}
+
+void FDcAnyStruct::AnyStructInlineReferenceController::operator delete(void* Ptr)
+{
+	FMemory::Free(Ptr);
+}
+
+FDcAnyStruct FDcAnyStruct::Allocate(UScriptStruct* InStructClass)
+{
+	AnyStructInlineReferenceController* Controller = AnyStructInlineReferenceController::Create(InStructClass);
+
+	FDcAnyStruct Ret;
+	Ret.DataPtr = Controller->DataPtr;
+	Ret.StructClass = InStructClass;
+	Ret.SharedReferenceCount = FSharedReferencer(Controller);
+	return Ret;
+}
+
 void FDcAnyStruct::DebugDump()
 {
 	FString Dumped = DcAutomationUtils::DumpFormat(FDcPropertyDatum(StructClass, DataPtr));
@@ -18,6 +18,15 @@
 namespace DcExtra
 {
 
+FDcNameToStringCache& GetCamelCaseNameCache()
+{
+	static FDcNameToStringCache Cache([](const FName& Name)
+	{
+		return FJsonObjectConverter::StandardizeCase(Name.ToString());
+	});
+	return Cache;
+}
+
 namespace JsonConverterDetails
 {
 
@@ -39,7 +48,7 @@ static FDcResult HandlerStructRootSerializeCamelCase(FDcSerializeContext& Ctx)
 		{
 			FName Value;
 			DC_TRY(Ctx.Reader->ReadName(&Value));
-			DC_TRY(Ctx.Writer->WriteString(FJsonObjectConverter::StandardizeCase(Value.ToString())));
+			DC_TRY(Ctx.Writer->WriteString(GetCamelCaseNameCache().Get(Value)));
 		}
 		else
 		{
@@ -75,7 +84,7 @@ static FDcResult HandlerClassRootSerializeCamelCase(FDcSerializeContext& Ctx)
 		{
 			FName Value;
 			DC_TRY(Ctx.Reader->ReadName(&Value));
-			DC_TRY(Ctx.Writer->WriteString(FJsonObjectConverter::StandardizeCase(Value.ToString())));
+			DC_TRY(Ctx.Writer->WriteString(GetCamelCaseNameCache().Get(Value)));
 		}
 		else
 		{
@@ -92,31 +101,25 @@ static FDcResult HandlerClassRootSerializeCamelCase(FDcSerializeContext& Ctx)
 	return DcOk();
 }
 
-static TOptional<FDcDeserializer> Deserializer;
-static TOptional<FDcSerializer> Serializer;
-
-static void LazyInitializeSerializer()
+static FDcSerializer& GetSerializer()
 {
-	if (Serializer.IsSet())
-		return;
-
-	Serializer.Emplace();
-	DcSetupJsonSerializeHandlers(Serializer.GetValue());
-
-	//	handle camelCase member names
-	Serializer->UClassSerializerMap[UScriptStruct::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerStructRootSerializeCamelCase);
-	Serializer->UClassSerializerMap[UClass::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerClassRootSerializeCamelCase);
-	Serializer->FieldClassSerializerMap[FStructProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerStructRootSerializeCamelCase);
-}
+	static FDcSerializer Serializer;
+	static bool bInitialized = []
+	{
+		Serializer.Parent = &DcGetSharedJsonSerializer();
 
+		//	handle camelCase member names
+		//	maps are empty until `Freeze()`, entries added here take precedence over `Parent`
+		Serializer.AddDirectHandler(UScriptStruct::StaticClass(), FDcSerializeDelegate::CreateStatic(HandlerStructRootSerializeCamelCase));
+		Serializer.AddDirectHandler(UClass::StaticClass(), FDcSerializeDelegate::CreateStatic(HandlerClassRootSerializeCamelCase));
+		Serializer.AddDirectHandler(FStructProperty::StaticClass(), FDcSerializeDelegate::CreateStatic(HandlerStructRootSerializeCamelCase));
 
-static void LazyInitializeDeserializer()
-{
-	if (Deserializer.IsSet())
-		return;
+		Serializer.Freeze();
+		return true;
+	}();
+	(void)bInitialized;
 
-	Deserializer.Emplace();
-	DcSetupJsonDeserializeHandlers(Deserializer.GetValue());
+	return Serializer;
 }
 
 } // namespace JsonConverterDetails
@@ -125,18 +128,15 @@ static void LazyInitializeDeserializer()
 bool JsonObjectReaderToUStruct(FDcReader* Reader, FDcPropertyDatum Datum)
 {
 	FDcResult Ret = [&]() -> FDcResult {
-		using namespace JsonConverterDetails;
-		LazyInitializeDeserializer();
-
 		FDcPropertyWriter Writer(Datum);
 
 		FDcDeserializeContext Ctx;
 		Ctx.Reader = Reader;
 		Ctx.Writer = &Writer;
-		Ctx.Deserializer = &Deserializer.GetValue();
+		Ctx.Deserializer = &DcGetSharedJsonDeserializer();
 		DC_TRY(Ctx.Prepare());
 
-		DC_TRY(Deserializer->Deserialize(Ctx));
+		DC_TRY(Ctx.Deserializer->Deserialize(Ctx));
 		return DcOk();
 	}();
 
@@ -156,17 +156,16 @@ bool UStructToJsonObjectString(FDcPropertyDatum Datum, FDcWriter* Writer)
 	FDcResult Ret = [&]() -> FDcResult
 	{
 		using namespace JsonConverterDetails;
-		LazyInitializeSerializer();
 
 		FDcPropertyReader Reader(Datum);
 
 		FDcSerializeContext Ctx;
 		Ctx.Reader = &Reader;
 		Ctx.Writer = Writer;
-		Ctx.Serializer = &Serializer.GetValue();
+		Ctx.Serializer = &GetSerializer();
 		DC_TRY(Ctx.Prepare());
 
-		DC_TRY(Serializer->Serialize(Ctx));
+		DC_TRY(Ctx.Serializer->Serialize(Ctx));
 		return DcOk();
 	}();
 
@@ -335,3 +334,19 @@ DC_TEST("DataConfig.Extra.JsonConverterArrayDim")
 
 	return true;
 }
+
+DC_TEST("DataConfig.Extra.JsonConverterCamelCase")
+{
+	FDcTestJsonConverter1 Data;
+	Data.StrField = TEXT("Foo");
+
+	//	root struct and nested struct property both go through the camelCase handlers
+	FString Str;
+	UTEST_TRUE("JsonConverter CamelCase", DcExtra::UStructToJsonObjectString(Data, Str));
+	UTEST_TRUE("JsonConverter CamelCase", Str.Contains(TEXT("\"strField\"")));
+	UTEST_TRUE("JsonConverter CamelCase", Str.Contains(TEXT("\"nestField\"")));
+	UTEST_TRUE("JsonConverter CamelCase", Str.Contains(TEXT("\"strArrayField\"")));
+	UTEST_FALSE("JsonConverter CamelCase", Str.Contains(TEXT("\"StrField\"")));
+
+	return true;
+}
@@ -0,0 +1,111 @@
+#include "DataConfig/Extra/Types/DcLazyStruct.h"
+#include "DataConfig/DcEnv.h"
+#include "DataConfig/Reader/DcReader.h"
+#include "DataConfig/Reader/DcPutbackReader.h"
+#include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/Deserialize/DcDeserializeTypes.h"
+#include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/MsgPack/DcMsgPackReader.h"
+#include "DataConfig/Extra/Diagnostic/DcDiagnosticExtra.h"
+
+namespace DcLazyStructDetails
+{
+
+static FDcResult ResolveFrom(
+	FDcLazyStruct& Self,
+	FDcReader* Reader,
+	FDcDeserializer* Deserializer,
+	TFunctionRef<void(FDcDeserializeContext&)> SetupContext)
+{
+	//	source is `{ "$type" : <name>, ...fields }`, type pair is skipped and the rest goes into the struct
+	DC_TRY(Reader->ReadMapRoot());
+	DC_TRY(Reader->ReadString(nullptr));
+	DC_TRY(Reader->ReadString(nullptr));
+
+	FDcAnyStruct TmpAny = FDcAnyStruct::Allocate(Self.StructClass);
+
+	FDcPutbackReader PutbackReader(Reader);
+	PutbackReader.Putback(EDcDataEntry::MapRoot);
+	FDcPropertyWriter Writer(FDcPropertyDatum(Self.StructClass, TmpAny.DataPtr));
+
+	FDcDeserializeContext Ctx;
+	Ctx.Reader = &PutbackReader;
+	Ctx.Writer = &Writer;
+	Ctx.Deserializer = Deserializer;
+	SetupContext(Ctx);
+	DC_TRY(Ctx.Prepare());
+	DC_TRY(Deserializer->Deserialize(Ctx));
+
+	Self.Resolved = MoveTemp(TmpAny);
+	return DcOk();
+}
+
+template<typename CharType>
+static FDcResult ResolveFromJson(
+	FDcLazyStruct& Self,
+	FDcDeserializer* Deserializer,
+	TFunctionRef<void(FDcDeserializeContext&)> SetupContext)
+{
+	TDcJsonReader<CharType> Reader((const CharType*)Self.Source.GetData(), Self.Source.Num() / sizeof(CharType));
+	Reader.Loc.Line = Self.SourceLine;
+	Reader.DiagFilePath = Self.DiagFilePath;
+
+	return ResolveFrom(Self, &Reader, Deserializer, SetupContext);
+}
+
+} // namespace DcLazyStructDetails
+
+void FDcLazyStruct::Reset()
+{
+	StructClass = nullptr;
+	SourceType = ESourceType::None;
+	Source.Empty();
+	SourceLine = 1;
+	DiagFilePath.Empty();
+	Resolved.Reset();
+}
+
+FDcResult FDcLazyStruct::Resolve(FDcDeserializer* Deserializer, TFunctionRef<void(FDcDeserializeContext&)> SetupContext)
+{
+	using namespace DcLazyStructDetails;
+
+	if (IsResolved())
+		return DcOk();
+
+	if (!IsValid() || !HasSource())
+		return DC_FAIL(DcDExtra, LazyStructNotSet);
+
+	check(Deserializer);
+	switch (SourceType)
+	{
+		case ESourceType::WideJson:
+			DC_TRY(ResolveFromJson<WIDECHAR>(*this, Deserializer, SetupContext));
+			break;
+		case ESourceType::AnsiJson:
+			DC_TRY(ResolveFromJson<ANSICHAR>(*this, Deserializer, SetupContext));
+			break;
+		case ESourceType::MsgPack:
+		{
+			FDcMsgPackReader Reader(FDcBlobViewData::From(Source));
+			DC_TRY(ResolveFrom(*this, &Reader, Deserializer, SetupContext));
+			break;
+		}
+		default:
+			return DcNoEntry();
+	}
+
+	//	source isn't needed anymore
+	SourceType = ESourceType::None;
+	Source.Empty();
+	return DcOk();
+}
+
+FDcResult FDcLazyStruct::Resolve(FDcDeserializer* Deserializer)
+{
+	return Resolve(Deserializer, [](FDcDeserializeContext&)
+	{
+		/*pass*/
+	});
+}
+
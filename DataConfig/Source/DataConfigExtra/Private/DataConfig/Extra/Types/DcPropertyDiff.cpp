@@ -0,0 +1,450 @@
+#include "DataConfig/Extra/Types/DcPropertyDiff.h"
+#include "DataConfig/Extra/Types/DcPropertyPathAccess.h"
+#include "DataConfig/Extra/Diagnostic/DcDiagnosticExtra.h"
+#include "DataConfig/Property/DcPropertyUtils.h"
+#include "DataConfig/Property/DcPropertyReader.h"
+#include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Serialize/DcSerializer.h"
+#include "DataConfig/Serialize/DcSerializerSetup.h"
+#include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/Deserialize/DcDeserializerSetup.h"
+#include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/MsgPack/DcMsgPackReader.h"
+#include "DataConfig/MsgPack/DcMsgPackWriter.h"
+#include "DataConfig/Automation/DcAutomation.h"
+#include "DataConfig/Automation/DcAutomationUtils.h"
+
+namespace DcExtra
+{
+
+namespace PropertyDiffDetails
+{
+
+//	path segments are only formatted into a string when an entry is emitted,
+//	so diffing identical data doesn't allocate
+struct FSegment
+{
+	enum class EType : uint8
+	{
+		Name,
+		Index,
+		Str,
+	};
+
+	EType Type;
+	FName Name;
+	int32 Index;
+	const FString* Str;
+};
+
+struct FDiffState
+{
+	TArray<FSegment, TInlineAllocator<16>> Segments;
+	FDcPropertyPatch* Patch;
+
+	FORCEINLINE void PushName(const FName& Name) { Segments.Add({FSegment::EType::Name, Name, INDEX_NONE, nullptr}); }
+	FORCEINLINE void PushIndex(int32 Index) { Segments.Add({FSegment::EType::Index, NAME_None, Index, nullptr}); }
+	FORCEINLINE void PushStr(const FString* Str) { Segments.Add({FSegment::EType::Str, NAME_None, INDEX_NONE, Str}); }
+	FORCEINLINE void Pop() { Segments.Pop(); }
+
+	void Emit(FProperty* Property, void* RhsPtr)
+	{
+		TStringBuilder<256> Sb;
+		for (int Ix = 0; Ix < Segments.Num(); Ix++)
+		{
+			if (Ix != 0)
+				Sb << TCHAR('.');
+
+			const FSegment& Segment = Segments[Ix];
+			if (Segment.Type == FSegment::EType::Name)
+				Sb << Segment.Name.ToString();
+			else if (Segment.Type == FSegment::EType::Index)
+				Sb << Segment.Index;
+			else
+				Sb << *Segment.Str;
+		}
+
+		FDcPropertyPatchEntry& Entry = Patch->Entries.Emplace_GetRef();
+		Entry.Path = Sb.ToString();
+		Entry.Datum = FDcPropertyDatum(Property, RhsPtr);
+	}
+};
+
+static void DiffValue(FDiffState& State, FProperty* Property, void* LhsPtr, void* RhsPtr);
+
+static void DiffStruct(FDiffState& State, UStruct* Struct, void* LhsContainer, void* RhsContainer)
+{
+	for (FProperty* Property = DcPropertyUtils::FirstEffectiveProperty(Struct->PropertyLink);
+		Property;
+		Property = DcPropertyUtils::NextEffectiveProperty(Property))
+	{
+		State.PushName(Property->GetFName());
+		if (Property->ArrayDim == 1)
+		{
+			DiffValue(State,
+				Property,
+				Property->ContainerPtrToValuePtr<void>(LhsContainer),
+				Property->ContainerPtrToValuePtr<void>(RhsContainer)
+			);
+		}
+		else
+		{
+			//	scalar arrays are replaced as a whole as they're only addressable as a whole by serializers
+			for (int Ix = 0; Ix < Property->ArrayDim; Ix++)
+			{
+				if (!Property->Identical(
+					Property->ContainerPtrToValuePtr<void>(LhsContainer, Ix),
+					Property->ContainerPtrToValuePtr<void>(RhsContainer, Ix)))
+				{
+					State.Emit(Property, Property->ContainerPtrToValuePtr<void>(RhsContainer));
+					break;
+				}
+			}
+		}
+		State.Pop();
+	}
+}
+
+static bool IsPathSafeKey(const FString& Key)
+{
+	int32 Ix;
+	return !Key.IsEmpty() && !Key.FindChar(TCHAR('.'), Ix);
+}
+
+static void DiffMap(FDiffState& State, FMapProperty* MapProperty, void* LhsPtr, void* RhsPtr)
+{
+	FScriptMapHelper LhsHelper(MapProperty, LhsPtr);
+	FScriptMapHelper RhsHelper(MapProperty, RhsPtr);
+
+	FProperty* KeyProperty = MapProperty->KeyProp;
+	FProperty* ValueProperty = MapProperty->ValueProp;
+	bool bKeyIsName = KeyProperty->IsA<FNameProperty>();
+	bool bKeyIsStr = KeyProperty->IsA<FStrProperty>();
+
+	if ((!bKeyIsName && !bKeyIsStr)
+		|| LhsHelper.Num() != RhsHelper.Num())
+	{
+		if (!MapProperty->Identical(LhsPtr, RhsPtr))
+			State.Emit(MapProperty, RhsPtr);
+		return;
+	}
+
+	int32 EntriesBefore = State.Patch->Entries.Num();
+	bool bReplaceWhole = false;
+
+	int32 Remaining = RhsHelper.Num();
+	for (int32 Ix = 0; Remaining > 0; Ix++)
+	{
+		if (!RhsHelper.IsValidIndex(Ix))
+			continue;
+		--Remaining;
+
+		void* RhsKeyPtr = RhsHelper.GetKeyPtr(Ix);
+		void* LhsValuePtr = LhsHelper.FindValueFromHash(RhsKeyPtr);
+		if (LhsValuePtr == nullptr)
+		{
+			//	key sets differs, there's no way to express removals in paths
+			bReplaceWhole = true;
+			break;
+		}
+
+		int32 EntriesBeforeValue = State.Patch->Entries.Num();
+
+		if (bKeyIsName)
+			State.PushName(*(FName*)RhsKeyPtr);
+		else
+			State.PushStr((FString*)RhsKeyPtr);
+
+		DiffValue(State, ValueProperty, LhsValuePtr, RhsHelper.GetValuePtr(Ix));
+		State.Pop();
+
+		if (State.Patch->Entries.Num() != EntriesBeforeValue)
+		{
+			//	only check keys on changes, as this needs formatting names
+			FString KeyStr = bKeyIsName ? ((FName*)RhsKeyPtr)->ToString() : *(FString*)RhsKeyPtr;
+			if (!IsPathSafeKey(KeyStr))
+			{
+				bReplaceWhole = true;
+				break;
+			}
+		}
+	}
+
+	if (bReplaceWhole)
+	{
+		State.Patch->Entries.SetNum(EntriesBefore);
+		State.Emit(MapProperty, RhsPtr);
+	}
+}
+
+static void DiffValue(FDiffState& State, FProperty* Property, void* LhsPtr, void* RhsPtr)
+{
+	if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		DiffStruct(State, StructProperty->Struct, LhsPtr, RhsPtr);
+	}
+	else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper LhsHelper(ArrayProperty, LhsPtr);
+		FScriptArrayHelper RhsHelper(ArrayProperty, RhsPtr);
+		if (LhsHelper.Num() != RhsHelper.Num())
+		{
+			State.Emit(ArrayProperty, RhsPtr);
+			return;
+		}
+
+		for (int Ix = 0; Ix < RhsHelper.Num(); Ix++)
+		{
+			State.PushIndex(Ix);
+			DiffValue(State, ArrayProperty->Inner, LhsHelper.GetRawPtr(Ix), RhsHelper.GetRawPtr(Ix));
+			State.Pop();
+		}
+	}
+	else if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		DiffMap(State, MapProperty, LhsPtr, RhsPtr);
+	}
+	else
+	{
+		//	scalars, sets, optionals and object references
+		if (!Property->Identical(LhsPtr, RhsPtr))
+			State.Emit(Property, RhsPtr);
+	}
+}
+
+static FDcResult ResolvePatchPath(const FDcPropertyDatum& Target, const FString& Path, FDcPropertyDatum& OutDatum)
+{
+	//	empty path refers to the root itself when diffing non struct/class roots
+	if (Path.IsEmpty())
+	{
+		OutDatum = Target;
+		return DcOk();
+	}
+
+	return ResolveDatumPropertyByPath(Target, Path, OutDatum);
+}
+
+static FString FormatDatumTypeName(const FDcPropertyDatum& Datum)
+{
+	return Datum.IsNone()
+		? FString(TEXT("<none>"))
+		: DcPropertyUtils::GetFormatPropertyTypeName(Datum.Property);
+}
+
+} // namespace PropertyDiffDetails
+
+FDcResult DiffDatum(const FDcPropertyDatum& Lhs, const FDcPropertyDatum& Rhs, FDcPropertyPatch& OutPatch)
+{
+	using namespace PropertyDiffDetails;
+	OutPatch.Reset();
+
+	FDiffState State;
+	State.Patch = &OutPatch;
+
+	if (Lhs.Property.IsUObject() && Lhs.Property == Rhs.Property)
+	{
+		//	class roots are datums of the object itself, which is also the container
+		DiffStruct(State, CastChecked<UStruct>(Lhs.Property.ToUObject()), Lhs.DataPtr, Rhs.DataPtr);
+	}
+	else if (!Lhs.Property.IsUObject()
+		&& !Rhs.Property.IsUObject()
+		&& !Lhs.IsNone()
+		&& !Rhs.IsNone()
+		&& Lhs.CastFieldChecked<FProperty>()->SameType(Rhs.CastFieldChecked<FProperty>()))
+	{
+		DiffValue(State, Rhs.CastFieldChecked<FProperty>(), Lhs.DataPtr, Rhs.DataPtr);
+	}
+	else
+	{
+		return DC_FAIL(DcDExtra, DiffTypeMismatch)
+			<< FormatDatumTypeName(Lhs) << FormatDatumTypeName(Rhs);
+	}
+
+	return DcOk();
+}
+
+FDcResult ApplyPatch(const FDcPropertyPatch& Patch, const FDcPropertyDatum& Target)
+{
+	using namespace PropertyDiffDetails;
+
+	for (const FDcPropertyPatchEntry& Entry : Patch.Entries)
+	{
+		FDcPropertyDatum TargetDatum;
+		DC_TRY(ResolvePatchPath(Target, Entry.Path, TargetDatum));
+
+		FProperty* Property = Entry.Datum.CastFieldChecked<FProperty>();
+		FProperty* TargetProperty = TargetDatum.CastField<FProperty>();
+		if (TargetProperty == nullptr
+			|| !TargetProperty->SameType(Property))
+		{
+			return DC_FAIL(DcDExtra, PatchTypeMismatch)
+				<< Entry.Path << FormatDatumTypeName(Entry.Datum) << FormatDatumTypeName(TargetDatum);
+		}
+
+		Property->CopyCompleteValue(TargetDatum.DataPtr, Entry.Datum.DataPtr);
+	}
+
+	return DcOk();
+}
+
+FDcResult SerializePatch(FDcSerializer* Serializer, FDcWriter* Writer, const FDcPropertyPatch& Patch)
+{
+	DC_TRY(Writer->WriteMapRoot());
+
+	for (const FDcPropertyPatchEntry& Entry : Patch.Entries)
+	{
+		DC_TRY(Writer->WriteString(Entry.Path));
+
+		FDcPropertyReader Reader(Entry.Datum);
+		FDcSerializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = Writer;
+		Ctx.Serializer = Serializer;
+		Ctx.Properties.Add(Entry.Datum.Property);
+		DC_TRY(Ctx.Prepare());
+		DC_TRY(Serializer->Serialize(Ctx));
+	}
+
+	DC_TRY(Writer->WriteMapEnd());
+	return DcOk();
+}
+
+FDcResult DeserializePatch(FDcDeserializer* Deserializer, FDcReader* Reader, const FDcPropertyDatum& Target)
+{
+	using namespace PropertyDiffDetails;
+
+	DC_TRY(Reader->ReadMapRoot());
+
+	while (true)
+	{
+		EDcDataEntry Next;
+		DC_TRY(Reader->PeekRead(&Next));
+		if (Next == EDcDataEntry::MapEnd)
+			break;
+
+		FString Path;
+		DC_TRY(Reader->ReadString(&Path));
+
+		FDcPropertyDatum TargetDatum;
+		DC_TRY(ResolvePatchPath(Target, Path, TargetDatum));
+
+		//	property writer appends into containers, clear them first as patches replaces them as a whole
+		if (TargetDatum.IsA<FArrayProperty>()
+			|| TargetDatum.IsA<FSetProperty>()
+			|| TargetDatum.IsA<FMapProperty>())
+		{
+			TargetDatum.CastFieldChecked<FProperty>()->ClearValue(TargetDatum.DataPtr);
+		}
+
+		FDcPropertyWriter Writer(TargetDatum);
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = Deserializer;
+		Ctx.Properties.Add(TargetDatum.Property);
+		DC_TRY(Ctx.Prepare());
+		DC_TRY(Deserializer->Deserialize(Ctx));
+	}
+
+	DC_TRY(Reader->ReadMapEnd());
+	return DcOk();
+}
+
+} // namespace DcExtra
+
+
+DC_TEST("DataConfig.Extra.PropertyDiff.DiffAndApply")
+{
+	using namespace DcExtra;
+
+	FDcExtraTestStructNestOuter Lhs;
+	Lhs.Middle.InnerMost.StrField = TEXT("Foo");
+	Lhs.Arr.Emplace(FDcExtraTestStructNestInnerMost{TEXT("Bar0")});
+	Lhs.Arr.Emplace(FDcExtraTestStructNestInnerMost{TEXT("Bar1")});
+	Lhs.NameMap.Emplace(TEXT("FooKey"), FDcExtraTestStructNestInnerMost{TEXT("FooValue")});
+	Lhs.NameMap.Emplace(TEXT("BarKey"), FDcExtraTestStructNestInnerMost{TEXT("BarValue")});
+
+	FDcExtraTestStructNestOuter Rhs = Lhs;
+
+	FDcPropertyPatch Patch;
+	UTEST_OK("Extra PropertyDiff", DiffDatum(FDcPropertyDatum(&Lhs), FDcPropertyDatum(&Rhs), Patch));
+	UTEST_TRUE("Extra PropertyDiff", Patch.IsEmpty());
+
+	Rhs.Middle.InnerMost.StrField = TEXT("AltFoo");
+	Rhs.Arr[1].StrField = TEXT("AltBar1");
+	Rhs.NameMap[TEXT("BarKey")].StrField = TEXT("AltBarValue");
+
+	UTEST_OK("Extra PropertyDiff", DiffDatum(FDcPropertyDatum(&Lhs), FDcPropertyDatum(&Rhs), Patch));
+	UTEST_EQUAL("Extra PropertyDiff", Patch.Entries.Num(), 3);
+	UTEST_EQUAL("Extra PropertyDiff", Patch.Entries[0].Path, TEXT("Middle.InnerMost.StrField"));
+	UTEST_EQUAL("Extra PropertyDiff", Patch.Entries[1].Path, TEXT("Arr.1.StrField"));
+	UTEST_EQUAL("Extra PropertyDiff", Patch.Entries[2].Path, TEXT("NameMap.BarKey.StrField"));
+
+	UTEST_OK("Extra PropertyDiff", ApplyPatch(Patch, FDcPropertyDatum(&Lhs)));
+	UTEST_OK("Extra PropertyDiff", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Lhs), FDcPropertyDatum(&Rhs)));
+
+	//	length mismatch replaces array as a whole
+	Rhs.Arr.Emplace(FDcExtraTestStructNestInnerMost{TEXT("Bar2")});
+	UTEST_OK("Extra PropertyDiff", DiffDatum(FDcPropertyDatum(&Lhs), FDcPropertyDatum(&Rhs), Patch));
+	UTEST_EQUAL("Extra PropertyDiff", Patch.Entries.Num(), 1);
+	UTEST_EQUAL("Extra PropertyDiff", Patch.Entries[0].Path, TEXT("Arr"));
+
+	UTEST_OK("Extra PropertyDiff", ApplyPatch(Patch, FDcPropertyDatum(&Lhs)));
+	UTEST_OK("Extra PropertyDiff", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Lhs), FDcPropertyDatum(&Rhs)));
+
+	return true;
+}
+
+DC_TEST("DataConfig.Extra.PropertyDiff.SerDe")
+{
+	using namespace DcExtra;
+
+	FDcExtraTestStructNestOuter Lhs;
+	Lhs.Middle.InnerMost.StrField = TEXT("Foo");
+	Lhs.Arr.Emplace(FDcExtraTestStructNestInnerMost{TEXT("Bar0")});
+	Lhs.NameMap.Emplace(TEXT("FooKey"), FDcExtraTestStructNestInnerMost{TEXT("FooValue")});
+
+	FDcExtraTestStructNestOuter Rhs = Lhs;
+	Rhs.Middle.InnerMost.StrField = TEXT("AltFoo");
+	Rhs.Arr.Emplace(FDcExtraTestStructNestInnerMost{TEXT("Bar1")});
+	Rhs.NameMap[TEXT("FooKey")].StrField = TEXT("AltFooValue");
+
+	FDcPropertyPatch Patch;
+	UTEST_OK("Extra PropertyDiff SerDe", DiffDatum(FDcPropertyDatum(&Lhs), FDcPropertyDatum(&Rhs), Patch));
+
+	FDcSerializer Serializer;
+	DcSetupJsonSerializeHandlers(Serializer);
+	FDcDeserializer Deserializer;
+	DcSetupJsonDeserializeHandlers(Deserializer);
+
+	{
+		FDcJsonWriter Writer;
+		UTEST_OK("Extra PropertyDiff SerDe", SerializePatch(&Serializer, &Writer, Patch));
+
+		FDcExtraTestStructNestOuter Dest = Lhs;
+		FString Str = Writer.Sb.ToString();
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Extra PropertyDiff SerDe", DeserializePatch(&Deserializer, &Reader, FDcPropertyDatum(&Dest)));
+		UTEST_OK("Extra PropertyDiff SerDe", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Dest), FDcPropertyDatum(&Rhs)));
+	}
+
+	{
+		FDcSerializer MsgPackSerializer;
+		DcSetupMsgPackSerializeHandlers(MsgPackSerializer);
+		FDcDeserializer MsgPackDeserializer;
+		DcSetupMsgPackDeserializeHandlers(MsgPackDeserializer);
+
+		FDcMsgPackWriter Writer;
+		UTEST_OK("Extra PropertyDiff SerDe", SerializePatch(&MsgPackSerializer, &Writer, Patch));
+
+		FDcExtraTestStructNestOuter Dest = Lhs;
+		auto& Buffer = Writer.GetMainBuffer();
+		FDcMsgPackReader Reader(FDcBlobViewData::From(Buffer));
+		UTEST_OK("Extra PropertyDiff SerDe", DeserializePatch(&MsgPackDeserializer, &Reader, FDcPropertyDatum(&Dest)));
+		UTEST_OK("Extra PropertyDiff SerDe", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Dest), FDcPropertyDatum(&Rhs)));
+	}
+
+	return true;
+}
+
@@ -7,6 +7,9 @@
 
 #include "Misc/CString.h"
 #include "Containers/StringView.h"
+#include "Async/Async.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeRWLock.h"
 #include "PropertyPathHelpers.h"
 
 namespace DcExtra {
@@ -156,11 +159,18 @@ FDcResult TraverseReaderByPath(FDcPropertyReader* Reader, const FString& Path)
 					if (FieldName == CurName)
 						break;	// found
 				}
+				else if (MapNext == EDcDataEntry::MapEnd)
+				{
+					return DC_FAIL(DcDExtra, PathMapKeyNotFound) << Cur;
+				}
 				else
 				{
 					return DC_FAIL(DcDReadWrite, DataTypeMismatch2)
 						<< EDcDataEntry::Name << EDcDataEntry::String << MapNext << Reader->FormatHighlight();
 				}
+
+				//	skip value of unmatched key
+				DC_TRY(Reader->SkipRead());
 			}
 		}
 
@@ -194,6 +204,412 @@ FDcResult GetDatumPropertyByPath(const FDcPropertyDatum& Datum, const FString& P
 	return DcOk();
 }
 
+static FDcResult _ParsePathIndex(const FString& Segment, int32& OutIndex)
+{
+	if (Segment.IsEmpty() || !Segment.IsNumeric())
+		return DC_FAIL(DcDExtra, PathInvalidSegment) << Segment;
+
+	OutIndex = FCString::Atoi(*Segment);
+	if (OutIndex < 0)
+		return DC_FAIL(DcDExtra, PathInvalidSegment) << Segment;
+
+	return DcOk();
+}
+
+static bool _ShouldProcessPathProperty(FProperty* Property)
+{
+#if WITH_EDITORONLY_DATA
+	//	consistent with `FDcPropertyConfig::MakeDefault()` used by `GetDatumPropertyByPath`
+	return !Property->HasMetaData(DcPropertyUtils::DC_META_SKIP);
+#else
+	return true;
+#endif // WITH_EDITORONLY_DATA
+}
+
+} // namespace DcExtra
+
+FDcResult FDcCompiledPropertyPath::Compile(UStruct* InRoot, FStringView Path)
+{
+	using namespace DcExtra;
+	check(InRoot);
+	Root = InRoot;
+	Steps.Reset();
+
+	//	`nullptr` for at root
+	FProperty* CurProperty = nullptr;
+	bool bAtScalarArrayItem = false;
+
+	FStringView Remaining = Path;
+	while (true)
+	{
+		FStringView CurView;
+		FStringView Tail;
+		_SplitPath(Remaining, CurView, Tail);
+		FString Cur(CurView);
+
+		if (Cur.IsEmpty())
+			return DC_FAIL(DcDExtra, PathInvalidSegment) << Cur;
+
+		FStep Step;
+		Step.Index = INDEX_NONE;
+
+		if (CurProperty && CurProperty->ArrayDim > 1 && !bAtScalarArrayItem)
+		{
+			DC_TRY(_ParsePathIndex(Cur, Step.Index));
+			if (Step.Index >= CurProperty->ArrayDim)
+				return DC_FAIL(DcDExtra, PathIndexOutOfBound) << Step.Index << CurProperty->ArrayDim;
+
+			Step.Type = EStepType::ScalarArrayItem;
+			Step.Property = CurProperty;
+			bAtScalarArrayItem = true;
+		}
+		else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(CurProperty))
+		{
+			DC_TRY(_ParsePathIndex(Cur, Step.Index));
+			Step.Type = EStepType::ArrayItem;
+			Step.Property = ArrayProperty;
+			CurProperty = ArrayProperty->Inner;
+			bAtScalarArrayItem = false;
+		}
+		else if (FSetProperty* SetProperty = CastField<FSetProperty>(CurProperty))
+		{
+			DC_TRY(_ParsePathIndex(Cur, Step.Index));
+			Step.Type = EStepType::SetItem;
+			Step.Property = SetProperty;
+			CurProperty = SetProperty->ElementProp;
+			bAtScalarArrayItem = false;
+		}
+		else if (FMapProperty* MapProperty = CastField<FMapProperty>(CurProperty))
+		{
+			if (MapProperty->KeyProp->IsA<FNameProperty>())
+				Step.KeyName = FName(Cur);
+			else if (MapProperty->KeyProp->IsA<FStrProperty>())
+				Step.KeyStr = Cur;
+			else
+				return DC_FAIL(DcDReadWrite, DataTypeMismatch2)
+					<< EDcDataEntry::Name << EDcDataEntry::String
+					<< DcPropertyUtils::PropertyToDataEntry(MapProperty->KeyProp);
+
+			Step.Type = EStepType::MapValue;
+			Step.Property = MapProperty;
+			CurProperty = MapProperty->ValueProp;
+			bAtScalarArrayItem = false;
+		}
+		else
+		{
+			UStruct* Struct = CurProperty == nullptr
+				? InRoot
+				: DcPropertyUtils::TryGetStruct(CurProperty);
+			if (Struct == nullptr)
+				return DC_FAIL(DcDExtra, PathInvalidSegment) << Cur;
+
+			FProperty* Property = DcPropertyUtils::FindEffectivePropertyByName(Struct, FName(Cur));
+			if (Property == nullptr || !_ShouldProcessPathProperty(Property))
+				return DC_FAIL(DcDReadWrite, CantFindPropertyByName) << Cur;
+
+			Step.Type = EStepType::Field;
+			Step.Property = Property;
+			CurProperty = Property;
+			bAtScalarArrayItem = false;
+		}
+
+		Steps.Emplace(MoveTemp(Step));
+
+		if (Tail.IsEmpty())
+			break;
+		else
+			Remaining = Tail;
+	}
+
+	return DcOk();
+}
+
+FDcResult FDcCompiledPropertyPath::Resolve(const FDcPropertyDatum& RootDatum, FDcPropertyDatum& OutDatum) const
+{
+	check(Root);
+	UStruct* RootStruct = DcPropertyUtils::TryGetStruct(RootDatum);
+	if (RootStruct == nullptr
+		|| !RootStruct->IsChildOf(Root)
+		|| RootDatum.IsA<FObjectProperty>())
+	{
+		return DC_FAIL(DcDExtra, PathRootMismatch)
+			<< Root->GetFName() << (RootStruct ? RootStruct->GetFName() : FName());
+	}
+
+	FProperty* CurProperty = nullptr;
+	void* CurPtr = RootDatum.DataPtr;
+
+	for (const FStep& Step : Steps)
+	{
+		switch (Step.Type)
+		{
+			case EStepType::Field:
+			{
+				void* Container = CurPtr;
+				if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(CurProperty))
+				{
+					Container = ObjectProperty->GetObjectPropertyValue(CurPtr);
+					if (Container == nullptr)
+						return DC_FAIL(DcDExtra, PathNullObject) << ObjectProperty->GetFName();
+				}
+
+				CurPtr = Step.Property->ContainerPtrToValuePtr<void>(Container);
+				CurProperty = Step.Property;
+				break;
+			}
+			case EStepType::ScalarArrayItem:
+			{
+				CurPtr = (uint8*)CurPtr + (PTRINT)(Step.Property->ElementSize * Step.Index);
+				break;
+			}
+			case EStepType::ArrayItem:
+			{
+				FArrayProperty* ArrayProperty = (FArrayProperty*)Step.Property;
+				FScriptArrayHelper ArrayHelper(ArrayProperty, CurPtr);
+				if (!ArrayHelper.IsValidIndex(Step.Index))
+					return DC_FAIL(DcDExtra, PathIndexOutOfBound) << Step.Index << ArrayHelper.Num();
+
+				CurPtr = ArrayHelper.GetRawPtr(Step.Index);
+				CurProperty = ArrayProperty->Inner;
+				break;
+			}
+			case EStepType::SetItem:
+			{
+				FSetProperty* SetProperty = (FSetProperty*)Step.Property;
+				FScriptSetHelper SetHelper(SetProperty, CurPtr);
+				if (Step.Index >= SetHelper.Num())
+					return DC_FAIL(DcDExtra, PathIndexOutOfBound) << Step.Index << SetHelper.Num();
+
+				int32 Remaining = Step.Index;
+				int32 SparseIndex = 0;
+				while (true)
+				{
+					if (SetHelper.IsValidIndex(SparseIndex))
+					{
+						if (Remaining == 0)
+							break;
+						--Remaining;
+					}
+					++SparseIndex;
+				}
+
+				CurPtr = SetHelper.GetElementPtr(SparseIndex);
+				CurProperty = SetProperty->ElementProp;
+				break;
+			}
+			case EStepType::MapValue:
+			{
+				FMapProperty* MapProperty = (FMapProperty*)Step.Property;
+				FScriptMapHelper MapHelper(MapProperty, CurPtr);
+				const void* KeyPtr = MapProperty->KeyProp->IsA<FNameProperty>()
+					? (const void*)&Step.KeyName
+					: (const void*)&Step.KeyStr;
+
+				CurPtr = MapHelper.FindValueFromHash(KeyPtr);
+				if (CurPtr == nullptr)
+					return DC_FAIL(DcDExtra, PathMapKeyNotFound)
+						<< (Step.KeyName.IsNone() ? Step.KeyStr : Step.KeyName.ToString());
+
+				CurProperty = MapProperty->ValueProp;
+				break;
+			}
+			default:
+				return DcNoEntry();
+		}
+	}
+
+	check(CurProperty);
+	OutDatum.Property = CurProperty;
+	OutDatum.DataPtr = CurPtr;
+	return DcOk();
+}
+
+struct FDcPropertyPathCache::FImpl
+{
+	struct FKey
+	{
+		UStruct* Root;
+		FString Path;
+		uint32 Hash;
+	};
+
+	//	lookups compare against the caller's view, `FKey` is only built on insert
+	struct FKeyView
+	{
+		UStruct* Root;
+		FStringView Path;
+		uint32 Hash;
+	};
+
+	struct FValue
+	{
+		//	detect root struct GCed and address reused
+		TWeakObjectPtr<UStruct> RootWeak;
+		FDcCompiledPropertyPathRef Path;
+		//	stamped on hits under the read lock, least recently stamped is evicted on insert
+		mutable TAtomic<uint64> LastUsed;
+
+		FValue(UStruct* InRoot, FDcCompiledPropertyPathRef InPath, uint64 InLastUsed)
+			: RootWeak(InRoot)
+			, Path(MoveTemp(InPath))
+			, LastUsed(InLastUsed)
+		{}
+
+		FValue(const FValue& Other)
+			: RootWeak(Other.RootWeak)
+			, Path(Other.Path)
+			, LastUsed(Other.LastUsed.Load(EMemoryOrder::Relaxed))
+		{}
+	};
+
+	struct FKeyFuncs : BaseKeyFuncs<TPair<FKey, FValue>, FKey, false>
+	{
+		static FORCEINLINE const FKey& GetSetKey(const TPair<FKey, FValue>& Element) { return Element.Key; }
+		static FORCEINLINE uint32 GetKeyHash(const FKey& Key) { return Key.Hash; }
+		static FORCEINLINE bool Matches(const FKey& A, const FKey& B) { return Matches(A, FKeyView{B.Root, B.Path, B.Hash}); }
+		static FORCEINLINE bool Matches(const FKey& A, const FKeyView& B)
+		{
+			return A.Root == B.Root
+				&& A.Path.Len() == B.Path.Len()
+				&& FCString::Strncmp(*A.Path, B.Path.GetData(), B.Path.Len()) == 0;
+		}
+	};
+
+	struct FShard
+	{
+		FRWLock Lock;
+		TAtomic<uint64> Clock{0};
+		TMap<FKey, FValue, FDefaultSetAllocator, FKeyFuncs> Map;
+	};
+
+	static constexpr int32 MAX_SHARDS = 8;
+
+	FImpl(int32 InCapacity)
+	{
+		//	shard large caches to keep readers of unrelated paths off the same lock
+		NumShards = FMath::Clamp(InCapacity / 8, 1, (int32)MAX_SHARDS);
+		ShardCapacity = FMath::Max(1, FMath::DivideAndRoundUp(InCapacity, NumShards));
+	}
+
+	static FORCEINLINE FKeyView MakeKeyView(UStruct* Root, FStringView Path)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Root), FCrc::MemCrc32(Path.GetData(), Path.Len() * sizeof(TCHAR)));
+		return FKeyView{Root, Path, Hash};
+	}
+
+	FORCEINLINE FShard& GetShard(const FKeyView& Key) { return Shards[Key.Hash % NumShards]; }
+
+	//	call with shard read lock held
+	static FORCEINLINE const FValue* FindValid(FShard& Shard, const FKeyView& Key)
+	{
+		const FValue* Found = Shard.Map.FindByHash(Key.Hash, Key);
+		if (Found && Found->RootWeak.Get() == Key.Root)
+		{
+			Found->LastUsed.Store(++Shard.Clock, EMemoryOrder::Relaxed);
+			return Found;
+		}
+		return nullptr;
+	}
+
+	FDcResult CompileAndAdd(const FKeyView& Key, FDcCompiledPropertyPathPtr& OutPath)
+	{
+		//	compile outside of the lock, racing threads compile the same path and last one wins
+		TSharedRef<FDcCompiledPropertyPath, ESPMode::ThreadSafe> Compiled = MakeShared<FDcCompiledPropertyPath, ESPMode::ThreadSafe>();
+		DC_TRY(Compiled->Compile(Key.Root, Key.Path));
+
+		FShard& Shard = GetShard(Key);
+		FWriteScopeLock WriteLock(Shard.Lock);
+		Shard.Map.RemoveByHash(Key.Hash, Key);
+		if (Shard.Map.Num() >= ShardCapacity)
+		{
+			const TPair<FKey, FValue>* Evict = nullptr;
+			for (const TPair<FKey, FValue>& Pair : Shard.Map)
+			{
+				if (Evict == nullptr
+					|| Pair.Value.LastUsed.Load(EMemoryOrder::Relaxed) < Evict->Value.LastUsed.Load(EMemoryOrder::Relaxed))
+					Evict = &Pair;
+			}
+			FKey EvictKey = Evict->Key;
+			Shard.Map.Remove(EvictKey);
+		}
+
+		Shard.Map.Emplace(FKey{Key.Root, FString(Key.Path.Len(), Key.Path.GetData()), Key.Hash}, FValue(Key.Root, Compiled, ++Shard.Clock));
+		OutPath = Compiled;
+		return DcOk();
+	}
+
+	int32 NumShards;
+	int32 ShardCapacity;
+	FShard Shards[MAX_SHARDS];
+};
+
+FDcPropertyPathCache::FDcPropertyPathCache(int32 InCapacity)
+	: Impl(MakeUnique<FImpl>(InCapacity))
+{}
+
+FDcPropertyPathCache::~FDcPropertyPathCache() = default;
+
+FDcResult FDcPropertyPathCache::FindOrCompile(UStruct* Root, FStringView Path, FDcCompiledPropertyPathPtr& OutPath)
+{
+	check(Root);
+	FImpl::FKeyView Key = FImpl::MakeKeyView(Root, Path);
+	{
+		FImpl::FShard& Shard = Impl->GetShard(Key);
+		FReadScopeLock ReadLock(Shard.Lock);
+		if (const FImpl::FValue* Found = FImpl::FindValid(Shard, Key))
+		{
+			OutPath = Found->Path;
+			return DcOk();
+		}
+	}
+
+	return Impl->CompileAndAdd(Key, OutPath);
+}
+
+FDcResult FDcPropertyPathCache::Resolve(const FDcPropertyDatum& RootDatum, UStruct* Root, FStringView Path, FDcPropertyDatum& OutDatum)
+{
+	check(Root);
+	FImpl::FKeyView Key = FImpl::MakeKeyView(Root, Path);
+	{
+		//	resolve in place on hits, no key or shared ref copies
+		FImpl::FShard& Shard = Impl->GetShard(Key);
+		FReadScopeLock ReadLock(Shard.Lock);
+		if (const FImpl::FValue* Found = FImpl::FindValid(Shard, Key))
+			return Found->Path->Resolve(RootDatum, OutDatum);
+	}
+
+	FDcCompiledPropertyPathPtr Compiled;
+	DC_TRY(Impl->CompileAndAdd(Key, Compiled));
+	return Compiled->Resolve(RootDatum, OutDatum);
+}
+
+void FDcPropertyPathCache::Empty()
+{
+	for (int Ix = 0; Ix < Impl->NumShards; Ix++)
+	{
+		FImpl::FShard& Shard = Impl->Shards[Ix];
+		FWriteScopeLock WriteLock(Shard.Lock);
+		Shard.Map.Empty();
+	}
+}
+
+namespace DcExtra {
+
+FDcResult ResolveDatumPropertyByPath(const FDcPropertyDatum& RootDatum, const FString& Path, FDcPropertyDatum& OutDatum)
+{
+	static FDcPropertyPathCache _Cache;
+
+	UStruct* RootStruct = DcPropertyUtils::TryGetStruct(RootDatum);
+	if (RootStruct == nullptr
+		|| RootDatum.IsA<FObjectProperty>())
+	{
+		//	non class/struct roots falls back to reader traversal
+		return GetDatumPropertyByPath(RootDatum, Path, OutDatum);
+	}
+
+	return _Cache.Resolve(RootDatum, RootStruct, Path, OutDatum);
+}
+
 } // namespace DcExtra
 
 
@@ -231,6 +647,13 @@ DC_TEST("DataConfig.Extra.PathAccess.ReadWriteByPath")
 	UTEST_TRUE("Extra PathAccess ReadByPath", CheckStrPtr(GetDatumPropertyByPath<FString>(FDcPropertyDatum(Outer), "StructRoot.Arr.1.StrField"), TEXT("AltBar1")));
 	UTEST_TRUE("Extra PathAccess ReadByPath", CheckStrPtr(GetDatumPropertyByPath<FString>(FDcPropertyDatum(Outer), "StructRoot.NameMap.FooKey.StrField"), TEXT("AltFooValue")));
 
+	//	reader traversal skips values of unmatched map keys
+	Outer->StructRoot.NameMap.Emplace(TEXT("BarKey"), FDcExtraTestStructNestInnerMost{TEXT("BarValue")});
+	FDcPropertyDatum MapValueDatum;
+	UTEST_OK("Extra PathAccess ReadByPath", GetDatumPropertyByPath(FDcPropertyDatum(Outer), TEXT("StructRoot.NameMap.BarKey.StrField"), MapValueDatum));
+	UTEST_TRUE("Extra PathAccess ReadByPath", MapValueDatum.DataPtr == &Outer->StructRoot.NameMap[TEXT("BarKey")].StrField);
+	UTEST_DIAG("Extra PathAccess ReadByPath", GetDatumPropertyByPath(FDcPropertyDatum(Outer), TEXT("StructRoot.NameMap.BazKey"), MapValueDatum), DcDExtra, PathMapKeyNotFound);
+
 	UTEST_TRUE("Extra PathAccess ReadByPath", GetDatumPropertyByPath<FDcExtraTestStructNestMiddle>(FDcPropertyDatum(Outer), "StructRoot.Middle") == &Outer->StructRoot.Middle);
 	UTEST_TRUE("Extra PathAccess ReadByPath", GetDatumPropertyByPath<UDcExtraTestClassOuter>(FDcPropertyDatum(Outer), "StructRoot.Middle.InnerMost.ObjField") == Outer->StructRoot.Middle.InnerMost.ObjField);
 
@@ -257,3 +680,83 @@ DC_TEST("DataConfig.Extra.PathAccess.PropertyPathHelpers")
 
 	return true;
 }
+
+DC_TEST("DataConfig.Extra.PathAccess.CompiledPath")
+{
+	using namespace DcExtra;
+
+	UDcExtraTestClassOuter* Outer = NewObject<UDcExtraTestClassOuter>();
+	Outer->StructRoot.Middle.InnerMost.StrField = TEXT("Foo");
+	Outer->StructRoot.Arr.Emplace(FDcExtraTestStructNestInnerMost{TEXT("Bar0")});
+	Outer->StructRoot.Arr.Emplace(FDcExtraTestStructNestInnerMost{TEXT("Bar1")});
+	Outer->StructRoot.NameMap.Emplace(TEXT("FooKey"), FDcExtraTestStructNestInnerMost{TEXT("FooValue")});
+	Outer->StructRoot.Middle.InnerMost.ObjField = Outer;
+
+	FDcCompiledPropertyPath Path;
+	FDcPropertyDatum Datum;
+	FDcPropertyDatum ExpectDatum;
+	UTEST_OK("Extra PathAccess CompiledPath", Path.Compile(UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.Arr.1.StrField")));
+	UTEST_OK("Extra PathAccess CompiledPath", Path.Resolve(FDcPropertyDatum(Outer), Datum));
+	UTEST_OK("Extra PathAccess CompiledPath", GetDatumPropertyByPath(FDcPropertyDatum(Outer), TEXT("StructRoot.Arr.1.StrField"), ExpectDatum));
+	UTEST_TRUE("Extra PathAccess CompiledPath", Datum.Property == ExpectDatum.Property && Datum.DataPtr == ExpectDatum.DataPtr);
+	UTEST_TRUE("Extra PathAccess CompiledPath", Datum.DataPtr == &Outer->StructRoot.Arr[1].StrField);
+
+	//	expand object and loop back to itself
+	UTEST_OK("Extra PathAccess CompiledPath", Path.Compile(UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.Middle.InnerMost.ObjField.StructRoot.NameMap.FooKey.StrField")));
+	UTEST_OK("Extra PathAccess CompiledPath", Path.Resolve(FDcPropertyDatum(Outer), Datum));
+	UTEST_TRUE("Extra PathAccess CompiledPath", Datum.DataPtr == &Outer->StructRoot.NameMap[TEXT("FooKey")].StrField);
+
+	//	struct root
+	UTEST_OK("Extra PathAccess CompiledPath", Path.Compile(FDcExtraTestStructNestOuter::StaticStruct(), TEXT("Arr.0")));
+	UTEST_OK("Extra PathAccess CompiledPath", Path.Resolve(FDcPropertyDatum(&Outer->StructRoot), Datum));
+	UTEST_TRUE("Extra PathAccess CompiledPath", Datum.DataPtr == &Outer->StructRoot.Arr[0]);
+
+	UTEST_OK("Extra PathAccess CompiledPath", Path.Compile(FDcExtraTestStructNestOuter::StaticStruct(), TEXT("Arr.2")));
+	UTEST_DIAG("Extra PathAccess CompiledPath", Path.Resolve(FDcPropertyDatum(&Outer->StructRoot), Datum), DcDExtra, PathIndexOutOfBound);
+	UTEST_DIAG("Extra PathAccess CompiledPath", Path.Compile(FDcExtraTestStructNestOuter::StaticStruct(), TEXT("Middle.NotExist")), DcDReadWrite, CantFindPropertyByName);
+	UTEST_DIAG("Extra PathAccess CompiledPath", Path.Compile(FDcExtraTestStructNestOuter::StaticStruct(), TEXT("Arr.Foo")), DcDExtra, PathInvalidSegment);
+
+	FDcPropertyPathCache Cache(2);
+	FDcCompiledPropertyPathPtr Cached1;
+	FDcCompiledPropertyPathPtr Cached2;
+	UTEST_OK("Extra PathAccess CompiledPath", Cache.FindOrCompile(UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.Middle"), Cached1));
+	UTEST_OK("Extra PathAccess CompiledPath", Cache.FindOrCompile(UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.Middle"), Cached2));
+	UTEST_TRUE("Extra PathAccess CompiledPath", Cached1 == Cached2);
+	UTEST_OK("Extra PathAccess CompiledPath", Cached2->Resolve(FDcPropertyDatum(Outer), Datum));
+	UTEST_TRUE("Extra PathAccess CompiledPath", Datum.DataPtr == &Outer->StructRoot.Middle);
+
+	//	evicted paths held by callers stay valid
+	FDcCompiledPropertyPathPtr Evicted;
+	UTEST_OK("Extra PathAccess CompiledPath", Cache.FindOrCompile(UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.Arr.0"), Evicted));
+	UTEST_OK("Extra PathAccess CompiledPath", Cache.FindOrCompile(UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.Arr.1"), Cached2));
+	UTEST_OK("Extra PathAccess CompiledPath", Cache.FindOrCompile(UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.NameMap.FooKey"), Cached2));
+	UTEST_OK("Extra PathAccess CompiledPath", Evicted->Resolve(FDcPropertyDatum(Outer), Datum));
+	UTEST_TRUE("Extra PathAccess CompiledPath", Datum.DataPtr == &Outer->StructRoot.Arr[0]);
+
+	//	least recently used `StructRoot.Middle` got evicted and recompiled
+	UTEST_OK("Extra PathAccess CompiledPath", Cache.FindOrCompile(UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.Middle"), Cached2));
+	UTEST_TRUE("Extra PathAccess CompiledPath", Cached1 != Cached2);
+	UTEST_OK("Extra PathAccess CompiledPath", Cache.Resolve(FDcPropertyDatum(Outer), UDcExtraTestClassOuter::StaticClass(), TEXT("StructRoot.Middle"), Datum));
+	UTEST_TRUE("Extra PathAccess CompiledPath", Datum.DataPtr == &Outer->StructRoot.Middle);
+
+	//	global cache shared across threads
+	TArray<FFuture<bool>> Futures;
+	for (int Ix = 0; Ix < 4; Ix++)
+	{
+		Futures.Add(Async(EAsyncExecution::ThreadPool, [Outer, Ix]
+		{
+			for (int Jx = 0; Jx < 256; Jx++)
+			{
+				const TCHAR* PathStr = (Ix + Jx) % 2 ? TEXT("StructRoot.Arr.1.StrField") : TEXT("StructRoot.Middle.InnerMost.StrField");
+				FDcPropertyDatum ThreadDatum;
+				if (!ResolveDatumPropertyByPath(FDcPropertyDatum(Outer), PathStr, ThreadDatum).Ok())
+					return false;
+			}
+			return true;
+		}));
+	}
+	for (FFuture<bool>& Future : Futures)
+		UTEST_TRUE("Extra PathAccess CompiledPath", Future.Get());
+
+	return true;
+}
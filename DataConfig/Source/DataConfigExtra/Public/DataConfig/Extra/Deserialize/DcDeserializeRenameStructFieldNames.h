@@ -4,6 +4,7 @@
 
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Deserialize/DcDeserializeTypes.h"
+#include "DataConfig/SerDe/DcSerDeNameCache.h"
 #include "DcDeserializeRenameStructFieldNames.generated.h"
 
 
@@ -12,7 +13,10 @@ namespace DcExtra
 
 DECLARE_DELEGATE_RetVal_OneParam(FName, FDcExtraRenamer, const FName&);
 
+//	`Renamer` results are cached for this call only
 DATACONFIGEXTRA_API FDcResult DeserializeStructRenaming(FDcPropertyDatum From, FDcPropertyDatum To, FDcExtraRenamer Renamer);
+//	pass a caller owned cache to share renamed names across calls and threads
+DATACONFIGEXTRA_API FDcResult DeserializeStructRenaming(FDcPropertyDatum From, FDcPropertyDatum To, FDcNameToNameCache& RenameCache);
 
 } // namespace DcExtra
 
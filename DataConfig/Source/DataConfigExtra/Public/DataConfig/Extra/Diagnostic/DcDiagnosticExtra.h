@@ -19,17 +19,36 @@ enum Type : uint16
 	//	Sqlite
 	SqliteLastError,
 	SqliteBusy,
+	SqliteUnsupportedProperty,
+	SqliteInvalidBatchSize,
 
 	//	InlineStruct
 	InlineStructTooBig,
 	InlineStructNotSet,
 
+	//	LazyStruct
+	LazyStructNotSet,
+
 	//	Nested
 	NestedMissingMetaData,
 	NestedGrid2DHeightMismatch,
 	NestedGrid2DWidthMismatch,
 	NestedGrid2DLenMismatch,
 
+	//	PropertyDiff
+	DiffTypeMismatch,
+	PatchTypeMismatch,
+
+	//	PropertyPath
+	PathInvalidSegment,
+	PathIndexOutOfBound,
+	PathMapKeyNotFound,
+	PathNullObject,
+	PathRootMismatch,
+
+	//	Preload
+	PreloadPackageFailed,
+
 };
 
 extern DATACONFIGEXTRA_API FDcDiagnosticGroup Details;
@@ -2,26 +2,58 @@
 
 #include "CoreMinimal.h"
 
+struct FDcBenchReport;
+
 struct FDcBenchRunResult
 {
 	TArray<uint64> Ticks;
 	bool bAllOk;
 };
 
-DATACONFIGEXTRA_API FDcBenchRunResult DcBenchRun(int Iterations, TFunctionRef<void()> Body);
+DATACONFIGEXTRA_API FDcBenchRunResult DcBenchRun(int Iterations, TFunctionRef<bool()> Body);
 
 struct FDcBenchStat
 {
 	float MeanMs;
 	float MedianMs;
 	float Deviation;
+	float P90Ms;
+	float P99Ms;
+
+	//	counted on a separate untimed iteration through a `FMalloc` proxy, -1 when not counted
+	int64 AllocsPerIter;
 
 	bool bAllOk;
 };
 
 DATACONFIGEXTRA_API FDcBenchStat DcBenchStats(TFunctionRef<bool()> Body);
 
-DATACONFIGEXTRA_API FString DcFormatBenchStats(FString Prefix, double BytesCount, FDcBenchStat Stat);
+///	Allocation counting swaps `GMalloc` with a proxy, which is only safe when no other thread allocates
+///	meanwhile. It's off by default, turn it on only when benchmarks run alone e.g in `DataConfigHeadless`.
+DATACONFIGEXTRA_API void DcBenchSetCountAllocations(bool bEnabled);
+
+///	Format stats into a log line, also records it into `Report` when it's not null
+DATACONFIGEXTRA_API FString DcFormatBenchStats(FString Prefix, double BytesCount, FDcBenchStat Stat, FDcBenchReport* Report = nullptr);
+
+///	Run `Body` on 1..N threads at the same time, `Body` needs to be thread safe.
+///	Note that `DcEnv()` isn't thread safe so bodies should not fail.
+
+struct FDcBenchScalingStat
+{
+	int ThreadCount;
+	//	wall time for all threads finishing their iterations
+	float WallMs;
+	//	iterations finished across all threads during `WallMs`
+	int64 IterationCount;
+	//	latency stats across all iterations on all threads
+	FDcBenchStat Stat;
+};
+
+DATACONFIGEXTRA_API TArray<FDcBenchScalingStat> DcBenchScalingStats(int MaxThreadCount, TFunctionRef<bool()> Body);
+
+DATACONFIGEXTRA_API FString DcFormatBenchScalingStats(FString Prefix, double BytesCount, const TArray<FDcBenchScalingStat>& Stats, FDcBenchReport* Report = nullptr);
+
+DATACONFIGEXTRA_API int DcBenchDefaultMaxThreadCount();
 
 DATACONFIGEXTRA_API FString DcBuildConfigurationString();
 
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+
+#include "DcBenchReport.generated.h"
+
+struct FDcBenchStat;
+struct FDcBenchScalingStat;
+
+///	Machine readable benchmark results. Stats are recorded into a report passed to
+///	`DcFormatBenchStats/DcFormatBenchScalingStats`, which can be dumped as JSON or CSV and compared against a baseline.
+
+USTRUCT()
+struct FDcBenchRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FString Fixture;
+	UPROPERTY() FString BuildConfiguration;
+	//	1 for single thread runs, N for `DcBenchScalingStats` runs
+	UPROPERTY() int32 ThreadCount = 1;
+	UPROPERTY() double BytesCount = 0;
+	//	total bytes over wall time across all threads
+	UPROPERTY() float BandwidthMBs = 0;
+	UPROPERTY() float MeanMs = 0;
+	UPROPERTY() float MedianMs = 0;
+	UPROPERTY() float Deviation = 0;
+	UPROPERTY() float P90Ms = 0;
+	UPROPERTY() float P99Ms = 0;
+	UPROPERTY() int64 AllocsPerIter = 0;
+	UPROPERTY() bool bAllOk = false;
+};
+
+USTRUCT()
+struct FDcBenchReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<FDcBenchRecord> Records;
+};
+
+struct FDcBenchRegression
+{
+	FString Fixture;
+	int32 ThreadCount;
+	float BaselineMs;
+	float CurrentMs;
+};
+
+DATACONFIGEXTRA_API void DcBenchRecordStats(FDcBenchReport& Report, const FString& Fixture, double BytesCount, const FDcBenchStat& Stat);
+DATACONFIGEXTRA_API void DcBenchRecordScalingStats(FDcBenchReport& Report, const FString& Fixture, double BytesCount, const FDcBenchScalingStat& Scaling);
+
+///	Install `Report` as the one benchmark fixtures record into during this scope, e.g by a test runner.
+struct DATACONFIGEXTRA_API FDcScopedBenchReport : private FNoncopyable
+{
+	FDcScopedBenchReport(FDcBenchReport& InReport);
+	~FDcScopedBenchReport();
+
+	//	`nullptr` when there's no report installed
+	static FDcBenchReport* Get();
+
+	FDcBenchReport* Previous;
+};
+
+DATACONFIGEXTRA_API FDcResult DcBenchReportToJson(const FDcBenchReport& Report, FString& OutStr);
+DATACONFIGEXTRA_API FDcResult DcBenchReportFromJson(const FString& Str, FDcBenchReport& OutReport);
+DATACONFIGEXTRA_API FString DcBenchReportToCsv(const FDcBenchReport& Report);
+
+///	Match records by fixture, build configuration and thread count, and report ones whose median
+///	is slower than baseline by more than `Threshold`, e.g `0.1` for 10%. Failed runs always regress.
+DATACONFIGEXTRA_API void DcBenchCompareReports(const FDcBenchReport& Baseline, const FDcBenchReport& Current, float Threshold, TArray<FDcBenchRegression>& OutRegressions);
+
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+
+///	Two phase loading. First scan a document for object references, then async load all referenced
+///	packages in a single batch. Deserialize after they're loaded so references resolve from memory
+///	instead of triggering a sync load one at a time.
+
+struct FDcReader;
+
+struct DATACONFIGEXTRA_API FDcPreloadReferences
+{
+	//	object paths grouped by `$type`, plain reference strings are under `NAME_None`
+	TMap<FName, TSet<FString>> ObjectPathsByType;
+	TSet<FName> PackageNames;
+
+	void AddObjectPath(FName TypeName, const FString& ObjectPath);
+};
+
+///	Read through `Reader` and collect reference like strings, which are:
+///	- `Class'/Path/To/Package.Object'` and `'/Path/To/Package.Object'`
+///	- plain `/Path/To/Package.Object` strings, including ones in `$path`
+///	Native `/Script/` packages are skipped as they're always loaded.
+DATACONFIGEXTRA_API FDcResult DcScanObjectReferences(FDcReader* Reader, FDcPreloadReferences& OutReferences);
+
+///	Issue `LoadPackageAsync` for every package that isn't loaded yet. `OnCompleted` fires on game thread
+///	once all of them finished, with `false` if any failed.
+DATACONFIGEXTRA_API void DcPreloadPackagesAsync(const FDcPreloadReferences& References, TFunction<void(bool)> OnCompleted);
+
+///	Same as `DcPreloadPackagesAsync` but blocks until the whole batch is loaded.
+DATACONFIGEXTRA_API FDcResult DcPreloadPackages(const FDcPreloadReferences& References);
+
@@ -10,7 +10,8 @@ class FSQLiteDatabase;
 namespace DcExtra
 {
 
-///	Load array of struct from Sqlite query
+///	Load array of struct from Sqlite query. Structs with only numeric, string, name and text fields
+///	are written directly by column, others go through the deserializer.
 FDcResult LoadStructArrayFromSQLite(FSQLiteDatabase* Db, const TCHAR* Query, FDcPropertyDatum Datum);
 
 template<typename TStruct>
@@ -24,6 +25,35 @@ FDcResult LoadStructArrayFromSQLite(FSQLiteDatabase* Db, const TCHAR* Query, TAr
 	return LoadStructArrayFromSQLite(Db, Query, FDcPropertyDatum(ArrProp.Get(), &Arr));
 }
 
+struct FDcSqliteSaveOptions
+{
+	//	rows per transaction
+	int32 BatchSize = 10000;
+	bool bCreateTable = true;
+
+	//	bulk modes, trade durability for speed
+	//	`journal_mode=WAL` persists in the database file, `synchronous` is restored after the call
+	bool bJournalWAL = false;
+	bool bSynchronousOff = false;
+};
+
+///	Save array of struct into a Sqlite table, with a column per field named after it.
+///	Supports bool, numeric, string, name and text fields.
+///	Rows are written in savepoints so it works inside caller's open transaction, in which case
+///	nothing is committed until the caller commits. On failure only the current batch is rolled back.
+FDcResult SaveStructArrayToSQLite(FSQLiteDatabase* Db, const TCHAR* Table, FDcPropertyDatum Datum, const FDcSqliteSaveOptions& Options = FDcSqliteSaveOptions());
+
+template<typename TStruct>
+FDcResult SaveStructArrayToSQLite(FSQLiteDatabase* Db, const TCHAR* Table, const TArray<TStruct>& Arr, const FDcSqliteSaveOptions& Options = FDcSqliteSaveOptions())
+{
+	using namespace DcPropertyUtils;
+	auto ArrProp = FDcPropertyBuilder::Array(
+		FDcPropertyBuilder::Struct(TBaseStructure<TStruct>::Get())
+	).LinkOnScope();
+
+	return SaveStructArrayToSQLite(Db, Table, FDcPropertyDatum(ArrProp.Get(), (void*)&Arr), Options);
+}
+
 } // namespace DcExtra
 
 USTRUCT()
@@ -36,6 +66,15 @@ struct FDcExtraTestUser
 	UPROPERTY() FName Title;
 };
 
+USTRUCT()
+struct FDcExtraTestSqliteItem
+{
+	GENERATED_BODY()
 
-
+	UPROPERTY() int64 Id = 0;
+	UPROPERTY() double Weight = 0;
+	UPROPERTY() FName Name;
+	UPROPERTY() FText Note;
+	UPROPERTY() int32 Stock = 7;
+};
 
@@ -0,0 +1,39 @@
+#pragma once
+
+///	Arbitrary struct <-> `FDcLazyStruct`
+#include "DataConfig/Deserialize/DcDeserializeTypes.h"
+#include "DataConfig/Serialize/DcSerializeTypes.h"
+#include "DataConfig/Extra/Types/DcLazyStruct.h"
+#include "DcSerDeLazyStruct.generated.h"
+
+namespace DcExtra
+{
+
+///	Retains the source span when reading from JSON or MsgPack readers, otherwise deserializes eagerly
+DATACONFIGEXTRA_API FDcResult DcHandlerDeserializeLazyStruct(
+	FDcDeserializeContext& Ctx,
+	TFunctionRef<FDcResult(FDcDeserializeContext&, const FString&, UScriptStruct*&)> FuncLocateStruct
+);
+
+///	Unresolved lazy structs are piped from the source as is
+DATACONFIGEXTRA_API FDcResult DcHandlerSerializeLazyStruct(
+	FDcSerializeContext& Ctx,
+	TFunctionRef<FString(UScriptStruct* InStruct)> FuncWriteStructType
+);
+
+DATACONFIGEXTRA_API FDcResult HandlerDcLazyStructDeserialize(FDcDeserializeContext& Ctx);
+
+DATACONFIGEXTRA_API FDcResult HandlerDcLazyStructSerialize(FDcSerializeContext& Ctx);
+
+} // namespace DcExtra
+
+USTRUCT()
+struct FDcExtraTestWithLazyStruct1
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FDcLazyStruct LazyStructField1;
+	UPROPERTY() FDcLazyStruct LazyStructField2;
+	UPROPERTY() FDcLazyStruct LazyStructField3;
+};
+
@@ -39,6 +39,24 @@ struct DATACONFIGEXTRA_API FDcAnyStruct
 		UScriptStruct* StructClass;
 	};
 
+	///	Controller with the struct body placed right after it in the same allocation
+	struct DATACONFIGEXTRA_API AnyStructInlineReferenceController : public FReferenceControllerBase
+	{
+		static AnyStructInlineReferenceController* Create(UScriptStruct* InStructClass);
+
+		void DestroyObject() override;
+		void operator delete(void* Ptr);
+
+		AnyStructInlineReferenceController(const AnyStructInlineReferenceController&) = delete;
+		AnyStructInlineReferenceController& operator=(const AnyStructInlineReferenceController&) = delete;
+
+		void* DataPtr;
+		UScriptStruct* StructClass;
+
+	private:
+		AnyStructInlineReferenceController() = default;
+	};
+
 	FDcAnyStruct(SharedPointerInternals::FNullTag* = nullptr)
 		: DataPtr(nullptr)
 		, StructClass(nullptr)
@@ -117,6 +135,15 @@ struct DATACONFIGEXTRA_API FDcAnyStruct
 		, SharedReferenceCount(new AnyStructReferenceController(this))
 	{}
 
+	///	Default initialized `InStructClass` with a single allocation for both struct and reference count
+	static FDcAnyStruct Allocate(UScriptStruct* InStructClass);
+
+	template<class T>
+	static FDcAnyStruct Allocate()
+	{
+		return Allocate(TBaseStructure<T>::Get());
+	}
+
 	template<class T>
 	T* GetChecked() const
 	{
@@ -4,6 +4,7 @@
 #include "DataConfig/Json/DcJsonReader.h"
 #include "DataConfig/Json/DcJsonWriter.h"
 #include "DataConfig/Property/DcPropertyDatum.h"
+#include "DataConfig/SerDe/DcSerDeNameCache.h"
 
 #include "DcJsonConverter.generated.h"
 
@@ -49,6 +50,8 @@ static bool UStructToJsonObjectString(const InStructType& InStruct, FString& Out
 	return bRet;
 }
 
+///	`FJsonObjectConverter::StandardizeCase` memoized per field name, shared by camelCase handlers
+DATACONFIGEXTRA_API FDcNameToStringCache& GetCamelCaseNameCache();
 
 } // namespace DcExtra
 
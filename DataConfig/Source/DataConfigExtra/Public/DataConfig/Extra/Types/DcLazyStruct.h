@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+#include "DataConfig/Extra/Types/DcAnyStruct.h"
+#include "DcLazyStruct.generated.h"
+
+struct FDcDeserializer;
+struct FDcDeserializeContext;
+
+///	A struct of any type that's deserialized on first access.
+///	 - deserializing only retains a copy of the source span and the struct type
+///	 - `Resolve` runs the deserializer on the span then frees it
+///	 - resolved value is a `FDcAnyStruct` and shared across copies
+
+USTRUCT(BlueprintType)
+struct DATACONFIGEXTRA_API FDcLazyStruct
+{
+	GENERATED_BODY()
+
+	enum class ESourceType : uint8
+	{
+		None,
+		WideJson,
+		AnsiJson,
+		MsgPack,
+	};
+
+	UScriptStruct* StructClass = nullptr;
+
+	ESourceType SourceType = ESourceType::None;
+	TArray<uint8> Source;
+
+	//	for diagnostics to point back to the original document
+	int32 SourceLine = 1;
+	FString DiagFilePath;
+
+	FDcAnyStruct Resolved;
+
+	FORCEINLINE bool IsValid() const { return StructClass != nullptr; }
+	FORCEINLINE bool IsResolved() const { return Resolved.IsValid(); }
+	FORCEINLINE bool HasSource() const { return SourceType != ESourceType::None; }
+
+	void Reset();
+
+	///	Deserialize the retained source, does nothing when already resolved
+	FDcResult Resolve(FDcDeserializer* Deserializer, TFunctionRef<void(FDcDeserializeContext&)> SetupContext);
+	FDcResult Resolve(FDcDeserializer* Deserializer);
+
+	template<class T>
+	FDcResult Get(FDcDeserializer* Deserializer, T*& OutPtr)
+	{
+		check(TBaseStructure<T>::Get() == StructClass);
+		DC_TRY(Resolve(Deserializer));
+		OutPtr = Resolved.GetChecked<T>();
+		return DcOk();
+	}
+};
+
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+#include "DataConfig/Property/DcPropertyDatum.h"
+
+struct FDcReader;
+struct FDcWriter;
+struct FDcSerializer;
+struct FDcDeserializer;
+
+///	Structural diff and patch between two datums of the same type.
+///
+///	A patch is a flat list of `DcPropertyPathAccess` paths like `Foo.Arr.2.Bar` and the
+///	new values at these paths. It serializes as a single map `{ "Foo.Arr.2.Bar" : <value>, ... }`
+///	so it goes through JSON/MsgPack writers as is.
+///
+///	Arrays with mismatched length, sets and maps with non `FName/FString` keys or mismatched
+///	key sets are emitted as a whole. Object references are compared by pointer.
+
+struct DATACONFIGEXTRA_API FDcPropertyPatchEntry
+{
+	FString Path;
+	//	points into the `Rhs` datum passed to `DiffDatum`, no copy is made
+	FDcPropertyDatum Datum;
+};
+
+struct DATACONFIGEXTRA_API FDcPropertyPatch
+{
+	TArray<FDcPropertyPatchEntry> Entries;
+
+	FORCEINLINE bool IsEmpty() const { return Entries.Num() == 0; }
+	FORCEINLINE void Reset() { Entries.Reset(); }
+};
+
+namespace DcExtra
+{
+
+///	Diff `Lhs` to `Rhs` and write entries that turns `Lhs` into `Rhs`.
+///	`OutPatch` is reset but keeps its allocation, so it's cheap to reuse across calls.
+DATACONFIGEXTRA_API FDcResult DiffDatum(const FDcPropertyDatum& Lhs, const FDcPropertyDatum& Rhs, FDcPropertyPatch& OutPatch);
+
+///	Copy patch values in memory into `Target`
+DATACONFIGEXTRA_API FDcResult ApplyPatch(const FDcPropertyPatch& Patch, const FDcPropertyDatum& Target);
+
+///	Write patch as a map of path to value
+DATACONFIGEXTRA_API FDcResult SerializePatch(FDcSerializer* Serializer, FDcWriter* Writer, const FDcPropertyPatch& Patch);
+
+///	Read a patch map written by `SerializePatch` and write values directly into `Target`
+DATACONFIGEXTRA_API FDcResult DeserializePatch(FDcDeserializer* Deserializer, FDcReader* Reader, const FDcPropertyDatum& Target);
+
+} // namespace DcExtra
+
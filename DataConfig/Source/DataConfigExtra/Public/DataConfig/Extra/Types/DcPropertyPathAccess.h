@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/StringView.h"
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
@@ -21,12 +22,68 @@ namespace DcExtra {
 DATACONFIGEXTRA_API FDcResult TraverseReaderByPath(FDcPropertyReader* Reader, const FString& Path);
 DATACONFIGEXTRA_API FDcResult GetDatumPropertyByPath(const FDcPropertyDatum& RootDatum, const FString& Path, FDcPropertyDatum& OutDatum);
 
+} // namespace DcExtra
+
+///	Path resolved once against a root `UStruct` into property steps.
+///	Resolving it against a datum is then pointer arithmetic plus container lookups.
+struct DATACONFIGEXTRA_API FDcCompiledPropertyPath
+{
+	enum class EStepType : uint8
+	{
+		Field,				//	`Property` field on current struct/class/expanded object
+		ScalarArrayItem,	//	`Index` into `Property` with `ArrayDim > 1`
+		ArrayItem,			//	`Index` into `FArrayProperty`
+		SetItem,			//	`Index`th element of `FSetProperty`
+		MapValue,			//	value at `KeyName/KeyStr` of `FMapProperty`
+	};
+
+	struct FStep
+	{
+		EStepType Type;
+		FProperty* Property;
+		int32 Index;
+		FName KeyName;
+		FString KeyStr;
+	};
+
+	UStruct* Root = nullptr;
+	TArray<FStep, TInlineAllocator<8>> Steps;
+
+	FDcResult Compile(UStruct* InRoot, FStringView Path);
+	FDcResult Resolve(const FDcPropertyDatum& RootDatum, FDcPropertyDatum& OutDatum) const;
+};
+
+using FDcCompiledPropertyPathRef = TSharedRef<const FDcCompiledPropertyPath, ESPMode::ThreadSafe>;
+using FDcCompiledPropertyPathPtr = TSharedPtr<const FDcCompiledPropertyPath, ESPMode::ThreadSafe>;
+
+///	Small LRU cache of compiled paths keyed by root struct and path string. Thread safe.
+///	 - lookups hash the path view in place and only take a shard read lock, eviction order is approximate
+///	 - compiled paths are shared so they stay valid after being evicted, hold one for hot loops
+struct DATACONFIGEXTRA_API FDcPropertyPathCache
+{
+	FDcPropertyPathCache(int32 InCapacity = 64);
+	~FDcPropertyPathCache();
+
+	FDcResult FindOrCompile(UStruct* Root, FStringView Path, FDcCompiledPropertyPathPtr& OutPath);
+	//	resolve without handing out the compiled path, hits don't copy the shared ref
+	FDcResult Resolve(const FDcPropertyDatum& RootDatum, UStruct* Root, FStringView Path, FDcPropertyDatum& OutDatum);
+	void Empty();
+
+	struct FImpl;
+	TUniquePtr<FImpl> Impl;
+};
+
+namespace DcExtra {
+
+///	Same as `GetDatumPropertyByPath` but resolve with compiled paths cached in a global `FDcPropertyPathCache`.
+DATACONFIGEXTRA_API FDcResult ResolveDatumPropertyByPath(const FDcPropertyDatum& RootDatum, const FString& Path, FDcPropertyDatum& OutDatum);
+
 template<typename T>
 typename TEnableIf<DcTypeUtils::TIsUClass<T>::Value, T*>::Type
 GetDatumPropertyByPath(const FDcPropertyDatum& RootDatum, const FString& Path)
 {
 	FDcPropertyDatum ResultDatum;
-	FDcResult Ret = GetDatumPropertyByPath(RootDatum, Path, ResultDatum);
+	FDcResult Ret = ResolveDatumPropertyByPath(RootDatum, Path, ResultDatum);
 	if (!Ret.Ok())
 		return nullptr;
 
@@ -45,7 +102,7 @@ typename TEnableIf<DcTypeUtils::TIsUStruct<T>::Value, T*>::Type
 GetDatumPropertyByPath(const FDcPropertyDatum& RootDatum, const FString& Path)
 {
 	FDcPropertyDatum ResultDatum;
-	FDcResult Ret = GetDatumPropertyByPath(RootDatum, Path, ResultDatum);
+	FDcResult Ret = ResolveDatumPropertyByPath(RootDatum, Path, ResultDatum);
 	if (!Ret.Ok())
 		return nullptr;
 
@@ -66,7 +123,7 @@ GetDatumPropertyByPath(const FDcPropertyDatum& RootDatum, const FString& Path)
 	using TProperty = typename DcPropertyUtils::TPropertyTypeMap<T>::Type;
 
 	FDcPropertyDatum ResultDatum;
-	FDcResult Ret = GetDatumPropertyByPath(RootDatum, Path, ResultDatum);
+	FDcResult Ret = ResolveDatumPropertyByPath(RootDatum, Path, ResultDatum);
 	if (!Ret.Ok())
 		return nullptr;
 
@@ -83,7 +140,7 @@ bool SetDatumPropertyByPath(const FDcPropertyDatum& RootDatum, const FString& Pa
 	using TProperty = typename DcPropertyUtils::TPropertyTypeMap<T>::Type;
 
 	FDcPropertyDatum ResultDatum;
-	FDcResult Ret = GetDatumPropertyByPath(RootDatum, Path, ResultDatum);
+	FDcResult Ret = ResolveDatumPropertyByPath(RootDatum, Path, ResultDatum);
 	if (!Ret.Ok())
 		return false;
 
@@ -6,24 +6,117 @@
 #include "DataConfig/DcEnv.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Extra/Diagnostic/DcDiagnosticExtra.h"
+#include "DataConfig/Extra/Misc/DcBench.h"
+#include "DataConfig/Extra/Misc/DcBenchReport.h"
 
 #include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 ///
 /// Usage:
-///	DataConfigHeadless [TestFilter1] [TestFilter2] ...
+///	DataConfigHeadless [TestFilter1] [TestFilter2] ... [-BenchOut=<Path>] [-BenchBaseline=<Path>] [-BenchThreshold=<Ratio>]
+///
+///	-BenchOut: write benchmark results to `Path`, as CSV if it ends with `.csv` or JSON otherwise
+///	-BenchBaseline: compare benchmark results against a JSON file written by `-BenchOut`,
+///		exits non zero if any fixture median is slower by more than `-BenchThreshold`, default to 0.1
 ///
 
 IMPLEMENT_APPLICATION(DataConfigHeadless, "DataConfigHeadless");
 
 
-static int32 TestRunnerBody(TArray<FString>& Tokens)
+static int32 TestRunnerBody(TArray<FString>& Tokens, FDcBenchReport& Report)
 {
+	FDcScopedBenchReport ScopedReport(Report);
+
 	FDcAutomationConsoleRunner Runner;
 	Runner.Prepare(FDcAutomationConsoleRunner::FromCommandlineTokens(Tokens));
 	return Runner.RunTests();
 }
 
+static bool FindSwitchValue(const TArray<FString>& Switches, const TCHAR* Key, FString& OutValue)
+{
+	FString Prefix = FString(Key) + TEXT("=");
+	for (const FString& Switch : Switches)
+	{
+		if (Switch.StartsWith(Prefix))
+		{
+			OutValue = Switch.RightChop(Prefix.Len()).TrimQuotes();
+			return true;
+		}
+	}
+	return false;
+}
+
+static int32 BenchReportBody(const TArray<FString>& Switches, const FDcBenchReport& Report)
+{
+	FString OutPath;
+	if (FindSwitchValue(Switches, TEXT("BenchOut"), OutPath))
+	{
+		FString OutStr;
+		if (FPaths::GetExtension(OutPath) == TEXT("csv"))
+		{
+			OutStr = DcBenchReportToCsv(Report);
+		}
+		else if (!DcBenchReportToJson(Report, OutStr).Ok())
+		{
+			UE_LOG(LogDataConfigCore, Error, TEXT("failed to serialize benchmark report"));
+			return -1;
+		}
+
+		if (!FFileHelper::SaveStringToFile(OutStr, *OutPath))
+		{
+			UE_LOG(LogDataConfigCore, Error, TEXT("failed to write benchmark report: %s"), *OutPath);
+			return -1;
+		}
+
+		UE_LOG(LogDataConfigCore, Display, TEXT("benchmark report written: %s, %d records"), *OutPath, Report.Records.Num());
+	}
+
+	FString BaselinePath;
+	if (FindSwitchValue(Switches, TEXT("BenchBaseline"), BaselinePath))
+	{
+		float Threshold = 0.1f;
+		FString ThresholdStr;
+		if (FindSwitchValue(Switches, TEXT("BenchThreshold"), ThresholdStr))
+			LexFromString(Threshold, *ThresholdStr);
+
+		if (Report.Records.Num() == 0)
+		{
+			UE_LOG(LogDataConfigCore, Error, TEXT("no benchmark records to compare against baseline: %s"), *BaselinePath);
+			return -1;
+		}
+
+		FString BaselineStr;
+		FDcBenchReport Baseline;
+		if (!FFileHelper::LoadFileToString(BaselineStr, *BaselinePath)
+			|| !DcBenchReportFromJson(BaselineStr, Baseline).Ok())
+		{
+			UE_LOG(LogDataConfigCore, Error, TEXT("failed to load benchmark baseline: %s"), *BaselinePath);
+			return -1;
+		}
+
+		TArray<FDcBenchRegression> Regressions;
+		DcBenchCompareReports(Baseline, Report, Threshold, Regressions);
+		for (FDcBenchRegression& Regression : Regressions)
+		{
+			UE_LOG(LogDataConfigCore, Error, TEXT("benchmark regression: %s, Threads:%d, Baseline: %.3f(ms), Current: %.3f(ms)"),
+				*Regression.Fixture,
+				Regression.ThreadCount,
+				Regression.BaselineMs,
+				Regression.CurrentMs
+			);
+		}
+
+		if (Regressions.Num() > 0)
+			return 1;
+
+		UE_LOG(LogDataConfigCore, Display, TEXT("no benchmark regression against baseline: %s, threshold: %.2f"), *BaselinePath, Threshold);
+	}
+
+	return 0;
+}
+
 INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 {
 	if (GEngineLoop.PreInit(ArgC, ArgV) != 0) // NOLINT
@@ -78,12 +171,26 @@ INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 		getchar();
 	}
 
+	//	`-Bench*` switches also show up in tokens, don't take them as test filters
+	Tokens.RemoveAll([&Switches](const FString& Token) {
+		return Token.StartsWith(TEXT("Bench")) && Switches.Contains(Token);
+	});
+
 	int32 RetCode;
 	{
 		DcRegisterDiagnosticGroup(&DcDExtra::Details);
 
 		DcStartUp(EDcInitializeAction::SetAsConsole);
-		RetCode = TestRunnerBody(Tokens);
+		//	tests run one by one on main thread, nothing else allocates in the background
+		DcBenchSetCountAllocations(true);
+
+		FDcBenchReport Report;
+		RetCode = TestRunnerBody(Tokens, Report);
+
+		int32 BenchRetCode = BenchReportBody(Switches, Report);
+		if (RetCode == 0)
+			RetCode = BenchRetCode;
+
 		DcShutDown();
 	}
 
@@ -2,10 +2,18 @@
 #include "DcTestProperty4.h"
 #include "DcTestSerDe.h"
 #include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/Json/DcJsonTape.h"
+#include "DataConfig/Property/DcPropertyReader.h"
+#include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/Deserialize/DcDeserializerSetup.h"
+#include "DataConfig/Deserialize/DcParallelDeserialize.h"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
+#include "DataConfig/Diagnostic/DcDiagnosticJSON.h"
+#include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
+#include "DataConfig/DcStats.h"
 #include "DataConfig/Deserialize/Handlers/Common/DcCommonDeserializers.h"
 #include "DataConfig/SerDe/DcDeserializeCommon.inl"
 #include "DataConfig/Extra/SerDe/DcSerDeColor.h"
@@ -288,6 +296,71 @@ DC_TEST("DataConfig.Core.Deserialize.ObjRefs")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.Deserialize.ObjRefsCached")
+{
+	FString Str = TEXT(R"(
+
+		{
+			"ObjectField1" : "'/Script/DataConfigTests'",
+			"ObjectField2" : null,
+			"SoftField1" : "'/Script/DataConfigTests'",
+			"SoftField2" : null,
+			"WeakField1" : "'/Script/DataConfigTests'",
+			"WeakField2" : null,
+			"LazyField1" : "'/Script/DataConfigTests'",
+			"LazyField2" : null,
+		}
+
+	)");
+
+	FDcTestStructRefs1 Expect;
+	Expect.MakeFixture();
+	FDcPropertyDatum ExpectDatum(&Expect);
+
+	FDcObjectResolveCache Cache;
+	for (int Ix = 0; Ix < 2; Ix++)
+	{
+		FDcJsonReader Reader(Str);
+
+		FDcTestStructRefs1 Dest;
+		FDcPropertyDatum DestDatum(&Dest);
+
+		UTEST_OK("Deserialize into FDcTestStructRefs1", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum, [&](FDcDeserializeContext& Ctx)
+		{
+			Ctx.ObjectCache = &Cache;
+		}));
+		UTEST_OK("Deserialize into FDcTestStructRefs1", DcAutomationUtils::TestReadDatumEqual(DestDatum, ExpectDatum));
+	}
+
+	//	only the very first reference goes through find/load
+	UTEST_EQUAL("Deserialize into FDcTestStructRefs1", Cache.MissCount, 1);
+	UTEST_EQUAL("Deserialize into FDcTestStructRefs1", Cache.HitCount, 7);
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Deserialize.ObjectCacheClasses")
+{
+	//	same string can resolve to an asset as object and to its generated class as `$type`
+	FDcObjectResolveCache Cache;
+	UObject* Package = GetTransientPackage();
+	Cache.Add(UObject::StaticClass(), TEXT("/Game/Foo"), Package);
+	Cache.AddClass(TEXT("/Game/Foo"), UPackage::StaticClass());
+
+	UObject* Obj = nullptr;
+	UTEST_TRUE("Deserialize ObjectCacheClasses", Cache.Find(UObject::StaticClass(), TEXT("/Game/Foo"), Obj));
+	UTEST_TRUE("Deserialize ObjectCacheClasses", Obj == Package);
+
+	UClass* Class = nullptr;
+	UTEST_TRUE("Deserialize ObjectCacheClasses", Cache.FindClass(TEXT("/Game/Foo"), Class));
+	UTEST_TRUE("Deserialize ObjectCacheClasses", Class == UPackage::StaticClass());
+
+	Cache.Empty();
+	UTEST_FALSE("Deserialize ObjectCacheClasses", Cache.FindClass(TEXT("/Game/Foo"), Class));
+
+	return true;
+}
+
 DC_TEST("DataConfig.Core.Deserialize.ClassRefs")
 {
 	FString Str = TEXT(R"(
@@ -374,6 +447,193 @@ DC_TEST("DataConfig.Core.Deserialize.SkipMetas")
 }
 
 
+DC_TEST("DataConfig.Core.Deserialize.IgnoreUnknownFields")
+{
+	FString Str = TEXT(R"(
+
+		{
+			"Unknown1" : "Foo ] } \" [",
+			"Unknown2" : [1, 2.5, "three", [[[]]], [{}, {"a" : "}"}]],
+			"IntField" : 253,
+			"Unknown3" : { "one" : "uno", /* } */ "nest" : { "nest2" : [] } // ]
+			},
+			"Unknown4" : null,
+			"StrField" : "Foo"
+		}
+
+	)");
+
+	UDcTestClass1* Expect = NewObject<UDcTestClass1>();
+	Expect->IntField = 253;
+	Expect->StrField = "Foo";
+	FDcPropertyDatum ExpectDatum(Expect);
+
+	{
+		FDcJsonReader Reader(Str);
+		UDcTestClass1* Dest = NewObject<UDcTestClass1>();
+		FDcPropertyDatum DestDatum(Dest);
+
+		UTEST_OK("Deserialize IgnoreUnknownFields", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[](FDcDeserializeContext& Ctx)
+		{
+			Ctx.bIgnoreUnknownFields = true;
+		}));
+		UTEST_OK("Deserialize IgnoreUnknownFields", DcAutomationUtils::TestReadDatumEqual(DestDatum, ExpectDatum));
+	}
+
+	{
+		FDcJsonReader Reader(Str);
+		UDcTestClass1* Dest = NewObject<UDcTestClass1>();
+		FDcPropertyDatum DestDatum(Dest);
+
+		UTEST_DIAG("Deserialize IgnoreUnknownFields", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum),
+			DcDReadWrite, CantFindPropertyByName);
+	}
+
+	{
+		FString UnclosedStr = TEXT(R"( { "Unknown" : [1, [2, 3], "IntField" : 1 } )");
+		FDcJsonReader Reader(UnclosedStr);
+		UDcTestClass1* Dest = NewObject<UDcTestClass1>();
+		FDcPropertyDatum DestDatum(Dest);
+
+		UTEST_DIAG("Deserialize IgnoreUnknownFields", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[](FDcDeserializeContext& Ctx)
+		{
+			Ctx.bIgnoreUnknownFields = true;
+		}), DcDJSON, UnexpectedChar);
+	}
+
+	return true;
+}
+
+
+DC_TEST("DataConfig.Core.Deserialize.ParallelJsonArray")
+{
+	using namespace DcPropertyUtils;
+	auto ArrProp = FDcPropertyBuilder::Array(
+		FDcPropertyBuilder::Struct(FDcTestStructSimple::StaticStruct())
+		).LinkOnScope();
+
+	constexpr int32 ItemCount = 1000;
+	constexpr int32 BadItemIx = 700;
+	auto _MakeJson = [](bool bWithBadItem)
+	{
+		FString Ret = TEXT("[\n");
+		for (int32 Ix = 0; Ix < ItemCount; Ix++)
+		{
+			Ret += FString::Printf(TEXT("\t{ \"NameField\" : \"Name%d\", \"StrField\" : \"Str%d\"%s },\n"),
+				Ix, Ix, bWithBadItem && Ix == BadItemIx ? TEXT(", \"Unknown\" : [1, 2]") : TEXT(""));
+		}
+		Ret += TEXT("]\n");
+		return Ret;
+	};
+
+	FDcDeserializer Deserializer;
+	DcSetupJsonDeserializeHandlers(Deserializer);
+
+	{
+		FString Str = _MakeJson(false);
+		FDcJsonTape Tape;
+		UTEST_OK("Deserialize ParallelJsonArray", Tape.Build(*Str));
+
+		TArray<FDcTestStructSimple> Dest;
+		Dest.AddDefaulted(3);
+		UTEST_OK("Deserialize ParallelJsonArray", DcParallelDeserializeJsonArray(&Deserializer, Tape, FDcPropertyDatum(ArrProp.Get(), &Dest),
+		[](FDcDeserializeContext&) {}, 16));
+
+		TArray<FDcTestStructSimple> Expect;
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Deserialize ParallelJsonArray", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(ArrProp.Get(), &Expect)));
+
+		UTEST_EQUAL("Deserialize ParallelJsonArray", Dest.Num(), ItemCount);
+		UTEST_EQUAL("Deserialize ParallelJsonArray", Dest[BadItemIx].StrField, TEXT("Str700"));
+		UTEST_OK("Deserialize ParallelJsonArray", DcAutomationUtils::TestReadDatumEqual(
+			FDcPropertyDatum(ArrProp.Get(), &Dest),
+			FDcPropertyDatum(ArrProp.Get(), &Expect)));
+	}
+
+	{
+		FString Str = _MakeJson(true);
+		FDcJsonTape Tape;
+		UTEST_OK("Deserialize ParallelJsonArray", Tape.Build(*Str));
+
+		TArray<FDcTestStructSimple> Dest;
+		UTEST_DIAG("Deserialize ParallelJsonArray", DcParallelDeserializeJsonArray(&Deserializer, Tape, FDcPropertyDatum(ArrProp.Get(), &Dest),
+		[](FDcDeserializeContext&) {}, 16), DcDReadWrite, CantFindPropertyByName);
+
+		UTEST_OK("Deserialize ParallelJsonArray", DcParallelDeserializeJsonArray(&Deserializer, Tape, FDcPropertyDatum(ArrProp.Get(), &Dest),
+		[](FDcDeserializeContext& Ctx)
+		{
+			Ctx.bIgnoreUnknownFields = true;
+		}, 16));
+		UTEST_EQUAL("Deserialize ParallelJsonArray", Dest.Num(), ItemCount);
+		UTEST_EQUAL("Deserialize ParallelJsonArray", Dest[BadItemIx].NameField, FName(TEXT("Name700")));
+	}
+
+	{
+		//	lowest failed item is reported regardless of scheduling
+		FString Str = _MakeJson(true).Replace(TEXT("\"Str300\" }"), TEXT("\"Str300\", \"Unknown\" : 3 }"));
+		FDcJsonTape Tape;
+		UTEST_OK("Deserialize ParallelJsonArray", Tape.Build(*Str));
+
+		for (int Run = 0; Run < 4; Run++)
+		{
+			TArray<FDcTestStructSimple> Dest;
+			TDcStoreThenReset<bool> ScopedExpectFail(DcEnv().bExpectFail, true);
+			FDcResult Result = DcParallelDeserializeJsonArray(&Deserializer, Tape, FDcPropertyDatum(ArrProp.Get(), &Dest),
+			[](FDcDeserializeContext&) {}, 1);
+
+			UTEST_FALSE("Deserialize ParallelJsonArray", Result.Ok());
+			const TArray<FDcDiagnosticHighlight>& Highlights = DcEnv().GetLastDiag().Highlights;
+			UTEST_TRUE("Deserialize ParallelJsonArray", Highlights.Num() > 0 && Highlights.Last().Formatted == TEXT("Array item: 300"));
+			DcEnv().Diagnostics.Empty();
+		}
+	}
+
+	{
+		//	worker warnings are merged in item order
+		FDcDeserializer Child;
+		Child.Parent = &Deserializer;
+		Child.AddDirectHandler(FNameProperty::StaticClass(), FDcDeserializeDelegate::CreateLambda([](FDcDeserializeContext& Ctx)
+		{
+			FName Value;
+			DC_TRY(Ctx.Reader->ReadName(&Value));
+			DC_TRY(Ctx.Writer->WriteName(Value));
+
+			int32 ItemIx = FCString::Atoi(*Value.ToString().Mid(4));
+			if (ItemIx % 250 == 0)
+				DcEnv().Diag({DcDCommon::Category, DcDCommon::Unexpected1}) << ItemIx;
+			return DcOk();
+		}));
+
+		FString Str = _MakeJson(false);
+		FDcJsonTape Tape;
+		UTEST_OK("Deserialize ParallelJsonArray", Tape.Build(*Str));
+
+		TArray<FDcTestStructSimple> Dest;
+		int32 DiagCount = DcEnv().Diagnostics.Num();
+		UTEST_OK("Deserialize ParallelJsonArray", DcParallelDeserializeJsonArray(&Child, Tape, FDcPropertyDatum(ArrProp.Get(), &Dest),
+		[](FDcDeserializeContext&) {}, 1));
+
+		UTEST_EQUAL("Deserialize ParallelJsonArray", DcEnv().Diagnostics.Num() - DiagCount, 4);
+		for (int32 Ix = 0; Ix < 4; Ix++)
+			UTEST_EQUAL("Deserialize ParallelJsonArray", DcEnv().Diagnostics[DiagCount + Ix].Args[0].GetValue<int>(), Ix * 250);
+		DcEnv().Diagnostics.SetNum(DiagCount);
+	}
+
+	{
+		FDcJsonTape Tape;
+		UTEST_OK("Deserialize ParallelJsonArray", Tape.Build(TEXT("{}")));
+
+		TArray<FDcTestStructSimple> Dest;
+		UTEST_DIAG("Deserialize ParallelJsonArray", DcParallelDeserializeJsonArray(&Deserializer, Tape, FDcPropertyDatum(ArrProp.Get(), &Dest)),
+			DcDReadWrite, DataTypeMismatchNoCoercion);
+	}
+
+	return true;
+}
+
+
 DC_TEST("DataConfig.Core.Deserialize.NonStructClassRoots")
 {
 	FString ExpectStr = TEXT("These are my twisted words");
@@ -766,3 +1026,299 @@ DC_TEST("DataConfig.Core.Deserialize.DiagCoreTypes")
 
 	return true;
 }
+
+DC_TEST("DataConfig.Core.Deserialize.SharedHandlers")
+{
+	FDcDeserializer& Shared = DcGetSharedJsonDeserializer();
+	UTEST_TRUE("Deserialize SharedHandlers", Shared.IsFrozen());
+	UTEST_TRUE("Deserialize SharedHandlers", &Shared == &DcGetSharedJsonDeserializer());
+
+	FString Str = TEXT(R"(
+		{
+			"ColorField1" : "#0000FFFF",
+			"ColorField2" : "#FF0000FF",
+		}
+	)");
+
+	FDcExtraTestStructWithColor1 Expect;
+	Expect.ColorField1 = FColor::Blue;
+	Expect.ColorField2 = FColor::Red;
+
+	{
+		FDcDeserializer Deserializer;
+		Deserializer.Parent = &Shared;
+		Deserializer.AddStructHandler(
+			TBaseStructure<FColor>::Get(),
+			FDcDeserializeDelegate::CreateStatic(DcExtra::HandlerColorDeserialize)
+		);
+
+		FDcExtraTestStructWithColor1 Dest;
+		FDcJsonReader Reader(Str);
+		FDcPropertyWriter Writer(FDcPropertyDatum(&Dest));
+
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = &Deserializer;
+		UTEST_OK("Deserialize SharedHandlers", Ctx.Prepare());
+		UTEST_OK("Deserialize SharedHandlers", Deserializer.Deserialize(Ctx));
+		UTEST_OK("Deserialize SharedHandlers", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Dest), FDcPropertyDatum(&Expect)));
+
+		//	flatten then it's the same
+		Deserializer.Freeze();
+		UTEST_TRUE("Deserialize SharedHandlers", Deserializer.Parent == nullptr);
+
+		FDcExtraTestStructWithColor1 Dest2;
+		FDcJsonReader Reader2(Str);
+		FDcPropertyWriter Writer2(FDcPropertyDatum(&Dest2));
+
+		FDcDeserializeContext Ctx2;
+		Ctx2.Reader = &Reader2;
+		Ctx2.Writer = &Writer2;
+		Ctx2.Deserializer = &Deserializer;
+		UTEST_OK("Deserialize SharedHandlers", Ctx2.Prepare());
+		UTEST_OK("Deserialize SharedHandlers", Deserializer.Deserialize(Ctx2));
+		UTEST_OK("Deserialize SharedHandlers", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Dest2), FDcPropertyDatum(&Expect)));
+	}
+
+	{
+		FDcExtraTestStructWithColor1 Dest;
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Deserialize SharedHandlers", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest), [](FDcDeserializeContext& Ctx){
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FColor>::Get(),
+				FDcDeserializeDelegate::CreateStatic(DcExtra::HandlerColorDeserialize)
+			);
+		}, DcAutomationUtils::EDefaultSetupType::SharedJSONHandlers));
+		UTEST_OK("Deserialize SharedHandlers", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Dest), FDcPropertyDatum(&Expect)));
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Deserialize.TimeSliced")
+{
+	FString Str = TEXT(R"(
+		{
+			"StringArray" : [ "Foo", "Bar", "Baz" ],
+			"StringSet" : [ "Doo", "Dar", "Daz" ],
+			"StringMap" : {
+				"One": "1",
+				"Two": "2",
+				"Three": "3",
+			},
+			"StructArray" : [
+				{ "Name" : "One", "Index" : 1 },
+				{ "Name" : "Two", "Index" : 2 },
+				{ "Name" : "Three", "Index" : 3 }
+			],
+			"StructSet" : [
+				{ "Name" : "One", "Index" : 1 },
+				{ "Name" : "Two", "Index" : 2 },
+				{ "Name" : "Three", "Index" : 3 }
+			],
+		}
+	)");
+
+	FDcDeserializer Deserializer;
+	DcSetupJsonDeserializeHandlers(Deserializer);
+
+	FDcDeserializeBudget Budget;
+	Budget.Steps = 1;
+
+	{
+		FDcTestStruct3 Dest;
+		FDcJsonReader Reader(Str);
+		FDcPropertyWriter Writer(FDcPropertyDatum(&Dest));
+
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = &Deserializer;
+		UTEST_OK("Deserialize TimeSliced", Ctx.Prepare());
+
+		int32 SliceCount = 0;
+		EDcDeserializeStatus Status = EDcDeserializeStatus::InProgress;
+		while (Status == EDcDeserializeStatus::InProgress)
+		{
+			UTEST_OK("Deserialize TimeSliced", Deserializer.Deserialize(Ctx, Budget, &Status));
+			SliceCount++;
+		}
+
+		//	a step per value, container open and close
+		UTEST_TRUE("Deserialize TimeSliced", SliceCount > 20);
+		UTEST_TRUE("Deserialize TimeSliced", Ctx.State == FDcDeserializeContext::EState::DeserializeEnded);
+		UTEST_EQUAL("Deserialize TimeSliced", Ctx.Properties.Num(), 1);
+
+		FDcTestStruct3 Expect;
+		Expect.MakeFixtureNoStructMap();
+		UTEST_OK("Deserialize TimeSliced", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Dest), FDcPropertyDatum(&Expect)));
+
+		EDcDeserializeStatus Unused;
+		UTEST_DIAG("Deserialize TimeSliced", Deserializer.Deserialize(Ctx, Budget, &Unused), DcDSerDe, ContextInvalidState);
+	}
+
+	{
+		FDcTestStruct3 Dest;
+		FDcJsonReader Reader(TEXT(R"({ "StructArray" : [ { "Name" : "One", "Unknown" : 1 } ] })"));
+		FDcPropertyWriter Writer(FDcPropertyDatum(&Dest));
+
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = &Deserializer;
+		UTEST_OK("Deserialize TimeSliced", Ctx.Prepare());
+
+		FDcDeserializeBudget NoLimit;
+		EDcDeserializeStatus Status;
+		UTEST_DIAG("Deserialize TimeSliced", Deserializer.Deserialize(Ctx, NoLimit, &Status), DcDReadWrite, CantFindPropertyByName);
+		UTEST_TRUE("Deserialize TimeSliced", Ctx.State == FDcDeserializeContext::EState::DeserializeEnded);
+	}
+
+	{
+		//	non container root runs in one go
+		using namespace DcPropertyUtils;
+		auto IntProp = FDcPropertyBuilder::Int().LinkOnScope();
+
+		int32 Dest = 0;
+		FDcJsonReader Reader(TEXT("123"));
+		FDcPropertyWriter Writer(FDcPropertyDatum(IntProp.Get(), &Dest));
+
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = &Deserializer;
+		UTEST_OK("Deserialize TimeSliced", Ctx.Prepare());
+
+		EDcDeserializeStatus Status;
+		UTEST_OK("Deserialize TimeSliced", Deserializer.Deserialize(Ctx, Budget, &Status));
+		UTEST_TRUE("Deserialize TimeSliced", Status == EDcDeserializeStatus::Done);
+		UTEST_EQUAL("Deserialize TimeSliced", Dest, 123);
+	}
+
+	{
+		//	pipe handlers read struct/set roots, none of them opts in so it runs in one go
+		FDcDeserializer PipeDeserializer;
+		DcSetupPropertyPipeDeserializeHandlers(PipeDeserializer);
+
+		FDcTestStruct3 Source;
+		Source.MakeFixtureNoStructMap();
+
+		FDcTestStruct3 Dest;
+		FDcPropertyReader Reader(FDcPropertyDatum(&Source));
+		FDcPropertyWriter Writer(FDcPropertyDatum(&Dest));
+
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = &PipeDeserializer;
+		UTEST_OK("Deserialize TimeSliced", Ctx.Prepare());
+
+		EDcDeserializeStatus Status;
+		UTEST_OK("Deserialize TimeSliced", PipeDeserializer.Deserialize(Ctx, Budget, &Status));
+		UTEST_TRUE("Deserialize TimeSliced", Status == EDcDeserializeStatus::Done);
+		UTEST_OK("Deserialize TimeSliced", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Dest), FDcPropertyDatum(&Source)));
+	}
+
+	{
+		//	user array handler layered on top isn't bypassed
+		int32 ArrayHandlerCalls = 0;
+		FDcDeserializer Child;
+		Child.Parent = &Deserializer;
+		Child.AddDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateLambda([&ArrayHandlerCalls](FDcDeserializeContext& Ctx)
+		{
+			ArrayHandlerCalls++;
+			return DcCommonHandlers::HandlerArrayDeserialize(Ctx);
+		}));
+
+		FDcTestStruct3 Dest;
+		FDcJsonReader Reader(Str);
+		FDcPropertyWriter Writer(FDcPropertyDatum(&Dest));
+
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = &Child;
+		UTEST_OK("Deserialize TimeSliced", Ctx.Prepare());
+
+		EDcDeserializeStatus Status = EDcDeserializeStatus::InProgress;
+		while (Status == EDcDeserializeStatus::InProgress)
+			UTEST_OK("Deserialize TimeSliced", Child.Deserialize(Ctx, Budget, &Status));
+
+		UTEST_EQUAL("Deserialize TimeSliced", ArrayHandlerCalls, 2);
+
+		FDcTestStruct3 Expect;
+		Expect.MakeFixtureNoStructMap();
+		UTEST_OK("Deserialize TimeSliced", DcAutomationUtils::TestReadDatumEqual(FDcPropertyDatum(&Dest), FDcPropertyDatum(&Expect)));
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Deserialize.Stats")
+{
+#if DC_STATS_ENABLED
+	FString Str = TEXT(R"(
+		{
+			"StringArray" : [ "Foo", "Bar", "Baz" ],
+			"StringSet" : [ "Doo", "Dar", "Daz" ],
+			"StringMap" : {
+				"One": "1",
+				"Two": "2",
+				"Three": "3",
+			},
+			"StructArray" : [
+				{ "Name" : "One", "Index" : 1 },
+				{ "Name" : "Two", "Index" : 2 },
+				{ "Name" : "Three", "Index" : 3 }
+			],
+			"StructSet" : [
+				{ "Name" : "One", "Index" : 1 },
+				{ "Name" : "Two", "Index" : 2 },
+				{ "Name" : "Three", "Index" : 3 }
+			],
+		}
+	)");
+
+	FDcTestStruct3 Dest;
+	FDcJsonReader Reader(Str);
+	FDcPropertyWriter Writer(FDcPropertyDatum(&Dest));
+
+	FDcDeserializer Deserializer;
+	DcSetupJsonDeserializeHandlers(Deserializer);
+
+	FDcStats Stats;
+	FDcDeserializeContext Ctx;
+	Ctx.Reader = &Reader;
+	Ctx.Writer = &Writer;
+	Ctx.Deserializer = &Deserializer;
+	Ctx.Stats = &Stats;
+	UTEST_OK("Deserialize Stats", Ctx.Prepare());
+	UTEST_OK("Deserialize Stats", Deserializer.Deserialize(Ctx));
+
+	UTEST_TRUE("Deserialize Stats", Reader.Stats == &Stats);
+	UTEST_EQUAL("Deserialize Stats", Stats.GetEntryCount(EDcDataEntry::MapRoot), (int64)8);
+	UTEST_EQUAL("Deserialize Stats", Stats.GetEntryCount(EDcDataEntry::ArrayRoot), (int64)4);
+	UTEST_EQUAL("Deserialize Stats", Stats.GetEntryCount(EDcDataEntry::Int16), (int64)6);
+	UTEST_TRUE("Deserialize Stats", Stats.BytesConsumed > 0 && Stats.BytesConsumed <= Str.Len() * (int64)sizeof(TCHAR));
+	UTEST_TRUE("Deserialize Stats", Stats.StringsCreated >= 12);
+	UTEST_TRUE("Deserialize Stats", Stats.NamesCreated > 0);
+	UTEST_TRUE("Deserialize Stats", Stats.PredicateEvaluations > 0);
+	UTEST_TRUE("Deserialize Stats", Stats.ContainerGrowths > 0);
+	UTEST_TRUE("Deserialize Stats", Stats.PeakDepth >= 2);
+	UTEST_EQUAL("Deserialize Stats", Stats.HandlerCalls.FindRef(FArrayProperty::StaticClass()->GetFName()), (int64)2);
+	UTEST_TRUE("Deserialize Stats", Stats.ToString().Contains(TEXT("Entry.ArrayRoot: 4")));
+
+	FDcStats Merged;
+	Merged.Merge(Stats);
+	Merged.Merge(Stats);
+	UTEST_EQUAL("Deserialize Stats", Merged.GetEntryTotal(), Stats.GetEntryTotal() * 2);
+	UTEST_EQUAL("Deserialize Stats", Merged.PeakDepth, Stats.PeakDepth);
+
+	Merged.Reset();
+	UTEST_EQUAL("Deserialize Stats", Merged.GetEntryTotal(), (int64)0);
+	UTEST_EQUAL("Deserialize Stats", Merged.HandlerCalls.Num(), 0);
+#endif // DC_STATS_ENABLED
+
+	return true;
+}
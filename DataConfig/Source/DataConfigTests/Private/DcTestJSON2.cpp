@@ -1,6 +1,7 @@
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Json/DcJsonReader.h"
 #include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/Json/DcJsonTape.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
 #include "DataConfig/SerDe/DcSerDeUtils.h"
 #include "DataConfig/Serialize/DcSerializeUtils.h"
@@ -813,3 +814,128 @@ DC_TEST("DataConfig.Core.JSON.OverrideConfig")
 	return true;
 }
 
+
+DC_TEST("DataConfig.Core.JSON.Tape")
+{
+	FString Str = TEXT(R"(
+
+		{
+			"Str" : "Foo \"[}\"",
+			"Num" : -12.5e3,
+			// "Commented" : [
+			"Skip" : { "Nest" : [ [], {}, [ "]" ] ], /* } */ "Bool" : true },
+			"Arr" : [
+				{ "Name" : "Alpha", "Int" : 1 },
+				{ "Name" : "Beta", "Int" : 2 },
+				{ "Name" : "Gamma", "Int" : 3 },
+			],
+			"Null" : null,
+		}
+
+	)");
+
+	FDcJsonTape Tape;
+	UTEST_OK("JSON Tape", Tape.Build(*Str));
+
+	//	reads the same as streaming reader
+	{
+		FDcJsonReader Reader(Str);
+		FDcJsonTapeReader TapeReader(&Tape);
+		UTEST_EQUAL("JSON Tape", DcAutomationUtils::DumpFormat(&Reader), DcAutomationUtils::DumpFormat(&TapeReader));
+	}
+
+	{
+		FTCHARToUTF8 AnsiStr(*Str);
+		FDcAnsiJsonTape AnsiTape;
+		UTEST_OK("JSON Tape", AnsiTape.Build(AnsiStr.Get(), AnsiStr.Length()));
+
+		FDcJsonReader Reader(Str);
+		FDcAnsiJsonTapeReader TapeReader(&AnsiTape);
+		UTEST_EQUAL("JSON Tape", DcAutomationUtils::DumpFormat(&Reader), DcAutomationUtils::DumpFormat(&TapeReader));
+	}
+
+	UTEST_TRUE("JSON Tape", Tape.IsContainer(0));
+	UTEST_EQUAL("JSON Tape", Tape.Entries[0].Count, 5);
+	UTEST_EQUAL("JSON Tape", Tape.GetValueEnd(0), Tape.Num());
+
+	//	skip and size hints
+	int32 ArrIx = INDEX_NONE;
+	{
+		FDcJsonTapeReader Reader(&Tape);
+		UTEST_OK("JSON Tape", Reader.ReadMapRoot());
+
+		int32 SizeHint;
+		UTEST_OK("JSON Tape", Reader.GetContainerSizeHint(&SizeHint));
+		UTEST_EQUAL("JSON Tape", SizeHint, 5);
+
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.GetContainerSizeHint(&SizeHint));
+		UTEST_EQUAL("JSON Tape", SizeHint, 3);
+
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+
+		FString Key;
+		UTEST_OK("JSON Tape", Reader.ReadString(&Key));
+		UTEST_EQUAL("JSON Tape", Key, TEXT("Arr"));
+
+		ArrIx = Reader.Cur;
+		UTEST_OK("JSON Tape", Reader.ReadArrayRoot());
+		UTEST_OK("JSON Tape", Reader.GetContainerSizeHint(&SizeHint));
+		UTEST_EQUAL("JSON Tape", SizeHint, 3);
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.ReadArrayEnd());
+
+		UTEST_OK("JSON Tape", Reader.SkipValue());
+		UTEST_OK("JSON Tape", Reader.ReadNone());
+		UTEST_OK("JSON Tape", Reader.ReadMapEnd());
+
+		EDcDataEntry Next;
+		UTEST_OK("JSON Tape", Reader.PeekRead(&Next));
+		UTEST_EQUAL("JSON Tape", Next, EDcDataEntry::Ended);
+	}
+
+	//	random access into array items
+	{
+		TArray<int32> ItemIxs;
+		Tape.GetArrayItems(ArrIx, ItemIxs);
+		UTEST_EQUAL("JSON Tape", ItemIxs.Num(), 3);
+
+		FDcJsonTapeReader Reader(&Tape, ItemIxs[2]);
+		FString NameStr;
+		int32 Int;
+		UTEST_OK("JSON Tape", Reader.ReadMapRoot());
+		UTEST_OK("JSON Tape", Reader.ReadString(nullptr));
+		UTEST_OK("JSON Tape", Reader.ReadString(&NameStr));
+		UTEST_OK("JSON Tape", Reader.ReadString(nullptr));
+		UTEST_OK("JSON Tape", Reader.ReadInt32(&Int));
+		UTEST_OK("JSON Tape", Reader.ReadMapEnd());
+
+		EDcDataEntry Next;
+		UTEST_OK("JSON Tape", Reader.PeekRead(&Next));
+		UTEST_EQUAL("JSON Tape", Next, EDcDataEntry::Ended);
+
+		UTEST_EQUAL("JSON Tape", NameStr, TEXT("Gamma"));
+		UTEST_EQUAL("JSON Tape", Int, 3);
+	}
+
+	//	structural errors are caught at build
+	{
+		FDcJsonTape BadTape;
+		UTEST_DIAG("JSON Tape", BadTape.Build(TEXT("[1, [2, 3]")), DcDJSON, EndUnclosedArray);
+		UTEST_DIAG("JSON Tape", BadTape.Build(TEXT("{\"a\" 1}")), DcDJSON, UnexpectedToken);
+		UTEST_DIAG("JSON Tape", BadTape.Build(TEXT("{1 : 2}")), DcDJSON, KeyMustBeString);
+		UTEST_DIAG("JSON Tape", BadTape.Build(TEXT("[1 2]")), DcDJSON, ExpectComma);
+		UTEST_DIAG("JSON Tape", BadTape.Build(TEXT("[1, 2}")), DcDJSON, UnexpectedToken);
+		UTEST_DIAG("JSON Tape", BadTape.Build(TEXT("[1] 2")), DcDJSON, UnexpectedTrailingToken);
+		UTEST_DIAG("JSON Tape", BadTape.Build(TEXT("[\"unclosed]")), DcDJSON, UnclosedStringLiteral);
+	}
+
+	return true;
+}
+
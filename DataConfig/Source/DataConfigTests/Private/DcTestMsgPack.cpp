@@ -1,4 +1,5 @@
 #include "DcTestMsgPack.h"
+#include "DcTestProperty4.h"
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
@@ -13,6 +14,11 @@
 #include "DataConfig/MsgPack/DcMsgPackWriter.h"
 #include "DataConfig/MsgPack/DcMsgPackReader.h"
 #include "DataConfig/MsgPack/DcMsgPackUtils.h"
+#include "DataConfig/Property/DcPropertyReader.h"
+#include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Serialize/DcSerializerSetup.h"
+#include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/Deserialize/DcDeserializerSetup.h"
 #include "Misc/Base64.h"
 #include "Misc/FileHelper.h"
 #include "Misc/ScopeExit.h"
@@ -631,6 +637,242 @@ DC_TEST("DataConfig.Core.MsgPack.TextName")
 }
 
 
+DC_TEST("DataConfig.Core.MsgPack.StringViewName")
+{
+	using namespace DcTestMsgPackDetails;
+
+	FString NonAscii = TEXT("Foo\u00e9\u4e2d");
+
+	FDcMsgPackWriter Writer;
+	UTEST_OK("MsgPack StringView", Writer.WriteString(TEXT("Ascii")));
+	UTEST_OK("MsgPack StringView", Writer.WriteString(NonAscii));
+	UTEST_OK("MsgPack StringView", Writer.WriteString(TEXT("")));
+	for (int Ix = 0; Ix < 3; Ix++)
+	{
+		UTEST_OK("MsgPack StringView", Writer.WriteName(FName(TEXT("FieldAlpha"))));
+		UTEST_OK("MsgPack StringView", Writer.WriteName(FName(TEXT("FieldBeta"))));
+	}
+	UTEST_OK("MsgPack StringView", Writer.WriteString(NonAscii));
+	UTEST_OK("MsgPack StringView", Writer.WriteString(TEXT("Ascii")));
+
+	auto& Buffer = Writer.GetMainBuffer();
+	FDcMsgPackReader Reader({Buffer.GetData(), Buffer.Num()});
+
+	FString Str;
+	UTEST_OK("MsgPack StringView", Reader.ReadString(&Str));
+	UTEST_EQUAL("MsgPack StringView", Str, TEXT("Ascii"));
+	UTEST_OK("MsgPack StringView", Reader.ReadString(&Str));
+	UTEST_EQUAL("MsgPack StringView", Str, NonAscii);
+	UTEST_OK("MsgPack StringView", Reader.ReadString(&Str));
+	UTEST_TRUE("MsgPack StringView", Str.IsEmpty());
+
+	for (int Ix = 0; Ix < 3; Ix++)
+	{
+		FName Name;
+		UTEST_OK("MsgPack StringView", Reader.ReadName(&Name));
+		UTEST_EQUAL("MsgPack StringView", Name, FName(TEXT("FieldAlpha")));
+		UTEST_OK("MsgPack StringView", Reader.ReadName(&Name));
+		UTEST_EQUAL("MsgPack StringView", Name, FName(TEXT("FieldBeta")));
+	}
+
+	FName NonAsciiName;
+	UTEST_OK("MsgPack StringView", Reader.ReadName(&NonAsciiName));
+	UTEST_EQUAL("MsgPack StringView", NonAsciiName.ToString(), NonAscii);
+
+	FAnsiStringView Sv;
+	UTEST_OK("MsgPack StringView", Reader.ReadStringView(&Sv));
+	UTEST_TRUE("MsgPack StringView", Sv.Equals("Ascii"));
+
+	return true;
+}
+
+
+DC_TEST("DataConfig.Core.MsgPack.ContainerSizeHint")
+{
+	{
+		FDcMsgPackWriter Writer;
+		UTEST_OK("MsgPack SizeHint", Writer.WriteArrayRoot());
+		UTEST_OK("MsgPack SizeHint", Writer.WriteInt32(1));
+		UTEST_OK("MsgPack SizeHint", Writer.WriteInt32(2));
+		UTEST_OK("MsgPack SizeHint", Writer.WriteInt32(3));
+		UTEST_OK("MsgPack SizeHint", Writer.WriteArrayEnd());
+
+		auto& Buffer = Writer.GetMainBuffer();
+		FDcMsgPackReader Reader({Buffer.GetData(), Buffer.Num()});
+
+		int32 SizeHint;
+		UTEST_OK("MsgPack SizeHint", Reader.GetContainerSizeHint(&SizeHint));
+		UTEST_EQUAL("MsgPack SizeHint", SizeHint, INDEX_NONE);
+
+		UTEST_OK("MsgPack SizeHint", Reader.ReadArrayRoot());
+		UTEST_OK("MsgPack SizeHint", Reader.GetContainerSizeHint(&SizeHint));
+		UTEST_EQUAL("MsgPack SizeHint", SizeHint, 3);
+
+		UTEST_OK("MsgPack SizeHint", Reader.ReadInt32(nullptr));
+		UTEST_OK("MsgPack SizeHint", Reader.GetContainerSizeHint(&SizeHint));
+		UTEST_EQUAL("MsgPack SizeHint", SizeHint, 2);
+	}
+
+	FDcTestHighlight Source;
+	for (int Ix = 0; Ix < 64; Ix++)
+	{
+		FString Str = FString::Printf(TEXT("Item%d"), Ix);
+		Source.StrArr.Add(Str);
+		Source.StrMap.Add(Str, Str);
+		Source.StrSet.Add(Str);
+	}
+	FDcPropertyDatum SourceDatum(&Source);
+
+	{
+		FDcPropertyReader Reader(SourceDatum);
+		UTEST_OK("MsgPack SizeHint", Reader.ReadStructRoot());
+		//	skip `NameField` and `NameArr`
+		for (int Ix = 0; Ix < 2; Ix++)
+		{
+			UTEST_OK("MsgPack SizeHint", Reader.ReadName(nullptr));
+			UTEST_OK("MsgPack SizeHint", Reader.SkipRead());
+		}
+		UTEST_OK("MsgPack SizeHint", Reader.ReadName(nullptr));
+		UTEST_OK("MsgPack SizeHint", Reader.ReadArrayRoot());
+
+		int32 SizeHint;
+		UTEST_OK("MsgPack SizeHint", Reader.GetContainerSizeHint(&SizeHint));
+		UTEST_EQUAL("MsgPack SizeHint", SizeHint, 64);
+	}
+
+	FDcMsgPackWriter MsgPackWriter;
+	UTEST_OK("MsgPack SizeHint", DcAutomationUtils::SerializeInto(&MsgPackWriter, SourceDatum,
+	[](FDcSerializeContext& Ctx)
+	{
+		DcSetupMsgPackSerializeHandlers(*Ctx.Serializer);
+	}, DcAutomationUtils::EDefaultSetupType::SetupNothing));
+
+	FDcMsgPackWriter::BufferType& Buffer = MsgPackWriter.GetMainBuffer();
+
+	FDcTestHighlight Dest;
+	FDcPropertyDatum DestDatum(&Dest);
+	{
+		FDcMsgPackReader Reader({Buffer.GetData(), Buffer.Num()});
+		UTEST_OK("MsgPack SizeHint", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[](FDcDeserializeContext& Ctx)
+		{
+			DcSetupMsgPackDeserializeHandlers(*Ctx.Deserializer);
+		}, DcAutomationUtils::EDefaultSetupType::SetupNothing));
+	}
+
+	UTEST_OK("MsgPack SizeHint", DcAutomationUtils::TestReadDatumEqual(SourceDatum, DestDatum));
+	//	reserved up front to exact count
+	UTEST_EQUAL("MsgPack SizeHint", Dest.StrArr.Max(), 64);
+	UTEST_EQUAL("MsgPack SizeHint", Dest.StrMap.Num(), 64);
+	UTEST_EQUAL("MsgPack SizeHint", Dest.StrSet.Num(), 64);
+
+	{
+		//	time sliced containers reserve the same way
+		FDcTestHighlight SlicedDest;
+		FDcMsgPackReader Reader({Buffer.GetData(), Buffer.Num()});
+		FDcPropertyWriter Writer((FDcPropertyDatum(&SlicedDest)));
+
+		FDcDeserializer Deserializer;
+		DcSetupMsgPackDeserializeHandlers(Deserializer);
+
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = &Deserializer;
+		UTEST_OK("MsgPack SizeHint", Ctx.Prepare());
+
+		FDcDeserializeBudget Budget;
+		Budget.Steps = 1;
+		EDcDeserializeStatus Status = EDcDeserializeStatus::InProgress;
+		while (Status == EDcDeserializeStatus::InProgress)
+			UTEST_OK("MsgPack SizeHint", Deserializer.Deserialize(Ctx, Budget, &Status));
+
+		UTEST_OK("MsgPack SizeHint", DcAutomationUtils::TestReadDatumEqual(SourceDatum, FDcPropertyDatum(&SlicedDest)));
+		UTEST_EQUAL("MsgPack SizeHint", SlicedDest.StrArr.Max(), 64);
+	}
+
+	{
+		//	crafted array32/map32 headers claiming ~2^31 items with a single byte following
+		uint8 ArrBytes[] = { 0xdd, 0x7f, 0xff, 0xff, 0xff, 0x01 };
+		FDcMsgPackReader Reader({ArrBytes, sizeof(ArrBytes)});
+
+		int32 ArrSizeHint;
+		UTEST_OK("MsgPack SizeHint", Reader.ReadArrayRoot());
+		UTEST_OK("MsgPack SizeHint", Reader.GetContainerSizeHint(&ArrSizeHint));
+		UTEST_EQUAL("MsgPack SizeHint", ArrSizeHint, 1);
+
+		uint8 MapBytes[] = { 0xdf, 0x7f, 0xff, 0xff, 0xff, 0x01 };
+		FDcMsgPackReader MapReader({MapBytes, sizeof(MapBytes)});
+		UTEST_OK("MsgPack SizeHint", MapReader.ReadMapRoot());
+		int32 MapSizeHint;
+		UTEST_OK("MsgPack SizeHint", MapReader.GetContainerSizeHint(&MapSizeHint));
+		UTEST_EQUAL("MsgPack SizeHint", MapSizeHint, 0);
+
+		FDcTestHighlight Crafted;
+		FDcPropertyWriter Writer((FDcPropertyDatum(&Crafted)));
+		UTEST_OK("MsgPack SizeHint", Writer.WriteStructRoot());
+		UTEST_OK("MsgPack SizeHint", Writer.WriteName(TEXT("StrArr")));
+		UTEST_OK("MsgPack SizeHint", Writer.WriteArrayRoot());
+		UTEST_OK("MsgPack SizeHint", Writer.ReserveContainer(ArrSizeHint));
+		UTEST_TRUE("MsgPack SizeHint", Crafted.StrArr.Max() <= 1);
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.MsgPack.SkipValue")
+{
+	uint8 BlobBytes[300] = {};
+	FString LongStr = FString::ChrN(300, TCHAR('X'));
+
+	FDcMsgPackWriter Writer;
+	UTEST_OK("MsgPack SkipValue", Writer.WriteMapRoot());
+	UTEST_OK("MsgPack SkipValue", Writer.WriteString(TEXT("Skip")));
+	{
+		UTEST_OK("MsgPack SkipValue", Writer.WriteArrayRoot());
+		UTEST_OK("MsgPack SkipValue", Writer.WriteInt8(-3));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteInt64(-123456789012));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteUInt16(65535));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteFloat(1.5f));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteDouble(2.5));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteString(LongStr));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteBlob({BlobBytes, 300}));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteFixExt1(1, 2));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteExt(3, {BlobBytes, 20}));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteNone());
+		UTEST_OK("MsgPack SkipValue", Writer.WriteMapRoot());
+		UTEST_OK("MsgPack SkipValue", Writer.WriteString(TEXT("Nest")));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteArrayRoot());
+		UTEST_OK("MsgPack SkipValue", Writer.WriteBool(true));
+		UTEST_OK("MsgPack SkipValue", Writer.WriteArrayEnd());
+		UTEST_OK("MsgPack SkipValue", Writer.WriteMapEnd());
+		UTEST_OK("MsgPack SkipValue", Writer.WriteArrayEnd());
+	}
+	UTEST_OK("MsgPack SkipValue", Writer.WriteString(TEXT("Keep")));
+	UTEST_OK("MsgPack SkipValue", Writer.WriteInt32(42));
+	UTEST_OK("MsgPack SkipValue", Writer.WriteMapEnd());
+
+	auto& Buffer = Writer.GetMainBuffer();
+	FDcMsgPackReader Reader({Buffer.GetData(), Buffer.Num()});
+
+	UTEST_OK("MsgPack SkipValue", Reader.ReadMapRoot());
+	UTEST_OK("MsgPack SkipValue", Reader.SkipValue());
+	UTEST_OK("MsgPack SkipValue", Reader.SkipValue());
+
+	FString Key;
+	UTEST_OK("MsgPack SkipValue", Reader.ReadString(&Key));
+	UTEST_EQUAL("MsgPack SkipValue", Key, TEXT("Keep"));
+	int32 Value;
+	UTEST_OK("MsgPack SkipValue", Reader.ReadInt32(&Value));
+	UTEST_EQUAL("MsgPack SkipValue", Value, 42);
+	UTEST_OK("MsgPack SkipValue", Reader.ReadMapEnd());
+
+	UTEST_DIAG("MsgPack SkipValue", Reader.SkipValue(), DcDMsgPack, ReadingPastEnd);
+
+	return true;
+}
+
+
 DC_TEST("DataConfig.Core.MsgPack.Diags")
 {
 	using namespace DcTestMsgPackDetails;
@@ -6,6 +6,9 @@
 #include "DataConfig/Property/DcPropertyReader.h"
 #include "DataConfig/Json/DcJsonReader.h"
 #include "DataConfig/MsgPack/DcMsgPackReader.h"
+#include "DataConfig/Source/DcAsyncFileSource.h"
+#include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
+#include "Misc/FileHelper.h"
 
 DC_TEST("DataConfig.Core.Reader.Cast")
 {
@@ -79,4 +82,40 @@ DC_TEST("DataConfig.Core.Reader.Cast")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.Reader.AsyncFileSource")
+{
+	FString Path = DcGetFixturePath(TEXT("MsgPack/msgpack-test-suite.json"));
+
+	TArray<uint8> Expect;
+	verify(FFileHelper::LoadFileToArray(Expect, *Path));
+
+	{
+		//	small chunks to have many requests in flight
+		FDcAsyncFileSource Source;
+		UTEST_OK("Reader AsyncFileSource", Source.Open(Path, 4096));
+		UTEST_OK("Reader AsyncFileSource", Source.Wait());
+		UTEST_TRUE("Reader AsyncFileSource", Source.IsReady());
+		UTEST_TRUE("Reader AsyncFileSource", Source.Buffer == Expect);
 
+		FDcAnsiSourceBuffer Ansi = Source.GetAnsiSource();
+		FDcAnsiJsonReader Reader(Ansi.Buffer, Ansi.Num);
+		UTEST_OK("Reader AsyncFileSource", Reader.SkipValue());
+
+		EDcDataEntry Next;
+		UTEST_OK("Reader AsyncFileSource", Reader.PeekRead(&Next));
+		UTEST_TRUE("Reader AsyncFileSource", Next == EDcDataEntry::Ended);
+	}
+
+	{
+		//	destructing with reads in flight
+		FDcAsyncFileSource Source;
+		UTEST_OK("Reader AsyncFileSource", Source.Open(Path, 1024));
+	}
+
+	{
+		FDcAsyncFileSource Source;
+		UTEST_DIAG("Reader AsyncFileSource", Source.Open(DcGetFixturePath(TEXT("DoesNotExist.json"))), DcDCommon, FileOpenFailed);
+	}
+
+	return true;
+}
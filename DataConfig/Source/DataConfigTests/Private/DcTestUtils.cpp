@@ -1,8 +1,14 @@
 #include "DcTestSerDe.h"
+#include "DcTestProperty2.h"
+#include "DcTestProperty4.h"
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
+#include "DataConfig/Property/DcPropertyUtils.h"
+#include "DataConfig/SerDe/DcSerDeEnumLookup.h"
+#include "DataConfig/SerDe/DcSerDeNameCache.h"
+#include "UObject/UObjectGlobals.h"
 
 DC_TEST("DataConfig.Core.Utils.DcDiagnostic")
 {
@@ -30,3 +36,108 @@ DC_TEST("DataConfig.Core.Utils.DcDiagnostic")
 
 	return true;
 }
+
+DC_TEST("DataConfig.Core.Utils.EnumLookup")
+{
+	UEnum* Enum = StaticEnum<EDcTestEnum1>();
+	FDcEnumLookupRef Lookup = DcSerDeUtils::FindOrBuildEnumLookup(Enum);
+
+	UTEST_TRUE("Utils EnumLookup", &Lookup.Get() == &DcSerDeUtils::FindOrBuildEnumLookup(Enum).Get());
+	UTEST_FALSE("Utils EnumLookup", Lookup->bIsBitFlags);
+	UTEST_EQUAL("Utils EnumLookup", Lookup->Num(), Enum->NumEnums());
+
+	int Index = Lookup->FindIndexByName(TEXT("bar"));
+	UTEST_EQUAL("Utils EnumLookup", Index, Enum->GetIndexByValue((int64)EDcTestEnum1::Bar));
+	UTEST_EQUAL("Utils EnumLookup", Lookup->Values[Index], (int64)EDcTestEnum1::Bar);
+	UTEST_EQUAL("Utils EnumLookup", Lookup->Names[Lookup->FindIndexByValue((int64)EDcTestEnum1::Tard)], FString(TEXT("Tard")));
+	UTEST_EQUAL("Utils EnumLookup", Lookup->FindIndexByName(TEXT("EDcTestEnum1::Bar")), INDEX_NONE);
+
+	DcSerDeUtils::InvalidateEnumLookup(Enum);
+	UTEST_TRUE("Utils EnumLookup", &Lookup.Get() != &DcSerDeUtils::FindOrBuildEnumLookup(Enum).Get());
+
+#if WITH_EDITOR
+	//	edited enums are dropped through object change delegates
+	Lookup = DcSerDeUtils::FindOrBuildEnumLookup(Enum);
+	FCoreUObjectDelegates::OnObjectModified.Broadcast(Enum);
+	UTEST_TRUE("Utils EnumLookup", &Lookup.Get() != &DcSerDeUtils::FindOrBuildEnumLookup(Enum).Get());
+#endif // WITH_EDITOR
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Utils.PropertyToDataEntry")
+{
+	auto _Entry = [](UStruct* Struct, const TCHAR* Name)
+	{
+		return DcPropertyUtils::PropertyToDataEntry(DcPropertyUtils::FindEffectivePropertyByName(Struct, Name));
+	};
+
+	UScriptStruct* Struct1 = FDcTestStruct1::StaticStruct();
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct1, TEXT("BoolField")), EDcDataEntry::Bool);
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct1, TEXT("NameField")), EDcDataEntry::Name);
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct1, TEXT("TextField")), EDcDataEntry::Text);
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct1, TEXT("EnumField")), EDcDataEntry::Enum);
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct1, TEXT("DoubleField")), EDcDataEntry::Double);
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct1, TEXT("Int16Field")), EDcDataEntry::Int16);
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct1, TEXT("UInt8Field")), EDcDataEntry::UInt8);
+
+	//	same property class as `UInt8Field` but with an enum
+	UScriptStruct* StructEnum2 = FDcTestStructEnum2::StaticStruct();
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(StructEnum2, TEXT("EnumNamespaced1")), EDcDataEntry::Enum);
+
+	UScriptStruct* Struct3 = FDcTestStruct3::StaticStruct();
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct3, TEXT("StringSet")), EDcDataEntry::SetRoot);
+	UTEST_EQUAL("Utils PropertyToDataEntry", _Entry(Struct3, TEXT("StructArray")), EDcDataEntry::ArrayRoot);
+
+	FProperty* NameArr = DcPropertyUtils::FindEffectivePropertyByName(FDcTestArrayDim1::StaticStruct(), TEXT("NameArr"));
+	UTEST_EQUAL("Utils PropertyToDataEntry", DcPropertyUtils::PropertyToDataEntry(NameArr), EDcDataEntry::Name);
+
+	DcPropertyUtils::FDcPropertyEntryCache Cache;
+	UTEST_EQUAL("Utils PropertyToDataEntry", Cache.Get(NameArr), EDcDataEntry::ArrayRoot);
+	UTEST_EQUAL("Utils PropertyToDataEntry", Cache.Get(DcPropertyUtils::FindEffectivePropertyByName(Struct1, TEXT("BoolField"))), EDcDataEntry::Bool);
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Utils.NameTransformCache")
+{
+	int TransformCalls = 0;
+	FDcNameToStringCache Cache([&TransformCalls](const FName& Name)
+	{
+		TransformCalls++;
+		return Name.ToString().ToLower();
+	});
+
+	const FString& Foo = Cache.Get(TEXT("FooBar"));
+	UTEST_EQUAL("Utils NameTransformCache", Foo, FString(TEXT("foobar")));
+	UTEST_TRUE("Utils NameTransformCache", &Foo == &Cache.Get(TEXT("FooBar")));
+
+	//	reference survives growth
+	for (int Ix = 0; Ix < 64; Ix++)
+		Cache.Get(FName(TEXT("Field"), Ix));
+
+	UTEST_EQUAL("Utils NameTransformCache", Foo, FString(TEXT("foobar")));
+	UTEST_EQUAL("Utils NameTransformCache", TransformCalls, 65);
+	UTEST_EQUAL("Utils NameTransformCache", Cache.Num(), 65);
+
+	Cache.Reset();
+	UTEST_EQUAL("Utils NameTransformCache", Cache.Num(), 0);
+	UTEST_EQUAL("Utils NameTransformCache", Cache.Get(TEXT("FooBar")), FString(TEXT("foobar")));
+	UTEST_EQUAL("Utils NameTransformCache", TransformCalls, 66);
+
+#if WITH_CASE_PRESERVING_NAME
+	{
+		//	names differ only in case are transformed separately
+		FDcNameToStringCache CaseCache([](const FName& Name)
+		{
+			return Name.ToString();
+		});
+
+		UTEST_EQUAL("Utils NameTransformCache", CaseCache.Get(TEXT("Url")), FString(TEXT("Url")));
+		UTEST_EQUAL("Utils NameTransformCache", CaseCache.Get(TEXT("URL")), FString(TEXT("URL")));
+		UTEST_EQUAL("Utils NameTransformCache", CaseCache.Num(), 2);
+	}
+#endif // WITH_CASE_PRESERVING_NAME
+
+	return true;
+}